@@ -170595,6439 +170595,3317 @@ IedModel iedModel = {
     initializeValues
 };
 
+/* initial values compacted by scripts/compact-iec-model.cjs */
+
+typedef enum {
+    IED_INIT_STRING,
+    IED_INIT_INT32,
+    IED_INIT_UINT32,
+    IED_INIT_FLOAT,
+    IED_INIT_BOOLEAN
+} IedInitKind;
+
+typedef struct {
+    DataAttribute* attribute;
+    uint8_t kind;
+    union {
+        uint16_t s;
+        int32_t i;
+        uint32_t u;
+        float f;
+        bool b;
+    } value;
+} IedInitialValue;
+
+/* 44 unique strings shared by 1261 attributes */
+static const char* const iedInitStrings[] = {
+    "SIEMENS",
+    "2022-11-28 11:34:54",
+    "IEC 61850-7-4:2007",
+    "@Application",
+    "IEC 61850-7-4:2007B",
+    "SIPROTEC5",
+    "2025-04-30 07:08:40",
+    "7SJ85-DAAA-AA0-0AAAA0-AH0112-23111B-ABBCDA-AAAAC0-CB1BA1-EB0BB1",
+    "V09.30",
+    "7SJ85",
+    "SIEMENS SIPROTEC 5",
+    "SIPROTEC5/userdefined",
+    "Siprotec5/user-defined",
+    "2024-04-26 10:10:18",
+    "2023-03-17 15:21:26",
+    "2023-09-07 13:09:18",
+    "2023-09-07 14:27:44",
+    "2023-10-02 14:49:04",
+    "2024-04-23 13:03:56",
+    "@BinIO",
+    "2023-09-07 08:53:50",
+    "@CB1",
+    "@Mod1",
+    "@Mod2",
+    "2022-11-28 12:18:40",
+    "2022-12-16 14:33:33",
+    "@Mod3",
+    "2023-08-31 13:34:51",
+    "2023-09-20 09:24:00",
+    "@PowS",
+    "IEC_61850-7-4:2007B",
+    "2023-01-06 11:42:27",
+    "IEC 61869-9:2016A",
+    "@Rec",
+    "2023-09-29 14:51:58",
+    "@VI3p1",
+    "2022-11-28 15:36:54",
+    "2023-09-20 15:49:16",
+    "2025-04-28 14:17:39",
+    "@ComSupervision",
+    "GPS01GPC01UPM01FCB02CB1/LLN0.Control_DataSet",
+    "2025-04-29 07:09:22",
+    "GPS01GCB01VI3p1_ArcProtection1/LLN0.Control_DataSet",
+    "GPS01GPC01UPM01MCB01CB1/LLN0.Control_DataSet"
+};
+
+static const IedInitialValue iedInitialValues[] = {
+    { &iedModel_AnUn_ArcProtInput1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_AnUn_ArcProtInput1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN1_SenseFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN2_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN2_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN2_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN2_SenseFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN3_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN3_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN3_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN3_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_AnUn_ArcProtInput1_ARC_TGSN3_SenseFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SGChoiceB1_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SGChoiceB2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SGChoiceB3_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_LedTstStrt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_FloOn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_FloOff_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_LightOn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_BOBlocked_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_FloCmd_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_FloState_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_HealthDev_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 6 } },
+    { &iedModel_Application_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Application_LLN0_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_LedTstOut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_LocKey_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_LLN0_SwAuth_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwMod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_ActiveSG_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_FunInTest_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_AcqBlkAct_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SubstAct_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LLN0_ProtOnOff_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LLN0_ProtOnOff_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_FnctLO_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LLN0_FnctLO_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_LocSta_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LLN0_LocSta_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_LLN0_SwAuthEna1_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Application_LLN0_SwAuthEna1_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_Application_LLN0_SwAuthEna1_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthEna2_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Application_LLN0_SwAuthEna2_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_Application_LLN0_SwAuthEna2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthEna3_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Application_LLN0_SwAuthEna3_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_Application_LLN0_SwAuthEna3_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthEna4_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Application_LLN0_SwAuthEna4_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_Application_LLN0_SwAuthEna4_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthEna5_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Application_LLN0_SwAuthEna5_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_Application_LLN0_SwAuthEna5_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_LEDRs_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LLN0_ResCmpFmt_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LLN0_ResCmpFmt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_MltLev_setVal, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_Application_LLN0_MltLev_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_LLN0_EnaAuthID_setVal, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_Application_LLN0_EnaAuthID_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_AuthIDLev_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_Application_LLN0_AuthIDLev_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_NumAuthID_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_Application_LLN0_NumAuthID_minVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_Application_LLN0_NumAuthID_maxVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_Application_LLN0_NumAuthID_stepSize, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_Application_LLN0_NumAuthID_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_MltAuthID_setVal, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_Application_LLN0_MltAuthID_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthID1_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthID2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthID3_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthID4_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_SwAuthID5_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_ShowLckCnd_setVal, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_Application_LLN0_ShowLckCnd_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_EnTestMod_setVal, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_Application_LLN0_EnTestMod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_RelBoOnTst_setVal, IED_INIT_BOOLEAN, { .b = true } },
+    { &iedModel_Application_LLN0_RelBoOnTst_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LLN0_ResvTms_setVal, IED_INIT_INT32, { .i = 120 } },
+    { &iedModel_Application_LLN0_ResvTms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LLN0_ResvTms_maxVal, IED_INIT_INT32, { .i = 65535 } },
+    { &iedModel_Application_LLN0_ResvTms_stepSize, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_Application_LLN0_ResvTms_units_SIUnit, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_Application_LLN0_ResvTms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PhyNam_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_LPHD0_PhyNam_hwRev, IED_INIT_STRING, { .s = 7 } },
+    { &iedModel_Application_LPHD0_PhyNam_swRev, IED_INIT_STRING, { .s = 8 } },
+    { &iedModel_Application_LPHD0_PhyNam_model, IED_INIT_STRING, { .s = 9 } },
+    { &iedModel_Application_LPHD0_PhyNam_d, IED_INIT_STRING, { .s = 10 } },
+    { &iedModel_Application_LPHD0_Sim_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LPHD0_OpTmh_units_SIUnit, IED_INIT_INT32, { .i = 84 } },
+    { &iedModel_Application_LPHD0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_LPHD0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Application_LPHD0_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_LPHD0_GoStop_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_SvStop_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_LifeCon_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_BatFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_ClkFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_ErrMeasT_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_ErrComp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_ErrOffset_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_DigsiAct_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_SimuMode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_CommMode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_ErrMemory_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_AuxPwrFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_SeuHappened_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PSModFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PSModOK_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_OsopNotCon_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PSAuxPwrFail_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PSAuxPwrOK_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PSModFailSps_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PSAuxFailSps_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_Logon_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_CybSecEvt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_MsgLost_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_ChtBlk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_FlshDskHth_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LPHD0_PrcModIna_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_CALH0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_CALH0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_CALH0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_CALH0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Application_CALH0_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_CALH0_GrIndIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_CALH0_GrWrnIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_CALH0_GrAlmIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTIM0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTIM0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTIM0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_LTIM0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Application_LTIM0_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_LTIM0_TmOfsTmm_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTIM0_TmOfsTmm_minVal, IED_INIT_INT32, { .i = -720 } },
+    { &iedModel_Application_LTIM0_TmOfsTmm_maxVal, IED_INIT_INT32, { .i = 840 } },
+    { &iedModel_Application_LTIM0_TmOfsTmm_stepSize, IED_INIT_UINT32, { .u = 15 } },
+    { &iedModel_Application_LTIM0_TmOfsTmm_units_SIUnit, IED_INIT_INT32, { .i = 85 } },
+    { &iedModel_Application_LTIM0_TmUseDT_setVal, IED_INIT_BOOLEAN, { .b = true } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_occ, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_occType, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_occPer, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_weekDay, IED_INIT_INT32, { .i = 7 } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_month, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_day, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_hr, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_Application_LTIM0_TmChgDT_setCal_mn, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_occ, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_occType, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_occPer, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_weekDay, IED_INIT_INT32, { .i = 7 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_month, IED_INIT_INT32, { .i = 10 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_day, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_hr, IED_INIT_UINT32, { .u = 2 } },
+    { &iedModel_Application_LTIM0_TmChgST_setCal_mn, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Application_LTIM0_ClkSetMan_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_setMag_i, IED_INIT_INT32, { .i = 60 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_units_SIUnit, IED_INIT_INT32, { .i = 85 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_minVal_i, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_maxVal_i, IED_INIT_INT32, { .i = 120 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_stepSize_i, IED_INIT_INT32, { .i = 15 } },
+    { &iedModel_Application_LTIM0_TmOfsDT_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTIM0_DateFormat_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTIM0_DateFormat_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTMS0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTMS0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_LTMS0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Application_LTMS0_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_LTMS0_TmSynErr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_LeapSecond_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_Sync_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_setMag_i, IED_INIT_INT32, { .i = 600 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_units_SIUnit, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_minVal_i, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_maxVal_i, IED_INIT_INT32, { .i = 3600 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_stepSize_i, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTMS0_FltTmSyn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmSrc1Std_setVal, IED_INIT_INT32, { .i = 6 } },
+    { &iedModel_Application_LTMS0_TmSrc1Std_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmSrc1Port_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTMS0_TmSrc1Port_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmSrc1Ch_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTMS0_TmSrc1Ch_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmSrc2Std_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTMS0_TmSrc2Std_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmSrc2Port_setVal, IED_INIT_INT32, { .i = 6 } },
+    { &iedModel_Application_LTMS0_TmSrc2Port_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmSrc2Ch_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTMS0_TmSrc2Ch_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmZnTmSrc1_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTMS0_TmZnTmSrc1_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTMS0_TmZnTmSrc2_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTMS0_TmZnTmSrc2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_LTRK0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_LTRK0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_LTRK0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_LTRK0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Application_LTRK0_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_RSLEDGAPC0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_RSLEDGAPC0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_RSLEDGAPC0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_RSLEDGAPC0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Application_RSLEDGAPC0_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Application_RSLEDGAPC0_ResetIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_RSLEDGAPC0_LedTstOut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_RSLEDGAPC0_ResetCtl_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_RSLEDGAPC0_ResetCtl_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Application_USER1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Application_USER1_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER1_Lockout_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER2_NamPlt_configRev, IED_INIT_STRING, { .s = 13 } },
+    { &iedModel_Application_USER2_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER2_SF6Low_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_TCSFail_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_J03RelayFail_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_TestPlugIn_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_CBMtrMCBTrp_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_CntrlMCBTrp_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_J03RlyMCBTrp_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_ACCirMCBTrp_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_SlctrSwLocal_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_SlctrSwRmt_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_SpringChrgd_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_LockoutReset_pulseConfig_cmdQual, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_USER2_LockoutReset_pulseConfig_onDur, IED_INIT_UINT32, { .u = 200 } },
+    { &iedModel_Application_USER2_LockoutReset_pulseConfig_offDur, IED_INIT_UINT32, { .u = 10 } },
+    { &iedModel_Application_USER2_LockoutReset_pulseConfig_numPls, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_Application_USER2_LockoutReset_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER2_LockoutReset_sboTimeout, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_Application_USER2_LockoutReset_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Application_USER2_LockoutReset_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_Application_USER2_LockoutReset_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_LowArcActive_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_LclOpenCmd_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER2_LclCloseCmd_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER3_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER3_NamPlt_configRev, IED_INIT_STRING, { .s = 14 } },
+    { &iedModel_Application_USER3_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER3_GPS1GCB1Arc_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER4_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER4_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER4_NamPlt_configRev, IED_INIT_STRING, { .s = 15 } },
+    { &iedModel_Application_USER4_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER4_MCB0150BF_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER4_FCB0250BF_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER5_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER5_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER5_NamPlt_configRev, IED_INIT_STRING, { .s = 16 } },
+    { &iedModel_Application_USER5_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER5_FCB02Q0_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER5_BlockClose_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER6_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER6_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER6_NamPlt_configRev, IED_INIT_STRING, { .s = 17 } },
+    { &iedModel_Application_USER6_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER6_GPCIntrtrip_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER7_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER7_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER7_NamPlt_configRev, IED_INIT_STRING, { .s = 18 } },
+    { &iedModel_Application_USER7_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER7_EHHiTempA_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER8_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Application_USER8_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Application_USER8_NamPlt_configRev, IED_INIT_STRING, { .s = 6 } },
+    { &iedModel_Application_USER8_NamPlt_lnNs, IED_INIT_STRING, { .s = 12 } },
+    { &iedModel_Application_USER8_NtwrkHWErr_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_Application_USER8_NtwrkComErr_dataNs, IED_INIT_STRING, { .s = 11 } },
+    { &iedModel_BinIO_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_BinIO_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_BinIO_BinaryInputs_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_BinIO_BinaryInputs_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 19 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI1_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI2_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI2_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI2_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI2_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI2_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI3_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI3_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI3_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI3_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI3_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI4_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI4_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI4_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI4_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI4_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI4_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI5_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI5_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI5_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI5_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI5_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI5_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI6_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI6_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI6_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI6_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI6_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI6_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI7_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI7_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI7_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI7_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI7_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI7_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI8_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI8_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI8_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI8_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI8_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI8_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI9_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI9_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI9_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI9_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI9_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI9_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI10_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI10_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI10_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI10_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI10_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI10_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI11_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI11_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI11_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI11_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI11_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI11_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI12_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI12_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI12_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI12_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI12_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI12_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI13_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI13_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI13_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI13_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI13_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI13_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI14_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI14_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI14_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI14_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI14_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI14_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI15_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI15_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI15_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI15_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI15_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI15_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI16_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI16_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI16_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI16_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI16_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI16_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI17_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI17_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI17_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI17_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI17_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI17_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI18_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI18_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI18_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI18_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI18_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI18_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI19_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI19_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI19_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI19_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI19_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI19_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI20_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI20_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI20_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI20_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI20_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI20_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI21_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI21_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI21_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI21_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI21_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI21_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI22_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI22_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI22_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI22_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI22_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI22_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI23_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI23_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI23_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI23_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI23_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI23_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI24_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI24_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI24_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI24_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI24_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI24_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI25_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI25_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI25_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI25_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI25_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI25_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI26_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI26_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI26_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI26_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI26_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI26_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI27_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI27_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI27_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI27_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI27_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI27_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI28_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI28_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI28_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI28_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI28_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI28_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI29_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI29_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI29_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI29_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI29_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI29_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI30_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI30_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI30_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI30_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI30_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI30_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI31_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI31_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI31_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI31_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI31_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI31_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI32_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI32_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI32_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI32_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI32_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI32_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI33_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI33_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI33_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI33_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI33_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI33_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI34_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI34_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI34_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI34_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI34_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI34_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI35_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI35_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI35_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI35_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI35_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryInputs_LPDI35_In_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_BinIO_BinaryOutputs_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 19 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO1_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO2_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO2_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO2_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO2_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO2_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO3_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO3_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO3_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO3_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO3_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO4_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO4_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO4_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO4_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO4_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO4_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO5_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO5_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO5_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO5_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO5_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO5_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO6_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO6_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO6_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO6_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO6_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO6_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO7_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO7_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO7_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO7_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO7_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO7_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO8_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO8_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO8_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO8_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO8_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO8_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO9_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO9_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO9_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO9_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO9_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO9_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO10_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO10_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO10_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO10_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO10_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO10_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO11_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO11_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO11_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO11_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO11_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO11_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO12_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO12_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO12_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO12_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO12_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO12_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO13_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO13_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO13_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO13_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO13_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO13_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO14_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO14_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO14_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO14_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO14_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO14_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO15_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO15_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO15_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO15_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO15_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO15_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO16_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO16_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO16_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO16_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO16_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO16_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO17_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO17_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO17_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO17_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO17_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO17_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO18_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO18_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO18_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO18_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO18_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO18_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO19_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO19_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO19_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO19_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO19_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO19_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO20_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO20_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO20_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO20_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO20_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO20_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO21_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO21_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO21_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO21_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO21_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO21_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO22_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO22_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO22_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO22_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO22_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO22_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO23_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO23_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO23_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO23_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO23_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO23_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO24_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO24_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO24_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO24_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO24_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO24_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO25_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO25_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO25_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO25_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO25_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO25_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO26_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO26_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO26_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO26_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO26_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO26_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO27_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO27_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO27_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO27_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO27_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO27_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO28_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO28_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO28_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO28_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO28_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO28_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO29_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO29_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO29_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO29_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO29_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO29_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO30_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO30_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO30_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO30_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO30_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO30_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO31_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO31_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO31_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO31_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO31_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO31_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO32_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO32_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO32_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO32_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO32_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_BinIO_BinaryOutputs_LPDO32_OutSPS_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_CB1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_CB1_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_GAPC1_ARtgObj_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_CB1_GAPC1_ARtgObj_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_GAPC1_ARtgObj_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_GAPC1_ARtgObj_minVal_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_CB1_GAPC1_ARtgObj_maxVal_f, IED_INIT_FLOAT, { .f = 100000.0 } },
+    { &iedModel_CB1_GAPC1_ARtgObj_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_CB1_GAPC1_ARtgObj_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_GAPC1_VRtgObj_setMag_f, IED_INIT_FLOAT, { .f = 20.8 } },
+    { &iedModel_SE_CB1_GAPC1_VRtgObj_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_GAPC1_VRtgObj_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_GAPC1_VRtgObj_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_GAPC1_VRtgObj_minVal_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_CB1_GAPC1_VRtgObj_maxVal_f, IED_INIT_FLOAT, { .f = 1200.0 } },
+    { &iedModel_CB1_GAPC1_VRtgObj_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_CB1_GAPC1_VRtgObj_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_GAPC1_PoleOpenA_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_CB1_GAPC1_PoleOpenA_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_GAPC1_PoleOpenA_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_GAPC1_PoleOpenA_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_CB1_GAPC1_PoleOpenA_maxVal_f, IED_INIT_FLOAT, { .f = 2000.0 } },
+    { &iedModel_CB1_GAPC1_PoleOpenA_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_GAPC1_PoleOpenA_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_GAPC1_OpModeRBRF_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_GAPC1_OpModeRBRF_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_PTRC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_PTRC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_PTRC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_PTRC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_PTRC1_TrpBbpDiff_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_PTRC1_TrpBbpBFP_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_PTRC1_TrpBbpExt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_PTRC1_ResetTrip_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_PTRC1_ResetTrip_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_XCBR1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_XCBR1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_XCBR1_Pos_pulseConfig_cmdQual, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_Pos_pulseConfig_onDur, IED_INIT_UINT32, { .u = 100 } },
+    { &iedModel_CB1_XCBR1_Pos_pulseConfig_offDur, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_XCBR1_Pos_pulseConfig_numPls, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_CB1_XCBR1_Pos_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_BlkOpn_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_BlkCls_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_SumSwARs_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SumSwARs_pulsQty, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_CB1_XCBR1_SetOpCnt_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_SetOpCnt_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_SetOpCnt_maxVal, IED_INIT_INT32, { .i = 999999999 } },
+    { &iedModel_CB1_XCBR1_SetOpCnt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_mxVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_sboTimeout, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_SBOw_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_Oper_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumA_Cancel_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_mxVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_sboTimeout, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_SBOw_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_Oper_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumB_Cancel_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_mxVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_sboTimeout, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_SBOw_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_Oper_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetSwASumC_Cancel_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SetOpnHrs_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_SetOpnHrs_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_SetOpnHrs_maxVal, IED_INIT_INT32, { .i = 9999999 } },
+    { &iedModel_CB1_XCBR1_SetOpnHrs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SetOpHrs_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_SetOpHrs_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_XCBR1_SetOpHrs_maxVal, IED_INIT_INT32, { .i = 9999999 } },
+    { &iedModel_CB1_XCBR1_SetOpHrs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_AqBlk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_Rdy_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_RsSwStat_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_RsAqBlkSub_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_TripRelViaBi_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_OpCBToStr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_TripOpnCmd_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_ClsCmd_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_CmdActv_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_AlmSupp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_DefTr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SumSwARsA_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SumSwARsA_pulsQty, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_CB1_XCBR1_SumSwARsA_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SumSwARsB_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SumSwARsB_pulsQty, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_CB1_XCBR1_SumSwARsB_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SumSwARsC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SumSwARsC_pulsQty, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_CB1_XCBR1_SumSwARsC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SwAphsA_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwAphsA_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwAphsA_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SwAphsA_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SwAphsB_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwAphsB_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwAphsB_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SwAphsB_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SwAphsC_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwAphsC_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwAphsC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SwAphsC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SwANeut_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwANeut_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwANeut_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_XCBR1_SwANeut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SwVphsA_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwVphsA_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwVphsA_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_XCBR1_SwVphsA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_XCBR1_SwVphsA_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SwVphsB_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwVphsB_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwVphsB_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_XCBR1_SwVphsB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_XCBR1_SwVphsB_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_SwVphsC_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwVphsC_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_XCBR1_SwVphsC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_XCBR1_SwVphsC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_XCBR1_SwVphsC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_CBOpnHrs_units_SIUnit, IED_INIT_INT32, { .i = 84 } },
+    { &iedModel_CB1_XCBR1_CBOpnHrs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_OpHrs_units_SIUnit, IED_INIT_INT32, { .i = 84 } },
+    { &iedModel_CB1_XCBR1_OpHrs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_AnnBrkVal_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_XCBR1_AnnBrkVal_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_BbpBlockDO_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_XCBR1_NoTrpRelBi_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_GAPC2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_GAPC2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_GAPC2_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_GAPC2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_GAPC2_Input_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_GAPC2_Detected_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_GAPC2_ActionTmms_setVal, IED_INIT_INT32, { .i = 300 } },
+    { &iedModel_CB1_GAPC2_ActionTmms_minVal, IED_INIT_INT32, { .i = 10 } },
+    { &iedModel_CB1_GAPC2_ActionTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_CB1_GAPC2_ActionTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_GAPC2_ActionTmms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_GAPC2_CbOpDrpDel_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_GAPC2_CbOpDrpDel_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_GAPC2_CbOpDrpDel_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_CB1_GAPC2_CbOpDrpDel_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_GAPC2_CbOpDrpDel_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RSLEDGAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_RSLEDGAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RSLEDGAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_RSLEDGAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_RSLEDGAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_RSLEDGAPC1_ResetIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RSLEDGAPC1_LedTstOut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RSLEDGAPC1_ResetCtl_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_RSLEDGAPC1_ResetCtl_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_TSCB_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_TSCB_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_TSCB_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_TSCB_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_TSCB_GAPC1_ClsTmms_setVal, IED_INIT_INT32, { .i = 60 } },
+    { &iedModel_CB1_TSCB_GAPC1_ClsTmms_minVal, IED_INIT_INT32, { .i = 20 } },
+    { &iedModel_CB1_TSCB_GAPC1_ClsTmms_maxVal, IED_INIT_INT32, { .i = 150 } },
+    { &iedModel_CB1_TSCB_GAPC1_ClsTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_TSCB_GAPC1_ClsTmms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_TSCB_GAPC1_VAdpFact_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_CB1_TSCB_GAPC1_VAdpFact_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_TSCB_GAPC1_VAdpFact_minVal_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_CB1_TSCB_GAPC1_VAdpFact_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_CB1_TSCB_GAPC1_VAdpFact_stepSize_f, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_CB1_TSCB_GAPC1_VAdpFact_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_TSCB_GAPC1_AdpAngDeg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_SE_CB1_TSCB_GAPC1_AdpAngDeg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_TSCB_GAPC1_AdpAngDeg_units_SIUnit, IED_INIT_INT32, { .i = 9 } },
+    { &iedModel_CB1_TSCB_GAPC1_AdpAngDeg_minVal_f, IED_INIT_FLOAT, { .f = -179.0 } },
+    { &iedModel_CB1_TSCB_GAPC1_AdpAngDeg_maxVal_f, IED_INIT_FLOAT, { .f = 180.0 } },
+    { &iedModel_CB1_TSCB_GAPC1_AdpAngDeg_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_CB1_TSCB_GAPC1_AdpAngDeg_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_CSWI1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_CSWI1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_CSWI1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_CSWI1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_CSWI1_Pos_ctlModel, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_CB1_CSWI1_Pos_sboTimeout, IED_INIT_UINT32, { .u = 30000 } },
+    { &iedModel_CB1_CSWI1_Pos_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_CB1_CSWI1_LocSta_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_CSWI1_SwAuthChk_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_CSWI1_SwAuthChk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_NomEqActl_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_CSWI1_NomEqActl_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_DblActBlk_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_CSWI1_DblActBlk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_BlkByProt_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_CSWI1_BlkByProt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_OwnSwAuth_setVal, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_CB1_CSWI1_OwnSwAuth_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_EnaAuthID_setVal, IED_INIT_BOOLEAN, { .b = true } },
+    { &iedModel_CB1_CSWI1_EnaAuthID_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_AuthIDLev_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_CB1_CSWI1_AuthIDLev_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_NumAuthID_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_CB1_CSWI1_NumAuthID_minVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_CB1_CSWI1_NumAuthID_maxVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_CSWI1_NumAuthID_stepSize, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_CB1_CSWI1_NumAuthID_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_MltAuthID_setVal, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_CB1_CSWI1_MltAuthID_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthID1_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthID2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthID3_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthID4_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthID5_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuth_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwMod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna1_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna1_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna1_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna2_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna2_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna3_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna3_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna3_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna4_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna4_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna4_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna5_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna5_operTimeout, IED_INIT_UINT32, { .u = 1000 } },
+    { &iedModel_CB1_CSWI1_SwAuthEna5_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CILO1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_CILO1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_CILO1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_CILO1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_CILO1_EnaOpnFix_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CILO1_EnaClsFix_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CBT_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_CBT_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_CBT_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_CBT_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_CBT_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_CBT_GAPC1_StrTst3p_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_CBT_GAPC1_StrTst3p_operTimeout, IED_INIT_UINT32, { .u = 5300 } },
+    { &iedModel_CB1_CBT_GAPC1_StrTst3p_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CBT_GAPC1_TstExec_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CBT_GAPC1_TstTr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CBT_GAPC1_TstCls_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_CBT_GAPC1_TstCnc_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_BI1_ZAXN1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_BI1_ZAXN1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_BI1_ZAXN1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_BI1_ZAXN1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_BI1_ZAXN1_TripRelay_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_BI1_ZAXN1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_BI1_ZAXN1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_BI1_ZAXN1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_BI1_ZAXN1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_BI1_ZAXN1_AlmDlTmms_setVal, IED_INIT_INT32, { .i = 2000 } },
+    { &iedModel_CB1_BI1_ZAXN1_AlmDlTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_CB1_BI1_ZAXN1_AlmDlTmms_maxVal, IED_INIT_INT32, { .i = 600000 } },
+    { &iedModel_CB1_BI1_ZAXN1_AlmDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_BI1_ZAXN1_AlmDlTmms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_BI1_ZAXN1_CfgErr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_RBRF1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_RBRF1_NamPlt_configRev, IED_INIT_STRING, { .s = 20 } },
+    { &iedModel_CB1_RBRF1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_RBRF1_TPTrTmms_setVal, IED_INIT_INT32, { .i = 50 } },
+    { &iedModel_CB1_RBRF1_TPTrTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_TPTrTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_CB1_RBRF1_TPTrTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_RBRF1_ThreshEF_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_Initiation_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_BFRelease_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_CBFaulty_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_Initdef3p_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_RelCBdef3p_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_OpCBdef3p_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_BFInitNR_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_AuxCritNR_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_ImmOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_CBFailPole_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_DlyByInvMV_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_RBRF1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_StrValPh_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_CB1_RBRF1_StrValPh_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrValPh_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_RBRF1_StrValPh_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_CB1_RBRF1_StrValPh_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_CB1_RBRF1_StrValPh_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrValPh_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_StrValEF_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_CB1_RBRF1_StrValEF_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrValEF_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_RBRF1_StrValEF_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_CB1_RBRF1_StrValEF_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_CB1_RBRF1_StrValEF_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrValEF_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_CBAuxCrit_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_CBAuxCrit_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_DropOut_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_DropOut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_StrHldIn_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_RBRF1_StrHldIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_StrHldExt_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_StrHldExt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_BIStart_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_BIStart_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_ReTripMod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_ReTripMod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_TPFailTmms_setVal, IED_INIT_INT32, { .i = 130 } },
+    { &iedModel_CB1_RBRF1_TPFailTmms_minVal, IED_INIT_INT32, { .i = -1 } },
+    { &iedModel_CB1_RBRF1_TPFailTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_CB1_RBRF1_TPFailTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_RBRF1_TPFailTmms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_SupTimeRel_setVal, IED_INIT_INT32, { .i = 60 } },
+    { &iedModel_CB1_RBRF1_SupTimeRel_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_SupTimeRel_maxVal, IED_INIT_INT32, { .i = 1000 } },
+    { &iedModel_CB1_RBRF1_SupTimeRel_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_RBRF1_SupTimeRel_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_PCheck3I0_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_RBRF1_PCheck3I0_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_PCheck3I2_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_RBRF1_PCheck3I2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_StrVal3I0_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_CB1_RBRF1_StrVal3I0_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I0_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_RBRF1_StrVal3I0_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I0_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I0_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I0_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_StrVal3I2_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_CB1_RBRF1_StrVal3I2_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I2_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_RBRF1_StrVal3I2_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I2_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I2_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_RBRF1_StrVal3I2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_BIMoniSt_setVal, IED_INIT_INT32, { .i = 15000 } },
+    { &iedModel_CB1_RBRF1_BIMoniSt_minVal, IED_INIT_INT32, { .i = 50 } },
+    { &iedModel_CB1_RBRF1_BIMoniSt_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_CB1_RBRF1_BIMoniSt_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_RBRF1_BIMoniSt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_BIMoniRel_setVal, IED_INIT_INT32, { .i = 15000 } },
+    { &iedModel_CB1_RBRF1_BIMoniRel_minVal, IED_INIT_INT32, { .i = 50 } },
+    { &iedModel_CB1_RBRF1_BIMoniRel_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_CB1_RBRF1_BIMoniRel_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_CB1_RBRF1_BIMoniRel_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_IntActDBBP_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_RBRF1_IntActDBBP_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_ImmedDrop_setVal, IED_INIT_BOOLEAN, { .b = true } },
+    { &iedModel_CB1_RBRF1_ImmedDrop_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_RBRF1_LatchedBI_setVal, IED_INIT_BOOLEAN, { .b = true } },
+    { &iedModel_CB1_RBRF1_LatchedBI_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_Fundamental_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_Fundamental_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_Fundamental_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_CB1_Fundamental_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_Fundamental_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_Fundamental_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 21 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_db, IED_INIT_UINT32, { .u = 20000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_db, IED_INIT_UINT32, { .u = 100000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_ClcMth_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_ClcMth_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Ds1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Ds1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Ds1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Ds1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Ds1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_Ds1_XSWI1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Ds1_XSWI1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds1_XSWI1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Ds1_XSWI1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Ds1_XSWI1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Ds1_XSWI1_Pos_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds1_XSWI1_BlkOpn_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds1_XSWI1_BlkCls_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds1_XSWI1_AqBlk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Ds2_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Ds2_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Ds2_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Ds2_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Ds2_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds2_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_Ds2_XSWI1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Ds2_XSWI1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds2_XSWI1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Ds2_XSWI1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Ds2_XSWI1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Ds2_XSWI1_Pos_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds2_XSWI1_BlkOpn_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds2_XSWI1_BlkCls_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Ds2_XSWI1_AqBlk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Mod1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Mod1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Mod1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_Mod1_Channel1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod1_Channel1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Mod1_Channel1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Mod1_Channel1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod1_Channel1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod1_Channel1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 22 } },
+    { &iedModel_Mod2_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod2_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Mod2_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Mod2_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod2_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod2_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_Mod2_Channel1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod2_Channel1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Mod2_Channel1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Mod2_Channel1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod2_Channel1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod2_Channel1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 23 } },
+    { &iedModel_Mod2_Channel1_PRP_LCCH1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod2_Channel1_PRP_LCCH1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod2_Channel1_PRP_LCCH1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod2_Channel1_PRP_LCCH1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Mod2_Channel1_PRP_LCCH1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Mod2_Channel1_LCCH1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod2_Channel1_LCCH1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod2_Channel1_LCCH1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod2_Channel1_LCCH1_NamPlt_configRev, IED_INIT_STRING, { .s = 24 } },
+    { &iedModel_Mod2_Channel1_LCCH1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Mod2_Channel1_LCCH2_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod2_Channel1_LCCH2_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod2_Channel1_LCCH2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod2_Channel1_LCCH2_NamPlt_configRev, IED_INIT_STRING, { .s = 25 } },
+    { &iedModel_Mod2_Channel1_LCCH2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Mod3_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod3_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Mod3_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Mod3_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod3_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod3_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_Mod3_Channel1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod3_Channel1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Mod3_Channel1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Mod3_Channel1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod3_Channel1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod3_Channel1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 26 } },
+    { &iedModel_Mod3_Channel1_LCCH1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod3_Channel1_LCCH1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod3_Channel1_LCCH1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod3_Channel1_LCCH1_NamPlt_configRev, IED_INIT_STRING, { .s = 27 } },
+    { &iedModel_Mod3_Channel1_LCCH1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Mod3_Channel1_HSR_LCCH1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Mod3_Channel1_HSR_LCCH1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Mod3_Channel1_HSR_LCCH1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Mod3_Channel1_HSR_LCCH1_NamPlt_configRev, IED_INIT_STRING, { .s = 28 } },
+    { &iedModel_Mod3_Channel1_HSR_LCCH1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_PowS_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_PowS_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_PowS_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_PowS_GAPC1_PhaseRev_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_GAPC1_InvPhases_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_GAPC1_PhsSeq_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_GAPC1_PhsSeq_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_GAPC1_PhRevABC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_GAPC1_PhRevACB_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_GAPC1_FOutOfRg_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_PowS_MeasPointI3ph1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 29 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtrlIn_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtrlIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_DisSet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_DisReset_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvPhABCur_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvPhBCCur_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvPhACCur_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_StateBi_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_StateCmd_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvertedPh_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvertedPh_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTConnect_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTConnect_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTSPInDir_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTSPInDir_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtInvPol_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtInvPol_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSec_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSec_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRange_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRange_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AInternTyp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AInternTyp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSecIN_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSecIN_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN2_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN2_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN2_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_minVal_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_setMag_f, IED_INIT_FLOAT, { .f = 5.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_units_multiplier, IED_INIT_INT32, { .i = -2 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_minVal_f, IED_INIT_FLOAT, { .f = 0.5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_maxVal_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_setMag_f, IED_INIT_FLOAT, { .f = 15.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_units_multiplier, IED_INIT_INT32, { .i = -2 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_minVal_f, IED_INIT_FLOAT, { .f = 0.5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_maxVal_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_maxVal, IED_INIT_INT32, { .i = 100 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_stepSize, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Tracking_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Tracking_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisActTr_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisActTr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_setMag_f, IED_INIT_FLOAT, { .f = 20.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_maxVal_f, IED_INIT_FLOAT, { .f = 2000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_NamPlt_lnNs, IED_INIT_STRING, { .s = 30 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR1_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_minVal_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_maxVal_f, IED_INIT_FLOAT, { .f = 100000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR1_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR1_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR1_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_AmpSv_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_AmpSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_AmpSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Trp_setVal, IED_INIT_INT32, { .i = 10 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_setVal, IED_INIT_INT32, { .i = 210 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_minVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_maxVal, IED_INIT_INT32, { .i = 2147483647 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR1_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_NamPlt_lnNs, IED_INIT_STRING, { .s = 30 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR2_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_minVal_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_maxVal_f, IED_INIT_FLOAT, { .f = 100000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR2_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR2_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR2_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_AmpSv_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_AmpSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_AmpSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Trp_setVal, IED_INIT_INT32, { .i = 10 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_setVal, IED_INIT_INT32, { .i = 210 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_minVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_maxVal, IED_INIT_INT32, { .i = 2147483647 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR2_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_NamPlt_lnNs, IED_INIT_STRING, { .s = 30 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR3_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_minVal_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_maxVal_f, IED_INIT_FLOAT, { .f = 100000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR3_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR3_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR3_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_AmpSv_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_AmpSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_AmpSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Trp_setVal, IED_INIT_INT32, { .i = 10 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_setVal, IED_INIT_INT32, { .i = 210 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_minVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_maxVal, IED_INIT_INT32, { .i = 2147483647 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR3_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_NamPlt_lnNs, IED_INIT_STRING, { .s = 30 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR4_ARtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_minVal_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_maxVal_f, IED_INIT_FLOAT, { .f = 100000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR4_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR4_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR4_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_AmpSv_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_AmpSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_AmpSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Trp_setVal, IED_INIT_INT32, { .i = 10 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_setVal, IED_INIT_INT32, { .i = 210 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_minVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_maxVal, IED_INIT_INT32, { .i = 2147483647 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TCTR4_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_ResetBW_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhABWsus_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhBBWsus_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhCBWsus_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhABW_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhBBW_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhCBW_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BWsus_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BrokenWire_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BlkMod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BlkMod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_minVal_f, IED_INIT_FLOAT, { .f = 0.004 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_maxVal_f, IED_INIT_FLOAT, { .f = 5.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_stepSize_f, IED_INIT_FLOAT, { .f = 0.001 } },
+    { &iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_setMag_f, IED_INIT_FLOAT, { .f = 0.5 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_minVal_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_maxVal_f, IED_INIT_FLOAT, { .f = 0.95 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_setMag_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_maxVal_f, IED_INIT_FLOAT, { .f = 2000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_setMag_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_maxVal_f, IED_INIT_FLOAT, { .f = 0.95 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_setMag_f, IED_INIT_FLOAT, { .f = 20.0 } },
+    { &iedModel_SE_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_maxVal_f, IED_INIT_FLOAT, { .f = 2000.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_PowS_MeasPointV3ph1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VTConnect_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VTConnect_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvertedPh_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvertedPh_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_setMag_f, IED_INIT_FLOAT, { .f = 110.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_minVal_f, IED_INIT_FLOAT, { .f = 80.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_maxVal_f, IED_INIT_FLOAT, { .f = 230.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_stepSize_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_setMag_f, IED_INIT_FLOAT, { .f = 1.73 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_minVal_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_maxVal_f, IED_INIT_FLOAT, { .f = 9.99 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_maxVal, IED_INIT_INT32, { .i = 100 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_stepSize, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Tracking_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Tracking_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvPhABVol_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvPhBCVol_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvPhACVol_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_NamPlt_lnNs, IED_INIT_STRING, { .s = 32 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VolSv_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VolSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VolSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 20.8 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR1_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_minVal_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_maxVal_f, IED_INIT_FLOAT, { .f = 1200.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR1_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_setMag_f, IED_INIT_FLOAT, { .f = 189.09091 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR1_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR1_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_setMag_f, IED_INIT_FLOAT, { .f = 1.8181819 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR1_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_NamPlt_lnNs, IED_INIT_STRING, { .s = 32 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VolSv_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VolSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VolSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 20.8 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR2_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_minVal_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_maxVal_f, IED_INIT_FLOAT, { .f = 1200.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR2_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_setMag_f, IED_INIT_FLOAT, { .f = 189.09091 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR2_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR2_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_setMag_f, IED_INIT_FLOAT, { .f = 1.8181819 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR2_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_NamPlt_lnNs, IED_INIT_STRING, { .s = 32 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VolSv_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VolSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VolSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 20.8 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR3_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_minVal_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_maxVal_f, IED_INIT_FLOAT, { .f = 1200.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR3_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_setMag_f, IED_INIT_FLOAT, { .f = 189.09091 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR3_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR3_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_setMag_f, IED_INIT_FLOAT, { .f = 1.8181819 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR3_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_NamPlt_lnNs, IED_INIT_STRING, { .s = 32 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VolSv_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VolSv_sVC_scaleFactor, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VolSv_sVC_offset, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 20.8 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR4_VRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_minVal_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_maxVal_f, IED_INIT_FLOAT, { .f = 1200.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 50.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR4_HzRtg_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_minVal_f, IED_INIT_FLOAT, { .f = 16.67 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_maxVal_f, IED_INIT_FLOAT, { .f = 60.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_setMag_f, IED_INIT_FLOAT, { .f = 109.3011 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR4_Rat_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_maxVal_f, IED_INIT_FLOAT, { .f = 10000.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_stepSize_f, IED_INIT_FLOAT, { .f = 0.1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR4_Cor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_minVal_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_maxVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_stepSize_f, IED_INIT_FLOAT, { .f = 1.0E-5 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_setMag_f, IED_INIT_FLOAT, { .f = 1.8181819 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_TVTR4_Clip_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_maxVal_f, IED_INIT_FLOAT, { .f = 100.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_AccMeas_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_AccPro_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_minVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_maxVal, IED_INIT_INT32, { .i = 90000 } },
+    { &iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_setMag_f, IED_INIT_FLOAT, { .f = 10.400001 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_minVal_f, IED_INIT_FLOAT, { .f = 0.056727275 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_maxVal_f, IED_INIT_FLOAT, { .f = 35.36 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_setMag_f, IED_INIT_FLOAT, { .f = 0.75 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_minVal_f, IED_INIT_FLOAT, { .f = 0.58 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_maxVal_f, IED_INIT_FLOAT, { .f = 0.95 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_Failure_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 5.2000003 } },
+    { &iedModel_SE_PowS_MeasPointV3ph1_U_SSUM1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 0.056727275 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 35.36 } },
+    { &iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_NamPlt_configRev, IED_INIT_STRING, { .s = 31 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_VTmcb_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_maxVal, IED_INIT_INT32, { .i = 30 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Rec_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Rec_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Rec_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_Rec_RCDG_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_RCDG_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_RCDG_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Rec_RCDG_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Rec_RCDG_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Rec_RCDG_GAPC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_RCDG_GAPC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_RCDG_GAPC1_CtdValType_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_RCDG_GAPC1_CtdValType_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_RCDG_GAPC1_CRevYear_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_RCDG_GAPC1_CRevYear_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_GFLG_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_GFLG_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_GFLG_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Rec_GFLG_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Rec_GFLG_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Rec_GFLG_GAPC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_GFLG_GAPC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_GFLG_GAPC1_GflNum_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_GFLG_GAPC1_GflFull_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Rec_FaultRecorder_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Rec_FaultRecorder_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_Rec_FaultRecorder_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_FaultRecorder_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_FaultRecorder_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 33 } },
+    { &iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_FaultRecorder_RCDR_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Rec_FaultRecorder_RCDR_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Rec_FaultRecorder_RCDR_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdTrg_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MemRs_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MemRs_operTimeout, IED_INIT_UINT32, { .u = 30000 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MemClr_ctlModel, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MemClr_operTimeout, IED_INIT_UINT32, { .u = 30000 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_setVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_minVal, IED_INIT_INT32, { .i = 50 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_maxVal, IED_INIT_INT32, { .i = 16000 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_setVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_minVal, IED_INIT_INT32, { .i = 50 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_maxVal, IED_INIT_INT32, { .i = 16000 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_StrExt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTrg_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStart_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStart_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStore_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStore_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_setVal, IED_INIT_INT32, { .i = 5000 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_minVal, IED_INIT_INT32, { .i = 200 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_maxVal, IED_INIT_INT32, { .i = 80000 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_setVal, IED_INIT_INT32, { .i = 500 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_minVal, IED_INIT_INT32, { .i = 200 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_maxVal, IED_INIT_INT32, { .i = 80000 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_SmpRate_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_SmpRate_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcINChl_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcINChl_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcVNChl_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcVNChl_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_Rec_FaultRecorder_DEF_RDRE1_FltLogFull_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_ARtgObj_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_VI3p1_VI3P_GAPC1_ARtgObj_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_ARtgObj_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_ARtgObj_minVal_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_ARtgObj_maxVal_f, IED_INIT_FLOAT, { .f = 100000.0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_ARtgObj_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_ARtgObj_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VRtgObj_setMag_f, IED_INIT_FLOAT, { .f = 20.8 } },
+    { &iedModel_SE_VI3p1_VI3P_GAPC1_VRtgObj_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VRtgObj_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VRtgObj_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VRtgObj_minVal_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VRtgObj_maxVal_f, IED_INIT_FLOAT, { .f = 1200.0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VRtgObj_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VRtgObj_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VARtgObj_setMag_f, IED_INIT_FLOAT, { .f = 7.205331 } },
+    { &iedModel_SE_VI3p1_VI3P_GAPC1_VARtgObj_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VARtgObj_units_SIUnit, IED_INIT_INT32, { .i = 61 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VARtgObj_units_multiplier, IED_INIT_INT32, { .i = 6 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_VARtgObj_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_SysNeutPt_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_SysNeutPt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_PQSign_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_VI3P_GAPC1_PQSign_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PTRC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_PTRC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_PTRC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_PTRC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_CF_SBWI1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_CF_SBWI1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_CF_SBWI1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_CF_SBWI1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_CF_SBWI1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_ResetIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_LedTstOut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_ResetCtl_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_RSLEDGAPC1_ResetCtl_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_PHAR1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_PHAR1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_PHAR1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_PHAR1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_Irs2HaDetA_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_Irs2HaDetB_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_Irs2HaDetC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_IrsCWADet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_IrsCrsBlk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_PHAR1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_CrossBlk_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_PHAR1_CrossBlk_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_StrVal2Ha_setMag_f, IED_INIT_FLOAT, { .f = 20.0 } },
+    { &iedModel_SE_VI3p1_PHAR1_StrVal2Ha_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_PHAR1_StrVal2Ha_units_multiplier, IED_INIT_INT32, { .i = -2 } },
+    { &iedModel_VI3p1_PHAR1_StrVal2Ha_minVal_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_VI3p1_PHAR1_StrVal2Ha_maxVal_f, IED_INIT_FLOAT, { .f = 45.0 } },
+    { &iedModel_VI3p1_PHAR1_StrVal2Ha_stepSize_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_VI3p1_PHAR1_StrVal2Ha_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_StrValAMax_setMag_f, IED_INIT_FLOAT, { .f = 1500.0 } },
+    { &iedModel_SE_VI3p1_PHAR1_StrValAMax_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_PHAR1_StrValAMax_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_PHAR1_StrValAMax_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_PHAR1_StrValAMax_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_PHAR1_StrValAMax_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_PHAR1_StrValAMax_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_BlkIrshCWA_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_PHAR1_BlkIrshCWA_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_BlkIrsh2Ha_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_PHAR1_BlkIrsh2Ha_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_CrossBlkTm_setVal, IED_INIT_INT32, { .i = 60 } },
+    { &iedModel_VI3p1_PHAR1_CrossBlkTm_minVal, IED_INIT_INT32, { .i = 30 } },
+    { &iedModel_VI3p1_PHAR1_CrossBlkTm_maxVal, IED_INIT_INT32, { .i = 200000 } },
+    { &iedModel_VI3p1_PHAR1_CrossBlkTm_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_PHAR1_CrossBlkTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_PHAR1_TrFltRec_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_PHAR1_TrFltRec_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_OCGIGAPC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_OCGIGAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_OCGIGAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_OCGIGAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_5051NOCgndB1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_5051NOCgndB1_PTRC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_PTRC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_PTRC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_PTRC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_SE_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 1.9999999 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 1000 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_SecHGndDet_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_SecHGndDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 38.0 } },
+    { &iedModel_SE_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 1.9999999 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_setVal, IED_INIT_INT32, { .i = 600 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_SecHGndDet_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_SecHGndDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmACrv_setCharact, IED_INIT_INT32, { .i = 9 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 1200.0 } },
+    { &iedModel_SE_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 1.9999999 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_minVal_f, IED_INIT_FLOAT, { .f = 0.05 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_maxVal_f, IED_INIT_FLOAT, { .f = 15.0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TypRsCrv_setVal, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_DskRng_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_SecHGndDet_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_SecHGndDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_5051OC3phase1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_5051OC3phase1_PTRC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_PTRC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_PTRC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_PTRC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 300.0 } },
+    { &iedModel_SE_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 1200 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 500.0 } },
+    { &iedModel_SE_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_setVal, IED_INIT_INT32, { .i = 600 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 100000 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_ID_PTOC2_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmACrv_setCharact, IED_INIT_INT32, { .i = 9 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 126.0 } },
+    { &iedModel_SE_VI3p1_5051OC3phase1_II_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 0.28 } },
+    { &iedModel_SE_VI3p1_5051OC3phase1_II_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_minVal_f, IED_INIT_FLOAT, { .f = 0.05 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_maxVal_f, IED_INIT_FLOAT, { .f = 15.0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_TypRsCrv_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_DskRng_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_5051OC3phase1_II_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 36 } },
+    { &iedModel_VI3p1_ArcProtection1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_ArcProtection1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 36 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 400.0 } },
+    { &iedModel_SE_VI3p1_ArcProtection1_GAPC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_setMag_f, IED_INIT_FLOAT, { .f = 200.0 } },
+    { &iedModel_SE_VI3p1_ArcProtection1_GAPC1_StrVal1ph_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_BlkFct_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_ArcCurDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_SensSup_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_GAPC1_SensSup_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_PTRC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_PTRC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_PTRC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_PTRC1_NamPlt_configRev, IED_INIT_STRING, { .s = 36 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_NamPlt_configRev, IED_INIT_STRING, { .s = 36 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_FACntRs_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_FACntRs_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_FACntRs_maxVal, IED_INIT_INT32, { .i = 9999 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_ExtInArc_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_ExtCurrent_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_Str_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_Op_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_ArcLigDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_OpMode_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_OpMode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_UseExtArc_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_UseExtArc_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_SensType_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_SensType_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = -20.0 } },
+    { &iedModel_SE_VI3p1_ArcProtection1_SARC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 79 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = -34.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = -10.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC1_StrVal_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_NamPlt_configRev, IED_INIT_STRING, { .s = 36 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_FACntRs_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_FACntRs_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_FACntRs_maxVal, IED_INIT_INT32, { .i = 9999 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_ExtInArc_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_ExtCurrent_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_Str_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_Op_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_ArcLigDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_OpMode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_OpMode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_UseExtArc_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_UseExtArc_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_SensType_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_SensType_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = -20.0 } },
+    { &iedModel_SE_VI3p1_ArcProtection1_SARC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 79 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_StrVal_minVal_f, IED_INIT_FLOAT, { .f = -34.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = -10.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC2_StrVal_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_NamPlt_configRev, IED_INIT_STRING, { .s = 36 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_FACntRs_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_FACntRs_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_FACntRs_maxVal, IED_INIT_INT32, { .i = 9999 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_ExtInArc_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_ExtCurrent_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_Str_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_Op_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_ArcLigDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_OpMode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_OpMode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_UseExtArc_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_UseExtArc_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_SensType_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_SensType_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_StrVal_setMag_f, IED_INIT_FLOAT, { .f = -20.0 } },
+    { &iedModel_SE_VI3p1_ArcProtection1_SARC3_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 79 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_StrVal_minVal_f, IED_INIT_FLOAT, { .f = -34.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = -10.0 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_ArcProtection1_SARC3_StrVal_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_Energy_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_Energy_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_Energy_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_Energy_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_Energy_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_units_SIUnit, IED_INIT_INT32, { .i = 72 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_units_multiplier, IED_INIT_INT32, { .i = 6 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_pulsQty, IED_INIT_FLOAT, { .f = 1.2008885E-4 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_frEna, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_frPd, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_frRs, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_units_SIUnit, IED_INIT_INT32, { .i = 73 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_units_multiplier, IED_INIT_INT32, { .i = 6 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_pulsQty, IED_INIT_FLOAT, { .f = 1.2008885E-4 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_frEna, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_frPd, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_frRs, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_units_SIUnit, IED_INIT_INT32, { .i = 72 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_units_multiplier, IED_INIT_INT32, { .i = 6 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_pulsQty, IED_INIT_FLOAT, { .f = 1.2008885E-4 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_frEna, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_frPd, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_frRs, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_units_SIUnit, IED_INIT_INT32, { .i = 73 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_units_multiplier, IED_INIT_INT32, { .i = 6 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_pulsQty, IED_INIT_FLOAT, { .f = 1.2008885E-4 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_frEna, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_frPd, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_frRs, IED_INIT_BOOLEAN, { .b = false } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_mxVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_sboTimeout, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_SBOw_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_Oper_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_Cancel_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_mxVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_sboTimeout, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_SBOw_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_Oper_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_Cancel_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_mxVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_sboTimeout, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_SBOw_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_Oper_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_Cancel_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_mxVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_sboTimeout, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_sboClass, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_minVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_SBOw_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_Oper_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_Cancel_ctlVal_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_FundSymComp_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_FundSymComp_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_FundSymComp_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_FundSymComp_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_FundSymComp_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_db, IED_INIT_UINT32, { .u = 20000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_db, IED_INIT_UINT32, { .u = 100000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_ClcMth_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_ClcMth_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ClcMth_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ClcMth_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_instCVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_cVal_ang_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_dbAng, IED_INIT_UINT32, { .u = 333 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_ClcMth_setVal, IED_INIT_INT32, { .i = 4 } },
+    { &iedModel_VI3p1_FundSymComp_XPRE_MSQI1_ClcMth_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_OperationalValues_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_OperationalValues_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_OperationalValues_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_OperationalValues_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_OperationalValues_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_OperationalValues_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_db, IED_INIT_UINT32, { .u = 20000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_db, IED_INIT_UINT32, { .u = 100000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_ClcMth_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_ClcMth_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_units_SIUnit, IED_INIT_INT32, { .i = 29 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_db, IED_INIT_UINT32, { .u = 2000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ClcMth_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ClcMth_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_units_SIUnit, IED_INIT_INT32, { .i = 38 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_units_SIUnit, IED_INIT_INT32, { .i = 63 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_units_SIUnit, IED_INIT_INT32, { .i = 61 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_units_SIUnit, IED_INIT_INT32, { .i = 65 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_units_SIUnit, IED_INIT_INT32, { .i = 33 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_db, IED_INIT_UINT32, { .u = 100 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_units_SIUnit, IED_INIT_INT32, { .i = 38 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_units_SIUnit, IED_INIT_INT32, { .i = 38 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_units_SIUnit, IED_INIT_INT32, { .i = 38 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_units_SIUnit, IED_INIT_INT32, { .i = 63 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_units_SIUnit, IED_INIT_INT32, { .i = 63 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_units_SIUnit, IED_INIT_INT32, { .i = 63 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_units_SIUnit, IED_INIT_INT32, { .i = 61 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_units_SIUnit, IED_INIT_INT32, { .i = 61 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_instCVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_cVal_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_units_SIUnit, IED_INIT_INT32, { .i = 61 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_units_multiplier, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_db, IED_INIT_UINT32, { .u = 10000 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_ClcMth_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_VI3p1_OperationalValues_PPRE_MMXU1_ClcMth_dataNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_ProcessMonitor_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ProcessMonitor_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_ProcessMonitor_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_ProcessMonitor_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ProcessMonitor_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ProcessMonitor_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_NamPlt_configRev, IED_INIT_STRING, { .s = 1 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_NamPlt_lnNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_DisCntrOpn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_SwitchOn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ExternalTrip1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ExternalTrip1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ExternalTrip1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ExternalTrip1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 37 } },
+    { &iedModel_VI3p1_ExternalTrip1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_ExternalTrip1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_NamPlt_configRev, IED_INIT_STRING, { .s = 37 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Str_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_ExtIn_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67DirOC3phB1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_67DirOC3phB1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_DirDeterm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_DirTstRslt_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_setVal, IED_INIT_INT32, { .i = 45 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_minVal, IED_INIT_INT32, { .i = -180 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_maxVal, IED_INIT_INT32, { .i = 180 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_stepSize, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_units_SIUnit, IED_INIT_INT32, { .i = 9 } },
+    { &iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_PTRC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_PTRC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_PTRC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_PTRC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 300.0 } },
+    { &iedModel_SE_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 210 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_DirMod_setVal, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkVMeasLs_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkVMeasLs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 400.0 } },
+    { &iedModel_SE_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_setVal, IED_INIT_INT32, { .i = 100 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_DirMod_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkVMeasLs_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkVMeasLs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmACrv_setCharact, IED_INIT_INT32, { .i = 9 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 126.0 } },
+    { &iedModel_SE_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 0.2 } },
+    { &iedModel_SE_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_minVal_f, IED_INIT_FLOAT, { .f = 0.05 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_maxVal_f, IED_INIT_FLOAT, { .f = 15.0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TypRsCrv_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_DirMod_setVal, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_DskRng_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkVMeasLs_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkVMeasLs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_InrushDet_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_InrushDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 35 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_Direction_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_minVal, IED_INIT_INT32, { .i = -180 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_maxVal, IED_INIT_INT32, { .i = 180 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_stepSize, IED_INIT_UINT32, { .u = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_units_SIUnit, IED_INIT_INT32, { .i = 9 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_instMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_mag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_db, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_GAPC1_DirDeterm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_PTRC1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_PTRC1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_PTRC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_PTRC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 10.0 } },
+    { &iedModel_SE_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_setVal, IED_INIT_INT32, { .i = 1000 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_DirMod_setVal, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkStg_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkVMeasLs_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkVMeasLs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_InrBlkOp_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_InrBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_SecHGndDet_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_SecHGndDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 26.0 } },
+    { &iedModel_SE_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_setVal, IED_INIT_INT32, { .i = 200 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_minVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_maxVal, IED_INIT_INT32, { .i = 60000 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_stepSize, IED_INIT_UINT32, { .u = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_DirMod_setVal, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkStg_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Mode_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkVMeasLs_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkVMeasLs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_InrBlkOp_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_InrBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_SecHGndDet_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_SecHGndDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_NamPlt_configRev, IED_INIT_STRING, { .s = 34 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmACrv_setCharact, IED_INIT_INT32, { .i = 9 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 240.00002 } },
+    { &iedModel_SE_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_units_SIUnit, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_minVal_f, IED_INIT_FLOAT, { .f = 6.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_maxVal_f, IED_INIT_FLOAT, { .f = 7000.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_stepSize_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 1.0 } },
+    { &iedModel_SE_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_setMag_f, IED_INIT_FLOAT, { .f = 0.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_minVal_f, IED_INIT_FLOAT, { .f = 0.05 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_maxVal_f, IED_INIT_FLOAT, { .f = 15.0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_stepSize_f, IED_INIT_FLOAT, { .f = 0.01 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TypRsCrv_setVal, IED_INIT_INT32, { .i = 3 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_DirMod_setVal, IED_INIT_INT32, { .i = 2 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkStg_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkOpDlTm_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Inactive_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_InrshBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_DskRng_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_OpTmExp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Mode_setVal, IED_INIT_INT32, { .i = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Mode_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkVMeasLs_setVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkVMeasLs_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_InrBlkOp_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_InrBlkOp_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_SecHGndDet_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_SecHGndDet_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_MeasMethod_setVal, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_MeasMethod_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_ComSupervision_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_ComSupervision_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_ComSupervision_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_ComSupervision_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 38 } },
+    { &iedModel_ComSupervision_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_ComSupervision_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 3 } },
+    { &iedModel_ComSupervision_GOOSE_LLN0_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_ComSupervision_GOOSE_LLN0_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_ComSupervision_GOOSE_LLN0_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_ComSupervision_GOOSE_LLN0_NamPlt_configRev, IED_INIT_STRING, { .s = 38 } },
+    { &iedModel_ComSupervision_GOOSE_LLN0_NamPlt_ldNs, IED_INIT_STRING, { .s = 2 } },
+    { &iedModel_ComSupervision_GOOSE_LLN0_GrRef_setSrcRef, IED_INIT_STRING, { .s = 39 } },
+    { &iedModel_ComSupervision_GOOSE_CALH1_Mod_stVal, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_ComSupervision_GOOSE_CALH1_Mod_ctlModel, IED_INIT_INT32, { .i = 0 } },
+    { &iedModel_ComSupervision_GOOSE_CALH1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_ComSupervision_GOOSE_CALH1_NamPlt_configRev, IED_INIT_STRING, { .s = 38 } },
+    { &iedModel_ComSupervision_GOOSE_CALH1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS1_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS1_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS1_NamPlt_configRev, IED_INIT_STRING, { .s = 38 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS1_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS1_GoCBRef_setSrcRef, IED_INIT_STRING, { .s = 40 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS1_DiagErr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS2_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS2_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS2_NamPlt_configRev, IED_INIT_STRING, { .s = 41 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS2_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS2_GoCBRef_setSrcRef, IED_INIT_STRING, { .s = 42 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS2_DiagErr_dataNs, IED_INIT_STRING, { .s = 5 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS3_Mod_ctlModel, IED_INIT_INT32, { .i = 1 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS3_NamPlt_vendor, IED_INIT_STRING, { .s = 0 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS3_NamPlt_configRev, IED_INIT_STRING, { .s = 41 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS3_NamPlt_lnNs, IED_INIT_STRING, { .s = 4 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS3_GoCBRef_setSrcRef, IED_INIT_STRING, { .s = 43 } },
+    { &iedModel_ComSupervision_GOOSE_LGOS3_DiagErr_dataNs, IED_INIT_STRING, { .s = 5 } }
+};
+
 static void
 initializeValues()
 {
-
-iedModel_AnUn_ArcProtInput1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_AnUn_ArcProtInput1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_AnUn_ArcProtInput1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_AnUn_ArcProtInput1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_AnUn_ArcProtInput1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_AnUn_ArcProtInput1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN1_SenseFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN2_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN2_SenseFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN3_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_AnUn_ArcProtInput1_ARC_TGSN3_SenseFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SGChoiceB1_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SGChoiceB2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SGChoiceB3_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_LedTstStrt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_FloOn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_FloOff_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_LightOn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_BOBlocked_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_FloCmd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_FloState_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_HealthDev_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-30 07:08:40");
-
-iedModel_Application_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Application_LLN0_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_LedTstOut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_LocKey_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_LLN0_SwAuth_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwMod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_ActiveSG_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_FunInTest_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_AcqBlkAct_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SubstAct_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LLN0_ProtOnOff_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LLN0_ProtOnOff_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_FnctLO_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LLN0_FnctLO_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_LocSta_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LLN0_LocSta_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_LLN0_SwAuthEna1_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Application_LLN0_SwAuthEna1_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_Application_LLN0_SwAuthEna1_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthEna2_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Application_LLN0_SwAuthEna2_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_Application_LLN0_SwAuthEna2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthEna3_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Application_LLN0_SwAuthEna3_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_Application_LLN0_SwAuthEna3_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthEna4_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Application_LLN0_SwAuthEna4_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_Application_LLN0_SwAuthEna4_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthEna5_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Application_LLN0_SwAuthEna5_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_Application_LLN0_SwAuthEna5_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_LEDRs_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LLN0_ResCmpFmt_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LLN0_ResCmpFmt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_MltLev_setVal.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_Application_LLN0_MltLev_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_LLN0_EnaAuthID_setVal.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_Application_LLN0_EnaAuthID_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_AuthIDLev_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_Application_LLN0_AuthIDLev_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_NumAuthID_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_Application_LLN0_NumAuthID_minVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_Application_LLN0_NumAuthID_maxVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_Application_LLN0_NumAuthID_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_Application_LLN0_NumAuthID_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_MltAuthID_setVal.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_Application_LLN0_MltAuthID_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthID1_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthID2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthID3_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthID4_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_SwAuthID5_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_ShowLckCnd_setVal.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_Application_LLN0_ShowLckCnd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_EnTestMod_setVal.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_Application_LLN0_EnTestMod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_RelBoOnTst_setVal.mmsValue = MmsValue_newBoolean(true);
-
-iedModel_Application_LLN0_RelBoOnTst_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LLN0_ResvTms_setVal.mmsValue = MmsValue_newIntegerFromInt32(120);
-
-iedModel_Application_LLN0_ResvTms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LLN0_ResvTms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(65535);
-
-iedModel_Application_LLN0_ResvTms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_Application_LLN0_ResvTms_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_Application_LLN0_ResvTms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PhyNam_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_LPHD0_PhyNam_hwRev.mmsValue = MmsValue_newVisibleString("7SJ85-DAAA-AA0-0AAAA0-AH0112-23111B-ABBCDA-AAAAC0-CB1BA1-EB0BB1");
-
-iedModel_Application_LPHD0_PhyNam_swRev.mmsValue = MmsValue_newVisibleString("V09.30");
-
-iedModel_Application_LPHD0_PhyNam_model.mmsValue = MmsValue_newVisibleString("7SJ85");
-
-iedModel_Application_LPHD0_PhyNam_d.mmsValue = MmsValue_newVisibleString("SIEMENS SIPROTEC 5");
-
-iedModel_Application_LPHD0_Sim_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LPHD0_OpTmh_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(84);
-
-iedModel_Application_LPHD0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_LPHD0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Application_LPHD0_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_LPHD0_GoStop_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_SvStop_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_LifeCon_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_BatFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_ClkFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_ErrMeasT_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_ErrComp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_ErrOffset_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_DigsiAct_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_SimuMode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_CommMode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_ErrMemory_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_AuxPwrFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_SeuHappened_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PSModFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PSModOK_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_OsopNotCon_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PSAuxPwrFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PSAuxPwrOK_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PSModFailSps_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PSAuxFailSps_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_Logon_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_CybSecEvt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_MsgLost_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_ChtBlk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_FlshDskHth_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LPHD0_PrcModIna_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_CALH0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_CALH0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_CALH0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_CALH0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Application_CALH0_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_CALH0_GrIndIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_CALH0_GrWrnIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_CALH0_GrAlmIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTIM0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTIM0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTIM0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_LTIM0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Application_LTIM0_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_LTIM0_TmOfsTmm_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTIM0_TmOfsTmm_minVal.mmsValue = MmsValue_newIntegerFromInt32(-720);
-
-iedModel_Application_LTIM0_TmOfsTmm_maxVal.mmsValue = MmsValue_newIntegerFromInt32(840);
-
-iedModel_Application_LTIM0_TmOfsTmm_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(15);
-
-iedModel_Application_LTIM0_TmOfsTmm_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(85);
-
-iedModel_Application_LTIM0_TmUseDT_setVal.mmsValue = MmsValue_newBoolean(true);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_occ.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_occType.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_occPer.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_weekDay.mmsValue = MmsValue_newIntegerFromInt32(7);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_month.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_day.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_hr.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_Application_LTIM0_TmChgDT_setCal_mn.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Application_LTIM0_TmChgST_setCal_occ.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Application_LTIM0_TmChgST_setCal_occType.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTIM0_TmChgST_setCal_occPer.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_Application_LTIM0_TmChgST_setCal_weekDay.mmsValue = MmsValue_newIntegerFromInt32(7);
-
-iedModel_Application_LTIM0_TmChgST_setCal_month.mmsValue = MmsValue_newIntegerFromInt32(10);
-
-iedModel_Application_LTIM0_TmChgST_setCal_day.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Application_LTIM0_TmChgST_setCal_hr.mmsValue = MmsValue_newUnsignedFromUint32(2);
-
-iedModel_Application_LTIM0_TmChgST_setCal_mn.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Application_LTIM0_ClkSetMan_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTIM0_TmOfsDT_setMag_i.mmsValue = MmsValue_newIntegerFromInt32(60);
-
-iedModel_Application_LTIM0_TmOfsDT_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(85);
-
-iedModel_Application_LTIM0_TmOfsDT_sVC_scaleFactor.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_Application_LTIM0_TmOfsDT_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_Application_LTIM0_TmOfsDT_minVal_i.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTIM0_TmOfsDT_maxVal_i.mmsValue = MmsValue_newIntegerFromInt32(120);
-
-iedModel_Application_LTIM0_TmOfsDT_stepSize_i.mmsValue = MmsValue_newIntegerFromInt32(15);
-
-iedModel_Application_LTIM0_TmOfsDT_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTIM0_DateFormat_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTIM0_DateFormat_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTMS0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTMS0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_LTMS0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Application_LTMS0_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_LTMS0_TmSynErr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_LeapSecond_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_Sync_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_FltTmSyn_setMag_i.mmsValue = MmsValue_newIntegerFromInt32(600);
-
-iedModel_Application_LTMS0_FltTmSyn_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_Application_LTMS0_FltTmSyn_sVC_scaleFactor.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_Application_LTMS0_FltTmSyn_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_Application_LTMS0_FltTmSyn_minVal_i.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTMS0_FltTmSyn_maxVal_i.mmsValue = MmsValue_newIntegerFromInt32(3600);
-
-iedModel_Application_LTMS0_FltTmSyn_stepSize_i.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTMS0_FltTmSyn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmSrc1Std_setVal.mmsValue = MmsValue_newIntegerFromInt32(6);
-
-iedModel_Application_LTMS0_TmSrc1Std_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmSrc1Port_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTMS0_TmSrc1Port_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmSrc1Ch_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTMS0_TmSrc1Ch_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmSrc2Std_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTMS0_TmSrc2Std_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmSrc2Port_setVal.mmsValue = MmsValue_newIntegerFromInt32(6);
-
-iedModel_Application_LTMS0_TmSrc2Port_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmSrc2Ch_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTMS0_TmSrc2Ch_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmZnTmSrc1_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTMS0_TmZnTmSrc1_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTMS0_TmZnTmSrc2_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTMS0_TmZnTmSrc2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_LTRK0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_LTRK0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_LTRK0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_LTRK0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Application_LTRK0_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_RSLEDGAPC0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_RSLEDGAPC0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_RSLEDGAPC0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_RSLEDGAPC0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Application_RSLEDGAPC0_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Application_RSLEDGAPC0_ResetIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_RSLEDGAPC0_LedTstOut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_RSLEDGAPC0_ResetCtl_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_RSLEDGAPC0_ResetCtl_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Application_USER1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Application_USER1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER1_Lockout_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2024-04-26 10:10:18");
-
-iedModel_Application_USER2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER2_SF6Low_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_TCSFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_J03RelayFail_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_TestPlugIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_CBMtrMCBTrp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_CntrlMCBTrp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_J03RlyMCBTrp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_ACCirMCBTrp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_SlctrSwLocal_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_SlctrSwRmt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_SpringChrgd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_LockoutReset_pulseConfig_cmdQual.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_USER2_LockoutReset_pulseConfig_onDur.mmsValue = MmsValue_newUnsignedFromUint32(200);
-
-iedModel_Application_USER2_LockoutReset_pulseConfig_offDur.mmsValue = MmsValue_newUnsignedFromUint32(10);
-
-iedModel_Application_USER2_LockoutReset_pulseConfig_numPls.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_Application_USER2_LockoutReset_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER2_LockoutReset_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_Application_USER2_LockoutReset_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Application_USER2_LockoutReset_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_Application_USER2_LockoutReset_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_LowArcActive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_LclOpenCmd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER2_LclCloseCmd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-03-17 15:21:26");
-
-iedModel_Application_USER3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER3_GPS1GCB1Arc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER4_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER4_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER4_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-07 13:09:18");
-
-iedModel_Application_USER4_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER4_MCB0150BF_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER4_FCB0250BF_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER5_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER5_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER5_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-07 14:27:44");
-
-iedModel_Application_USER5_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER5_FCB02Q0_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER5_BlockClose_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER6_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER6_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER6_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-10-02 14:49:04");
-
-iedModel_Application_USER6_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER6_GPCIntrtrip_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER7_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER7_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER7_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2024-04-23 13:03:56");
-
-iedModel_Application_USER7_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER7_EHHiTempA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER8_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Application_USER8_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Application_USER8_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-30 07:08:40");
-
-iedModel_Application_USER8_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("Siprotec5/user-defined");
-
-iedModel_Application_USER8_NtwrkHWErr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_Application_USER8_NtwrkComErr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5/userdefined");
-
-iedModel_BinIO_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_BinIO_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_BinIO_BinaryInputs_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_BinIO_BinaryInputs_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@BinIO");
-
-iedModel_BinIO_BinaryInputs_LPDI1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI1_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI2_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI2_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI3_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI3_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI4_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI4_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI4_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI4_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI4_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI4_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI5_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI5_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI5_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI5_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI5_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI5_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI6_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI6_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI6_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI6_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI6_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI6_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI7_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI7_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI7_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI7_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI7_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI7_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI8_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI8_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI8_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI8_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI8_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI8_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI9_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI9_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI9_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI9_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI9_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI9_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI10_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI10_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI10_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI10_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI10_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI10_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI11_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI11_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI11_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI11_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI11_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI11_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI12_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI12_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI12_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI12_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI12_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI12_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI13_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI13_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI13_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI13_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI13_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI13_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI14_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI14_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI14_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI14_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI14_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI14_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI15_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI15_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI15_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI15_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI15_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI15_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI16_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI16_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI16_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI16_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI16_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI16_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI17_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI17_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI17_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI17_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI17_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI17_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI18_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI18_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI18_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI18_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI18_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI18_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI19_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI19_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI19_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI19_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI19_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI19_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI20_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI20_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI20_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI20_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI20_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI20_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI21_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI21_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI21_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI21_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI21_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI21_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI22_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI22_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI22_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI22_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI22_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI22_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI23_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI23_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI23_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI23_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI23_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI23_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI24_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI24_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI24_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI24_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI24_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI24_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI25_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI25_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI25_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI25_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI25_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI25_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI26_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI26_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI26_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI26_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI26_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI26_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI27_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI27_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI27_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI27_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI27_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI27_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI28_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI28_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI28_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI28_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI28_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI28_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI29_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI29_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI29_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI29_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI29_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI29_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI30_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI30_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI30_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI30_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI30_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI30_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI31_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI31_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI31_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI31_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI31_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI31_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI32_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI32_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI32_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI32_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI32_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI32_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI33_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI33_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI33_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI33_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI33_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI33_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI34_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI34_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI34_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI34_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI34_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI34_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI35_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryInputs_LPDI35_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryInputs_LPDI35_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryInputs_LPDI35_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryInputs_LPDI35_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryInputs_LPDI35_In_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_BinIO_BinaryOutputs_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@BinIO");
-
-iedModel_BinIO_BinaryOutputs_LPDO1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO1_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO2_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO2_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO3_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO3_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO4_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO4_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO4_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO4_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO4_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO4_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO5_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO5_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO5_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO5_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO5_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO5_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO6_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO6_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO6_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO6_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO6_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO6_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO7_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO7_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO7_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO7_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO7_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO7_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO8_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO8_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO8_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO8_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO8_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO8_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO9_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO9_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO9_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO9_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO9_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO9_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO10_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO10_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO10_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO10_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO10_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO10_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO11_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO11_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO11_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO11_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO11_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO11_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO12_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO12_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO12_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO12_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO12_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO12_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO13_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO13_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO13_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO13_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO13_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO13_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO14_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO14_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO14_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO14_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO14_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO14_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO15_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO15_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO15_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO15_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO15_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO15_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO16_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO16_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO16_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO16_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO16_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO16_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO17_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO17_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO17_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO17_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO17_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO17_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO18_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO18_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO18_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO18_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO18_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO18_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO19_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO19_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO19_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO19_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO19_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO19_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO20_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO20_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO20_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO20_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO20_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO20_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO21_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO21_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO21_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO21_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO21_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO21_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO22_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO22_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO22_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO22_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO22_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO22_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO23_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO23_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO23_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO23_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO23_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO23_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO24_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO24_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO24_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO24_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO24_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO24_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO25_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO25_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO25_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO25_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO25_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO25_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO26_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO26_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO26_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO26_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO26_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO26_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO27_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO27_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO27_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO27_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO27_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO27_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO28_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO28_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO28_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO28_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO28_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO28_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO29_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO29_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO29_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO29_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO29_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO29_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO30_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO30_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO30_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO30_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO30_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO30_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO31_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO31_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO31_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO31_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO31_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO31_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO32_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_BinIO_BinaryOutputs_LPDO32_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_BinIO_BinaryOutputs_LPDO32_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_BinIO_BinaryOutputs_LPDO32_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_BinIO_BinaryOutputs_LPDO32_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_BinIO_BinaryOutputs_LPDO32_OutSPS_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_CB1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_CB1_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_GAPC1_ARtgObj_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_CB1_GAPC1_ARtgObj_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_GAPC1_ARtgObj_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_GAPC1_ARtgObj_minVal_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_CB1_GAPC1_ARtgObj_maxVal_f.mmsValue = MmsValue_newFloat(100000.0);
-
-iedModel_CB1_GAPC1_ARtgObj_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_CB1_GAPC1_ARtgObj_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_GAPC1_VRtgObj_setMag_f.mmsValue = MmsValue_newFloat(20.8);
-
-iedModel_SE_CB1_GAPC1_VRtgObj_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_GAPC1_VRtgObj_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_GAPC1_VRtgObj_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_GAPC1_VRtgObj_minVal_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_CB1_GAPC1_VRtgObj_maxVal_f.mmsValue = MmsValue_newFloat(1200.0);
-
-iedModel_CB1_GAPC1_VRtgObj_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_CB1_GAPC1_VRtgObj_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_GAPC1_PoleOpenA_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_CB1_GAPC1_PoleOpenA_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_GAPC1_PoleOpenA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_GAPC1_PoleOpenA_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_CB1_GAPC1_PoleOpenA_maxVal_f.mmsValue = MmsValue_newFloat(2000.0);
-
-iedModel_CB1_GAPC1_PoleOpenA_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_GAPC1_PoleOpenA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_GAPC1_OpModeRBRF_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_GAPC1_OpModeRBRF_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_PTRC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_PTRC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_PTRC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_PTRC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_PTRC1_TrpBbpDiff_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_PTRC1_TrpBbpBFP_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_PTRC1_TrpBbpExt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_PTRC1_ResetTrip_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_PTRC1_ResetTrip_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_XCBR1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_XCBR1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_XCBR1_Pos_pulseConfig_cmdQual.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_Pos_pulseConfig_onDur.mmsValue = MmsValue_newUnsignedFromUint32(100);
-
-iedModel_CB1_XCBR1_Pos_pulseConfig_offDur.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_XCBR1_Pos_pulseConfig_numPls.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_CB1_XCBR1_Pos_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_BlkOpn_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_BlkCls_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_SumSwARs_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SumSwARs_pulsQty.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_CB1_XCBR1_SetOpCnt_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_SetOpCnt_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_SetOpCnt_maxVal.mmsValue = MmsValue_newIntegerFromInt32(999999999);
-
-iedModel_CB1_XCBR1_SetOpCnt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SetSwASumA_mxVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumA_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_SetSwASumA_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_XCBR1_SetSwASumA_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_SetSwASumA_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SetSwASumA_SBOw_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumA_Oper_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumA_Cancel_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumB_mxVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumB_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_SetSwASumB_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_XCBR1_SetSwASumB_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_SetSwASumB_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumB_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SetSwASumB_SBOw_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumB_Oper_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumB_Cancel_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumC_mxVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumC_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_SetSwASumC_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_XCBR1_SetSwASumC_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_SetSwASumC_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SetSwASumC_SBOw_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumC_Oper_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetSwASumC_Cancel_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SetOpnHrs_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_SetOpnHrs_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_SetOpnHrs_maxVal.mmsValue = MmsValue_newIntegerFromInt32(9999999);
-
-iedModel_CB1_XCBR1_SetOpnHrs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SetOpHrs_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_SetOpHrs_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_XCBR1_SetOpHrs_maxVal.mmsValue = MmsValue_newIntegerFromInt32(9999999);
-
-iedModel_CB1_XCBR1_SetOpHrs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_AqBlk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_Rdy_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_RsSwStat_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_RsAqBlkSub_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_TripRelViaBi_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_OpCBToStr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_TripOpnCmd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_ClsCmd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_CmdActv_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_AlmSupp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_DefTr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SumSwARsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SumSwARsA_pulsQty.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_CB1_XCBR1_SumSwARsA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SumSwARsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SumSwARsB_pulsQty.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_CB1_XCBR1_SumSwARsB_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SumSwARsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SumSwARsC_pulsQty.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_CB1_XCBR1_SumSwARsC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SwAphsA_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwAphsA_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwAphsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SwAphsA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SwAphsB_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwAphsB_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwAphsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SwAphsB_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SwAphsC_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwAphsC_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwAphsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SwAphsC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SwANeut_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwANeut_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwANeut_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_XCBR1_SwANeut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SwVphsA_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwVphsA_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwVphsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_XCBR1_SwVphsA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_XCBR1_SwVphsA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SwVphsB_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwVphsB_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwVphsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_XCBR1_SwVphsB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_XCBR1_SwVphsB_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_SwVphsC_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwVphsC_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_XCBR1_SwVphsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_XCBR1_SwVphsC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_XCBR1_SwVphsC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_CBOpnHrs_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(84);
-
-iedModel_CB1_XCBR1_CBOpnHrs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_OpHrs_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(84);
-
-iedModel_CB1_XCBR1_OpHrs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_AnnBrkVal_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_XCBR1_AnnBrkVal_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_BbpBlockDO_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_XCBR1_NoTrpRelBi_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_GAPC2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_GAPC2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_GAPC2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_GAPC2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_GAPC2_Input_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_GAPC2_Detected_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_GAPC2_ActionTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(300);
-
-iedModel_CB1_GAPC2_ActionTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(10);
-
-iedModel_CB1_GAPC2_ActionTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_CB1_GAPC2_ActionTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_GAPC2_ActionTmms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_GAPC2_CbOpDrpDel_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_GAPC2_CbOpDrpDel_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_GAPC2_CbOpDrpDel_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_CB1_GAPC2_CbOpDrpDel_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_GAPC2_CbOpDrpDel_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RSLEDGAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_RSLEDGAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RSLEDGAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_RSLEDGAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_RSLEDGAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_RSLEDGAPC1_ResetIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RSLEDGAPC1_LedTstOut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RSLEDGAPC1_ResetCtl_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_RSLEDGAPC1_ResetCtl_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_TSCB_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_TSCB_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_TSCB_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_TSCB_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_TSCB_GAPC1_ClsTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(60);
-
-iedModel_CB1_TSCB_GAPC1_ClsTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(20);
-
-iedModel_CB1_TSCB_GAPC1_ClsTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(150);
-
-iedModel_CB1_TSCB_GAPC1_ClsTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_TSCB_GAPC1_ClsTmms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_TSCB_GAPC1_VAdpFact_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_CB1_TSCB_GAPC1_VAdpFact_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_TSCB_GAPC1_VAdpFact_minVal_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_CB1_TSCB_GAPC1_VAdpFact_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_CB1_TSCB_GAPC1_VAdpFact_stepSize_f.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_CB1_TSCB_GAPC1_VAdpFact_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_TSCB_GAPC1_AdpAngDeg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_SE_CB1_TSCB_GAPC1_AdpAngDeg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_TSCB_GAPC1_AdpAngDeg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(9);
-
-iedModel_CB1_TSCB_GAPC1_AdpAngDeg_minVal_f.mmsValue = MmsValue_newFloat(-179.0);
-
-iedModel_CB1_TSCB_GAPC1_AdpAngDeg_maxVal_f.mmsValue = MmsValue_newFloat(180.0);
-
-iedModel_CB1_TSCB_GAPC1_AdpAngDeg_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_CB1_TSCB_GAPC1_AdpAngDeg_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_CSWI1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_CSWI1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_CSWI1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_CSWI1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_CSWI1_Pos_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_CB1_CSWI1_Pos_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(30000);
-
-iedModel_CB1_CSWI1_Pos_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_CB1_CSWI1_LocSta_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_CSWI1_SwAuthChk_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_CSWI1_SwAuthChk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_NomEqActl_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_CSWI1_NomEqActl_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_DblActBlk_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_CSWI1_DblActBlk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_BlkByProt_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_CSWI1_BlkByProt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_OwnSwAuth_setVal.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_CB1_CSWI1_OwnSwAuth_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_EnaAuthID_setVal.mmsValue = MmsValue_newBoolean(true);
-
-iedModel_CB1_CSWI1_EnaAuthID_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_AuthIDLev_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_CB1_CSWI1_AuthIDLev_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_NumAuthID_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_CB1_CSWI1_NumAuthID_minVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_CB1_CSWI1_NumAuthID_maxVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_CSWI1_NumAuthID_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_CB1_CSWI1_NumAuthID_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_MltAuthID_setVal.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_CB1_CSWI1_MltAuthID_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthID1_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthID2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthID3_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthID4_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthID5_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuth_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwMod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthEna1_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_CSWI1_SwAuthEna1_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_CB1_CSWI1_SwAuthEna1_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthEna2_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_CSWI1_SwAuthEna2_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_CB1_CSWI1_SwAuthEna2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthEna3_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_CSWI1_SwAuthEna3_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_CB1_CSWI1_SwAuthEna3_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthEna4_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_CSWI1_SwAuthEna4_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_CB1_CSWI1_SwAuthEna4_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CSWI1_SwAuthEna5_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_CSWI1_SwAuthEna5_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(1000);
-
-iedModel_CB1_CSWI1_SwAuthEna5_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CILO1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_CILO1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_CILO1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_CILO1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_CILO1_EnaOpnFix_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CILO1_EnaClsFix_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CBT_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_CBT_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_CBT_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_CBT_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_CBT_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_CBT_GAPC1_StrTst3p_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_CBT_GAPC1_StrTst3p_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(5300);
-
-iedModel_CB1_CBT_GAPC1_StrTst3p_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CBT_GAPC1_TstExec_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CBT_GAPC1_TstTr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CBT_GAPC1_TstCls_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_CBT_GAPC1_TstCnc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_BI1_ZAXN1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_BI1_ZAXN1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_BI1_ZAXN1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_BI1_ZAXN1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_BI1_ZAXN1_TripRelay_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_BI1_ZAXN1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_BI1_ZAXN1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_BI1_ZAXN1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_BI1_ZAXN1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_BI1_ZAXN1_AlmDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(2000);
-
-iedModel_CB1_BI1_ZAXN1_AlmDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_CB1_BI1_ZAXN1_AlmDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(600000);
-
-iedModel_CB1_BI1_ZAXN1_AlmDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_BI1_ZAXN1_AlmDlTmms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_BI1_ZAXN1_CfgErr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_RBRF1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_RBRF1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-07 08:53:50");
-
-iedModel_CB1_RBRF1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_RBRF1_TPTrTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(50);
-
-iedModel_CB1_RBRF1_TPTrTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_TPTrTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_CB1_RBRF1_TPTrTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_RBRF1_ThreshEF_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_Initiation_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_BFRelease_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_CBFaulty_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_Initdef3p_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_RelCBdef3p_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_OpCBdef3p_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_BFInitNR_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_AuxCritNR_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_ImmOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_CBFailPole_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_DlyByInvMV_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_RBRF1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_StrValPh_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_CB1_RBRF1_StrValPh_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrValPh_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_RBRF1_StrValPh_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_CB1_RBRF1_StrValPh_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_CB1_RBRF1_StrValPh_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrValPh_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_StrValEF_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_CB1_RBRF1_StrValEF_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrValEF_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_RBRF1_StrValEF_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_CB1_RBRF1_StrValEF_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_CB1_RBRF1_StrValEF_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrValEF_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_CBAuxCrit_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_CBAuxCrit_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_DropOut_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_DropOut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_StrHldIn_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_RBRF1_StrHldIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_StrHldExt_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_StrHldExt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_BIStart_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_BIStart_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_ReTripMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_ReTripMod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_TPFailTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(130);
-
-iedModel_CB1_RBRF1_TPFailTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(-1);
-
-iedModel_CB1_RBRF1_TPFailTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_CB1_RBRF1_TPFailTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_RBRF1_TPFailTmms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_SupTimeRel_setVal.mmsValue = MmsValue_newIntegerFromInt32(60);
-
-iedModel_CB1_RBRF1_SupTimeRel_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_SupTimeRel_maxVal.mmsValue = MmsValue_newIntegerFromInt32(1000);
-
-iedModel_CB1_RBRF1_SupTimeRel_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_RBRF1_SupTimeRel_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_PCheck3I0_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_RBRF1_PCheck3I0_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_PCheck3I2_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_RBRF1_PCheck3I2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_StrVal3I0_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_CB1_RBRF1_StrVal3I0_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrVal3I0_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_RBRF1_StrVal3I0_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_CB1_RBRF1_StrVal3I0_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_CB1_RBRF1_StrVal3I0_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrVal3I0_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_StrVal3I2_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_CB1_RBRF1_StrVal3I2_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrVal3I2_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_RBRF1_StrVal3I2_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_CB1_RBRF1_StrVal3I2_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_CB1_RBRF1_StrVal3I2_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_RBRF1_StrVal3I2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_BIMoniSt_setVal.mmsValue = MmsValue_newIntegerFromInt32(15000);
-
-iedModel_CB1_RBRF1_BIMoniSt_minVal.mmsValue = MmsValue_newIntegerFromInt32(50);
-
-iedModel_CB1_RBRF1_BIMoniSt_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_CB1_RBRF1_BIMoniSt_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_RBRF1_BIMoniSt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_BIMoniRel_setVal.mmsValue = MmsValue_newIntegerFromInt32(15000);
-
-iedModel_CB1_RBRF1_BIMoniRel_minVal.mmsValue = MmsValue_newIntegerFromInt32(50);
-
-iedModel_CB1_RBRF1_BIMoniRel_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_CB1_RBRF1_BIMoniRel_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_CB1_RBRF1_BIMoniRel_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_IntActDBBP_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_RBRF1_IntActDBBP_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_ImmedDrop_setVal.mmsValue = MmsValue_newBoolean(true);
-
-iedModel_CB1_RBRF1_ImmedDrop_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_RBRF1_LatchedBI_setVal.mmsValue = MmsValue_newBoolean(true);
-
-iedModel_CB1_RBRF1_LatchedBI_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_Fundamental_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_Fundamental_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_Fundamental_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_CB1_Fundamental_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_Fundamental_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_Fundamental_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@CB1");
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsAB_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsBC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PPV_phsCA_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsA_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsB_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_phsC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_db.mmsValue = MmsValue_newUnsignedFromUint32(20000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_PhV_res_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsA_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsB_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_phsC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_db.mmsValue = MmsValue_newUnsignedFromUint32(100000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_A_res_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_ClcMth_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_ClcMth_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_VneutC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_CB1_Fundamental_FPRE_MMXU1_AneutC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Ds1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Ds1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Ds1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Ds1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Ds1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_Ds1_XSWI1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Ds1_XSWI1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds1_XSWI1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Ds1_XSWI1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Ds1_XSWI1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Ds1_XSWI1_Pos_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds1_XSWI1_BlkOpn_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds1_XSWI1_BlkCls_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds1_XSWI1_AqBlk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Ds2_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Ds2_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Ds2_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Ds2_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Ds2_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds2_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_Ds2_XSWI1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Ds2_XSWI1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds2_XSWI1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Ds2_XSWI1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Ds2_XSWI1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Ds2_XSWI1_Pos_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds2_XSWI1_BlkOpn_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds2_XSWI1_BlkCls_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Ds2_XSWI1_AqBlk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Mod1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Mod1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Mod1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_Mod1_Channel1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod1_Channel1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Mod1_Channel1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Mod1_Channel1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod1_Channel1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod1_Channel1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Mod1");
-
-iedModel_Mod2_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod2_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Mod2_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Mod2_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod2_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod2_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_Mod2_Channel1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod2_Channel1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Mod2_Channel1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Mod2_Channel1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod2_Channel1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod2_Channel1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Mod2");
-
-iedModel_Mod2_Channel1_PRP_LCCH1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod2_Channel1_PRP_LCCH1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod2_Channel1_PRP_LCCH1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod2_Channel1_PRP_LCCH1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Mod2_Channel1_PRP_LCCH1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Mod2_Channel1_LCCH1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod2_Channel1_LCCH1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod2_Channel1_LCCH1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod2_Channel1_LCCH1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 12:18:40");
-
-iedModel_Mod2_Channel1_LCCH1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Mod2_Channel1_LCCH2_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod2_Channel1_LCCH2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod2_Channel1_LCCH2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod2_Channel1_LCCH2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-12-16 14:33:33");
-
-iedModel_Mod2_Channel1_LCCH2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Mod3_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod3_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Mod3_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Mod3_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod3_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod3_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_Mod3_Channel1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod3_Channel1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Mod3_Channel1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Mod3_Channel1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod3_Channel1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod3_Channel1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Mod3");
-
-iedModel_Mod3_Channel1_LCCH1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod3_Channel1_LCCH1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod3_Channel1_LCCH1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod3_Channel1_LCCH1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-08-31 13:34:51");
-
-iedModel_Mod3_Channel1_LCCH1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Mod3_Channel1_HSR_LCCH1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Mod3_Channel1_HSR_LCCH1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Mod3_Channel1_HSR_LCCH1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Mod3_Channel1_HSR_LCCH1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-20 09:24:00");
-
-iedModel_Mod3_Channel1_HSR_LCCH1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_PowS_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_PowS_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_PowS_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_PowS_GAPC1_PhaseRev_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_GAPC1_InvPhases_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_GAPC1_PhsSeq_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_GAPC1_PhsSeq_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_GAPC1_PhRevABC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_GAPC1_PhRevACB_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_GAPC1_FOutOfRg_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_PowS_MeasPointI3ph1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@PowS");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtrlIn_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtrlIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_DisSet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_DisReset_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvPhABCur_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvPhBCCur_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvPhACCur_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_StateBi_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_StateCmd_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvertedPh_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_InvertedPh_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTConnect_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTConnect_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTSPInDir_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CTSPInDir_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtInvPol_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_CtInvPol_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSec_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSec_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRange_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRange_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AInternTyp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AInternTyp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSecIN_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ARtgSecIN_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN2_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AMeasRgIN2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN2_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_AIntTypIN2_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_minVal_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_KToRtgK_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_setMag_f.mmsValue = MmsValue_newFloat(5.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(-2);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_minVal_f.mmsValue = MmsValue_newFloat(0.5);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_maxVal_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrKToRtgK_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_setMag_f.mmsValue = MmsValue_newFloat(15.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(-2);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_minVal_f.mmsValue = MmsValue_newFloat(0.5);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_maxVal_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_ErrRtgK_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MuIndex_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Tracking_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_Tracking_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisActTr_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisActTr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_setMag_f.mmsValue = MmsValue_newFloat(20.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_maxVal_f.mmsValue = MmsValue_newFloat(2000.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_CT3P_GAPC1_MUDisTr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC_61850-7-4:2007B");
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR1_ARtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_minVal_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_maxVal_f.mmsValue = MmsValue_newFloat(100000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ARtg_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR1_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR1_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR1_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_AmpSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_AmpSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_AmpSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Trp_setVal.mmsValue = MmsValue_newIntegerFromInt32(10);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(210);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(2147483647);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_ScndTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR1_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR1_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC_61850-7-4:2007B");
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR2_ARtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_minVal_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_maxVal_f.mmsValue = MmsValue_newFloat(100000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ARtg_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR2_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR2_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR2_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_AmpSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_AmpSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_AmpSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Trp_setVal.mmsValue = MmsValue_newIntegerFromInt32(10);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(210);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(2147483647);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_ScndTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR2_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR2_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC_61850-7-4:2007B");
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR3_ARtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_minVal_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_maxVal_f.mmsValue = MmsValue_newFloat(100000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ARtg_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR3_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR3_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR3_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_AmpSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_AmpSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_AmpSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Trp_setVal.mmsValue = MmsValue_newIntegerFromInt32(10);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(210);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(2147483647);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_ScndTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR3_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR3_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC_61850-7-4:2007B");
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR4_ARtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_minVal_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_maxVal_f.mmsValue = MmsValue_newFloat(100000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ARtg_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR4_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR4_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR4_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_AmpSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_AmpSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_AmpSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Trp_setVal.mmsValue = MmsValue_newIntegerFromInt32(10);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(210);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(2147483647);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_ScndTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TCTR4_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointI3ph1_TCTR4_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_ResetBW_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhABWsus_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhBBWsus_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhCBWsus_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhABW_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhBBW_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_PhCBW_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BWsus_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BrokenWire_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BlkMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_BlkMod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_minVal_f.mmsValue = MmsValue_newFloat(0.004);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_maxVal_f.mmsValue = MmsValue_newFloat(5.0);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_stepSize_f.mmsValue = MmsValue_newFloat(0.001);
-
-iedModel_PowS_MeasPointI3ph1_TR_SBWI1_DltAblk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalLimit_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_setMag_f.mmsValue = MmsValue_newFloat(0.5);
-
-iedModel_SE_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_minVal_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_maxVal_f.mmsValue = MmsValue_newFloat(0.95);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_I_SSYM1_BalFactor_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_setMag_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_maxVal_f.mmsValue = MmsValue_newFloat(2000.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SPSQ1_RlsThrshld_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_setMag_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_SE_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_maxVal_f.mmsValue = MmsValue_newFloat(0.95);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAFactor_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_setMag_f.mmsValue = MmsValue_newFloat(20.0);
-
-iedModel_SE_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_maxVal_f.mmsValue = MmsValue_newFloat(2000.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointI3ph1_I_SSUM1_SumAThrld_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointI3ph1_ISUM_SADC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_PowS_MeasPointV3ph1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@PowS");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VTConnect_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VTConnect_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvertedPh_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvertedPh_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_setMag_f.mmsValue = MmsValue_newFloat(110.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_minVal_f.mmsValue = MmsValue_newFloat(80.0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_maxVal_f.mmsValue = MmsValue_newFloat(230.0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_stepSize_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRtgSec_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_setMag_f.mmsValue = MmsValue_newFloat(1.73);
-
-iedModel_SE_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_minVal_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_maxVal_f.mmsValue = MmsValue_newFloat(9.99);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_VRatPhVddn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_MuIndex_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Tracking_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_Tracking_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvPhABVol_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvPhBCVol_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VT3P_GAPC1_InvPhACVol_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61869-9:2016A");
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VolSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VolSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VolSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_setMag_f.mmsValue = MmsValue_newFloat(20.8);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR1_VRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_minVal_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_maxVal_f.mmsValue = MmsValue_newFloat(1200.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_VRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR1_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_setMag_f.mmsValue = MmsValue_newFloat(189.09091);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR1_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR1_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_setMag_f.mmsValue = MmsValue_newFloat(1.8181819);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR1_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR1_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61869-9:2016A");
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VolSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VolSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VolSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_setMag_f.mmsValue = MmsValue_newFloat(20.8);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR2_VRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_minVal_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_maxVal_f.mmsValue = MmsValue_newFloat(1200.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_VRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR2_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_setMag_f.mmsValue = MmsValue_newFloat(189.09091);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR2_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR2_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_setMag_f.mmsValue = MmsValue_newFloat(1.8181819);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR2_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR2_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61869-9:2016A");
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VolSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VolSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VolSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_setMag_f.mmsValue = MmsValue_newFloat(20.8);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR3_VRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_minVal_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_maxVal_f.mmsValue = MmsValue_newFloat(1200.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_VRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR3_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_setMag_f.mmsValue = MmsValue_newFloat(189.09091);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR3_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR3_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_setMag_f.mmsValue = MmsValue_newFloat(1.8181819);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR3_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR3_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61869-9:2016A");
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VolSv_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VolSv_sVC_scaleFactor.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VolSv_sVC_offset.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_setMag_f.mmsValue = MmsValue_newFloat(20.8);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR4_VRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_minVal_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_maxVal_f.mmsValue = MmsValue_newFloat(1200.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_VRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(50.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR4_HzRtg_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_minVal_f.mmsValue = MmsValue_newFloat(16.67);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_maxVal_f.mmsValue = MmsValue_newFloat(60.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HzRtg_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_setMag_f.mmsValue = MmsValue_newFloat(109.3011);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR4_Rat_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_maxVal_f.mmsValue = MmsValue_newFloat(10000.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Rat_stepSize_f.mmsValue = MmsValue_newFloat(0.1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR4_Cor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_minVal_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_maxVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Cor_stepSize_f.mmsValue = MmsValue_newFloat(1.0E-5);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_setMag_f.mmsValue = MmsValue_newFloat(1.8181819);
-
-iedModel_SE_PowS_MeasPointV3ph1_TVTR4_Clip_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_maxVal_f.mmsValue = MmsValue_newFloat(100.0);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_Clip_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_AccMeas_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_AccPro_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(90000);
-
-iedModel_PowS_MeasPointV3ph1_TVTR4_HoldTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_setMag_f.mmsValue = MmsValue_newFloat(10.400001);
-
-iedModel_SE_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_minVal_f.mmsValue = MmsValue_newFloat(0.056727275);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_maxVal_f.mmsValue = MmsValue_newFloat(35.36);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalLimit_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_setMag_f.mmsValue = MmsValue_newFloat(0.75);
-
-iedModel_SE_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_minVal_f.mmsValue = MmsValue_newFloat(0.58);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_maxVal_f.mmsValue = MmsValue_newFloat(0.95);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_PowS_MeasPointV3ph1_U_SSYM1_BalFactor_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_PowS_MeasPointV3ph1_U_SPSQ1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_Failure_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(5.2000003);
-
-iedModel_SE_PowS_MeasPointV3ph1_U_SSUM1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(0.056727275);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(35.36);
-
-iedModel_PowS_MeasPointV3ph1_U_SSUM1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-01-06 11:42:27");
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_VTmcb_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(30);
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_PowS_MeasPointV3ph1_VTCB_SFFM1_ProtDlTmms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Rec_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Rec_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Rec_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_Rec_RCDG_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_RCDG_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_RCDG_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Rec_RCDG_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Rec_RCDG_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Rec_RCDG_GAPC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_RCDG_GAPC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_RCDG_GAPC1_CtdValType_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_RCDG_GAPC1_CtdValType_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_RCDG_GAPC1_CRevYear_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_RCDG_GAPC1_CRevYear_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_GFLG_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_GFLG_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_GFLG_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Rec_GFLG_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Rec_GFLG_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Rec_GFLG_GAPC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_GFLG_GAPC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_GFLG_GAPC1_GflNum_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_GFLG_GAPC1_GflFull_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Rec_FaultRecorder_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Rec_FaultRecorder_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_Rec_FaultRecorder_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_FaultRecorder_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_FaultRecorder_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Rec");
-
-iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_FaultRecorder_RCDR_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Rec_FaultRecorder_RCDR_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Rec_FaultRecorder_RCDR_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_FaultRecorder_RCDR_GAPC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdTrg_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MemRs_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MemRs_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(30000);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MemClr_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MemClr_operTimeout.mmsValue = MmsValue_newUnsignedFromUint32(30000);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(50);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(16000);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PreTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(50);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(16000);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_PstTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_StrExt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTrg_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStart_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStart_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStore_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_RcdStore_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(5000);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(200);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(80000);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_MaxTmms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(500);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(200);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(80000);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_ManTmms_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_SmpRate_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_SmpRate_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcINChl_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcINChl_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcVNChl_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_CalcVNChl_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_Rec_FaultRecorder_DEF_RDRE1_FltLogFull_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_VI3p1_VI3P_GAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_VI3P_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_VI3P_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_VI3P_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_VI3P_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_VI3P_GAPC1_ARtgObj_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_VI3p1_VI3P_GAPC1_ARtgObj_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_VI3P_GAPC1_ARtgObj_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_VI3P_GAPC1_ARtgObj_minVal_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_VI3p1_VI3P_GAPC1_ARtgObj_maxVal_f.mmsValue = MmsValue_newFloat(100000.0);
-
-iedModel_VI3p1_VI3P_GAPC1_ARtgObj_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_VI3P_GAPC1_ARtgObj_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_VI3P_GAPC1_VRtgObj_setMag_f.mmsValue = MmsValue_newFloat(20.8);
-
-iedModel_SE_VI3p1_VI3P_GAPC1_VRtgObj_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_VI3P_GAPC1_VRtgObj_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_VI3P_GAPC1_VRtgObj_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_VI3P_GAPC1_VRtgObj_minVal_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_VI3p1_VI3P_GAPC1_VRtgObj_maxVal_f.mmsValue = MmsValue_newFloat(1200.0);
-
-iedModel_VI3p1_VI3P_GAPC1_VRtgObj_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_VI3P_GAPC1_VRtgObj_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_VI3P_GAPC1_VARtgObj_setMag_f.mmsValue = MmsValue_newFloat(7.205331);
-
-iedModel_SE_VI3p1_VI3P_GAPC1_VARtgObj_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_VI3P_GAPC1_VARtgObj_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(61);
-
-iedModel_VI3p1_VI3P_GAPC1_VARtgObj_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(6);
-
-iedModel_VI3p1_VI3P_GAPC1_VARtgObj_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_VI3P_GAPC1_SysNeutPt_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_VI3P_GAPC1_SysNeutPt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_VI3P_GAPC1_PQSign_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_VI3P_GAPC1_PQSign_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PTRC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_PTRC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_PTRC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_PTRC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_CF_SBWI1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_CF_SBWI1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_CF_SBWI1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_CF_SBWI1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_CF_SBWI1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_RSLEDGAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_RSLEDGAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_RSLEDGAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_RSLEDGAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_RSLEDGAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_RSLEDGAPC1_ResetIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_RSLEDGAPC1_LedTstOut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_RSLEDGAPC1_ResetCtl_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_RSLEDGAPC1_ResetCtl_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_PHAR1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_PHAR1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_PHAR1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_PHAR1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_Irs2HaDetA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_Irs2HaDetB_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_Irs2HaDetC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_IrsCWADet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_IrsCrsBlk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_PHAR1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_CrossBlk_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_PHAR1_CrossBlk_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_StrVal2Ha_setMag_f.mmsValue = MmsValue_newFloat(20.0);
-
-iedModel_SE_VI3p1_PHAR1_StrVal2Ha_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_PHAR1_StrVal2Ha_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(-2);
-
-iedModel_VI3p1_PHAR1_StrVal2Ha_minVal_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_VI3p1_PHAR1_StrVal2Ha_maxVal_f.mmsValue = MmsValue_newFloat(45.0);
-
-iedModel_VI3p1_PHAR1_StrVal2Ha_stepSize_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_VI3p1_PHAR1_StrVal2Ha_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_StrValAMax_setMag_f.mmsValue = MmsValue_newFloat(1500.0);
-
-iedModel_SE_VI3p1_PHAR1_StrValAMax_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_PHAR1_StrValAMax_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_PHAR1_StrValAMax_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_PHAR1_StrValAMax_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_PHAR1_StrValAMax_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_PHAR1_StrValAMax_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_BlkIrshCWA_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_PHAR1_BlkIrshCWA_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_BlkIrsh2Ha_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_PHAR1_BlkIrsh2Ha_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_CrossBlkTm_setVal.mmsValue = MmsValue_newIntegerFromInt32(60);
-
-iedModel_VI3p1_PHAR1_CrossBlkTm_minVal.mmsValue = MmsValue_newIntegerFromInt32(30);
-
-iedModel_VI3p1_PHAR1_CrossBlkTm_maxVal.mmsValue = MmsValue_newIntegerFromInt32(200000);
-
-iedModel_VI3p1_PHAR1_CrossBlkTm_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_PHAR1_CrossBlkTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_PHAR1_TrFltRec_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_PHAR1_TrFltRec_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_OCGIGAPC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_OCGIGAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_OCGIGAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_OCGIGAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051NOCgndB1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051NOCgndB1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051NOCgndB1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_5051NOCgndB1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_5051NOCgndB1_PTRC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_PTRC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_PTRC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051NOCgndB1_PTRC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_SE_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(1.9999999);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(1000);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_SecHGndDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_SecHGndDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(38.0);
-
-iedModel_SE_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_minVal_f.mmsValue = MmsValue_newFloat(1.9999999);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(600);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_SecHGndDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_SecHGndDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_ND_PTOC2_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmACrv_setCharact.mmsValue = MmsValue_newIntegerFromInt32(9);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(1200.0);
-
-iedModel_SE_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(1.9999999);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_minVal_f.mmsValue = MmsValue_newFloat(0.05);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_maxVal_f.mmsValue = MmsValue_newFloat(15.0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TmMult_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_TypRsCrv_setVal.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_DskRng_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_SecHGndDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_SecHGndDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051NOCgndB1_NI_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051OC3phase1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051OC3phase1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_5051OC3phase1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_5051OC3phase1_PTRC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_PTRC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_PTRC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051OC3phase1_PTRC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(300.0);
-
-iedModel_SE_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(1200);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(500.0);
-
-iedModel_SE_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(600);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(100000);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_ID_PTOC2_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmACrv_setCharact.mmsValue = MmsValue_newIntegerFromInt32(9);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(126.0);
-
-iedModel_SE_VI3p1_5051OC3phase1_II_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(0.28);
-
-iedModel_SE_VI3p1_5051OC3phase1_II_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_minVal_f.mmsValue = MmsValue_newFloat(0.05);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_maxVal_f.mmsValue = MmsValue_newFloat(15.0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_TmMult_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_TypRsCrv_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_DskRng_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_5051OC3phase1_II_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ArcProtection1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 15:36:54");
-
-iedModel_VI3p1_ArcProtection1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_ArcProtection1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_ArcProtection1_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ArcProtection1_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 15:36:54");
-
-iedModel_VI3p1_ArcProtection1_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(400.0);
-
-iedModel_SE_VI3p1_ArcProtection1_GAPC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_setMag_f.mmsValue = MmsValue_newFloat(200.0);
-
-iedModel_SE_VI3p1_ArcProtection1_GAPC1_StrVal1ph_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_StrVal1ph_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_GAPC1_BlkFct_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_GAPC1_ArcCurDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_GAPC1_SensSup_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_GAPC1_SensSup_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_PTRC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_PTRC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_PTRC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ArcProtection1_PTRC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 15:36:54");
-
-iedModel_VI3p1_ArcProtection1_SARC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ArcProtection1_SARC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 15:36:54");
-
-iedModel_VI3p1_ArcProtection1_SARC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_ArcProtection1_SARC1_FACntRs_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC1_FACntRs_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_FACntRs_maxVal.mmsValue = MmsValue_newIntegerFromInt32(9999);
-
-iedModel_VI3p1_ArcProtection1_SARC1_ExtInArc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_ExtCurrent_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_Str_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_Op_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_ArcLigDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_OpMode_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_OpMode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_UseExtArc_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_UseExtArc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_SensType_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_SensType_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(-20.0);
-
-iedModel_SE_VI3p1_ArcProtection1_SARC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(79);
-
-iedModel_VI3p1_ArcProtection1_SARC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(-34.0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(-10.0);
-
-iedModel_VI3p1_ArcProtection1_SARC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_ArcProtection1_SARC1_StrVal_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ArcProtection1_SARC2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 15:36:54");
-
-iedModel_VI3p1_ArcProtection1_SARC2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_ArcProtection1_SARC2_FACntRs_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC2_FACntRs_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC2_FACntRs_maxVal.mmsValue = MmsValue_newIntegerFromInt32(9999);
-
-iedModel_VI3p1_ArcProtection1_SARC2_ExtInArc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_ExtCurrent_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_Str_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_Op_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_ArcLigDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_OpMode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC2_OpMode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_ArcProtection1_SARC2_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC2_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_UseExtArc_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC2_UseExtArc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_SensType_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC2_SensType_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(-20.0);
-
-iedModel_SE_VI3p1_ArcProtection1_SARC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_ArcProtection1_SARC2_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(79);
-
-iedModel_VI3p1_ArcProtection1_SARC2_StrVal_minVal_f.mmsValue = MmsValue_newFloat(-34.0);
-
-iedModel_VI3p1_ArcProtection1_SARC2_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(-10.0);
-
-iedModel_VI3p1_ArcProtection1_SARC2_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_ArcProtection1_SARC2_StrVal_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ArcProtection1_SARC3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 15:36:54");
-
-iedModel_VI3p1_ArcProtection1_SARC3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_ArcProtection1_SARC3_FACntRs_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC3_FACntRs_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC3_FACntRs_maxVal.mmsValue = MmsValue_newIntegerFromInt32(9999);
-
-iedModel_VI3p1_ArcProtection1_SARC3_ExtInArc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_ExtCurrent_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_Str_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_Op_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_ArcLigDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_OpMode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ArcProtection1_SARC3_OpMode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_ArcProtection1_SARC3_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC3_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_UseExtArc_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC3_UseExtArc_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_SensType_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ArcProtection1_SARC3_SensType_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ArcProtection1_SARC3_StrVal_setMag_f.mmsValue = MmsValue_newFloat(-20.0);
-
-iedModel_SE_VI3p1_ArcProtection1_SARC3_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_ArcProtection1_SARC3_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(79);
-
-iedModel_VI3p1_ArcProtection1_SARC3_StrVal_minVal_f.mmsValue = MmsValue_newFloat(-34.0);
-
-iedModel_VI3p1_ArcProtection1_SARC3_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(-10.0);
-
-iedModel_VI3p1_ArcProtection1_SARC3_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_ArcProtection1_SARC3_StrVal_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_Energy_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_Energy_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_Energy_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_Energy_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_Energy_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(72);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(6);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_pulsQty.mmsValue = MmsValue_newFloat(1.2008885E-4);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_frEna.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_frPd.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupWh_frRs.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(73);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(6);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_pulsQty.mmsValue = MmsValue_newFloat(1.2008885E-4);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_frEna.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_frPd.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SupVArh_frRs.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(72);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(6);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_pulsQty.mmsValue = MmsValue_newFloat(1.2008885E-4);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_frEna.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_frPd.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdWh_frRs.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(73);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(6);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_pulsQty.mmsValue = MmsValue_newFloat(1.2008885E-4);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_frEna.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_frPd.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_DmdVArh_frRs.mmsValue = MmsValue_newBoolean(false);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_mxVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_SBOw_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_Oper_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupWh_Cancel_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_mxVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_SBOw_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_Oper_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetSupVArh_Cancel_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_mxVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_SBOw_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_Oper_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdWh_Cancel_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_mxVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_sboTimeout.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_sboClass.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_minVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_SBOw_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_Oper_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_Energy_XPRE_MMTR1_SetDmdVArh_Cancel_ctlVal_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_FundSymComp_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_FundSymComp_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_FundSymComp_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_FundSymComp_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_FundSymComp_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsAB_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsBC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PPV_phsCA_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsA_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsB_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_phsC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_db.mmsValue = MmsValue_newUnsignedFromUint32(20000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_PhV_res_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsA_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsB_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_phsC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_db.mmsValue = MmsValue_newUnsignedFromUint32(100000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_A_res_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_ClcMth_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_ClcMth_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_VneutC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXU1_AneutC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ClcMth_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ClcMth_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VxC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VsynxC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_ANparLnC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AstarPtC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_AxC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_VneutC_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_FPRE_MMXN1_Vseq0_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c1_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c2_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqA_c3_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c1_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c2_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_instCVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_cVal_ang_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_SeqV_c3_dbAng.mmsValue = MmsValue_newUnsignedFromUint32(333);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_ClcMth_setVal.mmsValue = MmsValue_newIntegerFromInt32(4);
-
-iedModel_VI3p1_FundSymComp_XPRE_MSQI1_ClcMth_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_OperationalValues_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_OperationalValues_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_OperationalValues_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_OperationalValues_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_OperationalValues_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_OperationalValues_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsAB_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsBC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PPV_phsCA_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_PhV_res_db.mmsValue = MmsValue_newUnsignedFromUint32(20000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_A_res_db.mmsValue = MmsValue_newUnsignedFromUint32(100000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_ClcMth_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_ClcMth_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(29);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_db.mmsValue = MmsValue_newUnsignedFromUint32(2000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Vneut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXU1_Aneut_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ClcMth_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ClcMth_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_ANparLn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_RPRE_MMXN1_AstarPt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(38);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotW_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(63);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVAr_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(61);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotVA_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(65);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_TotPF_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(33);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_Hz_db.mmsValue = MmsValue_newUnsignedFromUint32(100);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(38);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(38);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(38);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_W_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(63);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(63);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(63);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VAr_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(61);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsA_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(61);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsB_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_instCVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_cVal_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(61);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_units_multiplier.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_VA_phsC_db.mmsValue = MmsValue_newUnsignedFromUint32(10000);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_ClcMth_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_VI3p1_OperationalValues_PPRE_MMXU1_ClcMth_dataNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_ProcessMonitor_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ProcessMonitor_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_ProcessMonitor_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_ProcessMonitor_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ProcessMonitor_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ProcessMonitor_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ProcessMonitor_PROM_ROPA1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2022-11-28 11:34:54");
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_DisCntrOpn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ProcessMonitor_PROM_RSSR1_SwitchOn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ExternalTrip1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ExternalTrip1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ExternalTrip1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ExternalTrip1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-20 15:49:16");
-
-iedModel_VI3p1_ExternalTrip1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_ExternalTrip1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-20 15:49:16");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Str_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_ExtIn_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_ExternalTrip1_EXT_PSCH1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67DirOC3phB1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67DirOC3phB1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_67DirOC3phB1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_DirDeterm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_DirTstRslt_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_setVal.mmsValue = MmsValue_newIntegerFromInt32(45);
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_minVal.mmsValue = MmsValue_newIntegerFromInt32(-180);
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_maxVal.mmsValue = MmsValue_newIntegerFromInt32(180);
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(9);
-
-iedModel_VI3p1_67DirOC3phB1_GAPC1_RotAng_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_PTRC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_PTRC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_PTRC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67DirOC3phB1_PTRC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(300.0);
-
-iedModel_SE_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(210);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_DirMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkVMeasLs_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_BlkVMeasLs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(400.0);
-
-iedModel_SE_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(100);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_DirMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkVMeasLs_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_BlkVMeasLs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DID_PTOC2_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmACrv_setCharact.mmsValue = MmsValue_newIntegerFromInt32(9);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(126.0);
-
-iedModel_SE_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(0.2);
-
-iedModel_SE_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_minVal_f.mmsValue = MmsValue_newFloat(0.05);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_maxVal_f.mmsValue = MmsValue_newFloat(15.0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TmMult_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_TypRsCrv_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_DirMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_DskRng_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkVMeasLs_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_BlkVMeasLs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_InrushDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_InrushDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67DirOC3phB1_DII_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67NDirOCgndB1_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67NDirOCgndB1_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_VI3p1_67NDirOCgndB1_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@VI3p1");
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_Direction_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_minVal.mmsValue = MmsValue_newIntegerFromInt32(-180);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_maxVal.mmsValue = MmsValue_newIntegerFromInt32(180);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(9);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_RotAng_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_instMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_mag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_db.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_UIAngle_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_GAPC1_DirDeterm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_PTRC1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_PTRC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_PTRC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67NDirOCgndB1_PTRC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(10.0);
-
-iedModel_SE_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(1000);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_DirMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkStg_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkVMeasLs_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_BlkVMeasLs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_InrBlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_InrBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_SecHGndDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_SecHGndDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNDB_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(26.0);
-
-iedModel_SE_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_setVal.mmsValue = MmsValue_newIntegerFromInt32(200);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_minVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_maxVal.mmsValue = MmsValue_newIntegerFromInt32(60000);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpDlTmms_stepSize.mmsValue = MmsValue_newUnsignedFromUint32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_DirMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkStg_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkVMeasLs_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_BlkVMeasLs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_InrBlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_InrBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_SecHGndDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_SecHGndDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_NBD_PTOC2_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2023-09-29 14:51:58");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmACrv_setCharact.mmsValue = MmsValue_newIntegerFromInt32(9);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(240.00002);
-
-iedModel_SE_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_units_SIUnit.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_minVal_f.mmsValue = MmsValue_newFloat(6.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_maxVal_f.mmsValue = MmsValue_newFloat(7000.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_StrVal_stepSize_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(1.0);
-
-iedModel_SE_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_setMag_f.mmsValue = MmsValue_newFloat(0.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_minVal_f.mmsValue = MmsValue_newFloat(0.05);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_maxVal_f.mmsValue = MmsValue_newFloat(15.0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TmMult_stepSize_f.mmsValue = MmsValue_newFloat(0.01);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_TypRsCrv_setVal.mmsValue = MmsValue_newIntegerFromInt32(3);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_DirMod_setVal.mmsValue = MmsValue_newIntegerFromInt32(2);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkStg_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkOpDlTm_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Inactive_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_InrshBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_DskRng_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_OpTmExp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Mode_setVal.mmsValue = MmsValue_newIntegerFromInt32(5);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_Mode_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkVMeasLs_setVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_BlkVMeasLs_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_InrBlkOp_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_InrBlkOp_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_SecHGndDet_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_SecHGndDet_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_MeasMethod_setVal.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_VI3p1_67NDirOCgndB1_DNIB_PTOC1_MeasMethod_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_ComSupervision_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_ComSupervision_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_ComSupervision_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_ComSupervision_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-28 14:17:39");
-
-iedModel_ComSupervision_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_ComSupervision_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@Application");
-
-iedModel_ComSupervision_GOOSE_LLN0_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_ComSupervision_GOOSE_LLN0_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_ComSupervision_GOOSE_LLN0_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_ComSupervision_GOOSE_LLN0_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-28 14:17:39");
-
-iedModel_ComSupervision_GOOSE_LLN0_NamPlt_ldNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007");
-
-iedModel_ComSupervision_GOOSE_LLN0_GrRef_setSrcRef.mmsValue = MmsValue_newVisibleString("@ComSupervision");
-
-iedModel_ComSupervision_GOOSE_CALH1_Mod_stVal.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_ComSupervision_GOOSE_CALH1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(0);
-
-iedModel_ComSupervision_GOOSE_CALH1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_ComSupervision_GOOSE_CALH1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-28 14:17:39");
-
-iedModel_ComSupervision_GOOSE_CALH1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_ComSupervision_GOOSE_LGOS1_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_ComSupervision_GOOSE_LGOS1_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_ComSupervision_GOOSE_LGOS1_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-28 14:17:39");
-
-iedModel_ComSupervision_GOOSE_LGOS1_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_ComSupervision_GOOSE_LGOS1_GoCBRef_setSrcRef.mmsValue = MmsValue_newVisibleString("GPS01GPC01UPM01FCB02CB1/LLN0.Control_DataSet");
-
-iedModel_ComSupervision_GOOSE_LGOS1_DiagErr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_ComSupervision_GOOSE_LGOS2_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_ComSupervision_GOOSE_LGOS2_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_ComSupervision_GOOSE_LGOS2_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-29 07:09:22");
-
-iedModel_ComSupervision_GOOSE_LGOS2_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_ComSupervision_GOOSE_LGOS2_GoCBRef_setSrcRef.mmsValue = MmsValue_newVisibleString("GPS01GCB01VI3p1_ArcProtection1/LLN0.Control_DataSet");
-
-iedModel_ComSupervision_GOOSE_LGOS2_DiagErr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
-
-iedModel_ComSupervision_GOOSE_LGOS3_Mod_ctlModel.mmsValue = MmsValue_newIntegerFromInt32(1);
-
-iedModel_ComSupervision_GOOSE_LGOS3_NamPlt_vendor.mmsValue = MmsValue_newVisibleString("SIEMENS");
-
-iedModel_ComSupervision_GOOSE_LGOS3_NamPlt_configRev.mmsValue = MmsValue_newVisibleString("2025-04-29 07:09:22");
-
-iedModel_ComSupervision_GOOSE_LGOS3_NamPlt_lnNs.mmsValue = MmsValue_newVisibleString("IEC 61850-7-4:2007B");
-
-iedModel_ComSupervision_GOOSE_LGOS3_GoCBRef_setSrcRef.mmsValue = MmsValue_newVisibleString("GPS01GPC01UPM01MCB01CB1/LLN0.Control_DataSet");
-
-iedModel_ComSupervision_GOOSE_LGOS3_DiagErr_dataNs.mmsValue = MmsValue_newVisibleString("SIPROTEC5");
+    for (size_t i = 0; i < sizeof(iedInitialValues) / sizeof(iedInitialValues[0]); i++) {
+        const IedInitialValue* init = &iedInitialValues[i];
+
+        switch (init->kind) {
+        case IED_INIT_STRING:
+            init->attribute->mmsValue = MmsValue_newVisibleString(iedInitStrings[init->value.s]);
+            break;
+        case IED_INIT_INT32:
+            init->attribute->mmsValue = MmsValue_newIntegerFromInt32(init->value.i);
+            break;
+        case IED_INIT_UINT32:
+            init->attribute->mmsValue = MmsValue_newUnsignedFromUint32(init->value.u);
+            break;
+        case IED_INIT_FLOAT:
+            init->attribute->mmsValue = MmsValue_newFloat(init->value.f);
+            break;
+        case IED_INIT_BOOLEAN:
+            init->attribute->mmsValue = MmsValue_newBoolean(init->value.b);
+            break;
+        }
+    }
 }
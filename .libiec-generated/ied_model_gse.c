@@ -0,0 +1,28 @@
+/*
+ * GOOSE control blocks of GPS01GPC01UPM01FCB01 missing from ied_model.c
+ *
+ * generated by scripts/gse-iec-model.cjs
+ */
+
+#include "ied_model.h"
+
+extern GSEControlBlock iedModel_Application_LLN0_gse0;
+extern GSEControlBlock iedModel_VI3p1_ArcProtection1_LLN0_gse0;
+
+static PhyComAddress iedModel_Application_LLN0_gse0_address = {
+  4,
+  0,
+  147,
+  {0x1, 0xc, 0xcd, 0x1, 0x0, 0x7c}
+};
+
+GSEControlBlock iedModel_Application_LLN0_gse0 = {&iedModel_Application_LLN0, "Control_DataSet", "GPS01GPC01UPM01FCB01/Application/LLN0/Control_DataSet", "GPS01GPC01FCB01", 70001, false, &iedModel_Application_LLN0_gse0_address, 4, 1000, &iedModel_VI3p1_ArcProtection1_LLN0_gse0};
+
+static PhyComAddress iedModel_VI3p1_ArcProtection1_LLN0_gse0_address = {
+  4,
+  0,
+  6,
+  {0x1, 0xc, 0xcd, 0x1, 0x0, 0x7a}
+};
+
+GSEControlBlock iedModel_VI3p1_ArcProtection1_LLN0_gse0 = {&iedModel_VI3p1_ArcProtection1_LLN0, "Control_DataSet", "GPS01GPC01UPM01FCB01/VI3p1_ArcProtection1/LLN0/Control_DataSet", "GPS01GPC01FCB01", 40001, false, &iedModel_VI3p1_ArcProtection1_LLN0_gse0_address, 4, 1000, NULL};
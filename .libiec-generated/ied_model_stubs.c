@@ -1,3 +0,0 @@
-#include "iec61850_model.h"
-/* Workaround for generator output referencing missing GoCB symbol in some SCD files */
-GSEControlBlock iedModel_Application_LLN0_gse0 = {0};
@@ -0,0 +1,149 @@
+// Post-processes genmodel output (ied_model.c) to make backend start-up cheaper.
+//
+// genmodel emits initializeValues() as one MmsValue_new*() statement per
+// attribute, repeating the same NamPlt/configRev/lnNs literals per LN. This
+// rewrites the simple constructor statements into one static table walked by
+// a loop, with every string folded into a single interned read-only pool.
+// Statements it does not recognise are kept verbatim after the loop.
+//
+// Usage: node scripts/compact-iec-model.cjs <ied_model.c>
+
+const fs = require('fs');
+
+const MARKER = '/* initial values compacted by scripts/compact-iec-model.cjs */';
+
+const KINDS = {
+  VisibleString: { id: 'IED_INIT_STRING', field: 's' },
+  IntegerFromInt32: { id: 'IED_INIT_INT32', field: 'i' },
+  UnsignedFromUint32: { id: 'IED_INIT_UINT32', field: 'u' },
+  Float: { id: 'IED_INIT_FLOAT', field: 'f' },
+  Boolean: { id: 'IED_INIT_BOOLEAN', field: 'b' }
+};
+
+const STATEMENT = /^(\w+)\.mmsValue = MmsValue_new(VisibleString|IntegerFromInt32|UnsignedFromUint32|Float|Boolean)\((.*)\);$/;
+
+function compact(source) {
+  if (source.includes(MARKER)) return null;
+
+  const head = source.indexOf('\nstatic void\ninitializeValues()\n{\n');
+  if (head < 0) throw new Error('initializeValues() not found');
+
+  const bodyStart = source.indexOf('{\n', head) + 2;
+  const bodyEnd = source.lastIndexOf('\n}');
+  if (bodyEnd < bodyStart) throw new Error('initializeValues() body not found');
+
+  const strings = new Map();
+  const entries = [];
+  const kept = [];
+
+  for (const line of source.substring(bodyStart, bodyEnd).split('\n')) {
+    const match = STATEMENT.exec(line.trim());
+    if (!match) {
+      if (line.trim()) kept.push(line);
+      continue;
+    }
+
+    const [, attribute, constructor, argument] = match;
+    const kind = KINDS[constructor];
+    let value = argument;
+
+    if (constructor === 'VisibleString') {
+      if (!/^"([^"\\]|\\.)*"$/.test(argument)) {
+        kept.push(line);
+        continue;
+      }
+      if (!strings.has(argument)) strings.set(argument, strings.size);
+      value = String(strings.get(argument));
+    }
+
+    entries.push(`    { &${attribute}, ${kind.id}, { .${kind.field} = ${value} } }`);
+  }
+
+  if (entries.length === 0) return null;
+
+  const pool = [...strings.keys()].map((literal) => `    ${literal}`);
+
+  const table = `${MARKER}
+
+typedef enum {
+    IED_INIT_STRING,
+    IED_INIT_INT32,
+    IED_INIT_UINT32,
+    IED_INIT_FLOAT,
+    IED_INIT_BOOLEAN
+} IedInitKind;
+
+typedef struct {
+    DataAttribute* attribute;
+    uint8_t kind;
+    union {
+        uint16_t s;
+        int32_t i;
+        uint32_t u;
+        float f;
+        bool b;
+    } value;
+} IedInitialValue;
+
+/* ${strings.size} unique strings shared by ${entries.filter((e) => e.includes('IED_INIT_STRING')).length} attributes */
+static const char* const iedInitStrings[] = {
+${pool.join(',\n')}
+};
+
+static const IedInitialValue iedInitialValues[] = {
+${entries.join(',\n')}
+};
+
+static void
+initializeValues()
+{
+    for (size_t i = 0; i < sizeof(iedInitialValues) / sizeof(iedInitialValues[0]); i++) {
+        const IedInitialValue* init = &iedInitialValues[i];
+
+        switch (init->kind) {
+        case IED_INIT_STRING:
+            init->attribute->mmsValue = MmsValue_newVisibleString(iedInitStrings[init->value.s]);
+            break;
+        case IED_INIT_INT32:
+            init->attribute->mmsValue = MmsValue_newIntegerFromInt32(init->value.i);
+            break;
+        case IED_INIT_UINT32:
+            init->attribute->mmsValue = MmsValue_newUnsignedFromUint32(init->value.u);
+            break;
+        case IED_INIT_FLOAT:
+            init->attribute->mmsValue = MmsValue_newFloat(init->value.f);
+            break;
+        case IED_INIT_BOOLEAN:
+            init->attribute->mmsValue = MmsValue_newBoolean(init->value.b);
+            break;
+        }
+    }
+${kept.length ? '\n' + kept.join('\n') + '\n' : ''}}
+`;
+
+  return {
+    output: source.substring(0, head + 1) + table,
+    entries: entries.length,
+    strings: strings.size,
+    kept: kept.length
+  };
+}
+
+function main() {
+  const file = process.argv[2];
+  if (!file) {
+    console.error('usage: node scripts/compact-iec-model.cjs <ied_model.c>');
+    process.exit(1);
+  }
+
+  const result = compact(fs.readFileSync(file, 'utf8'));
+  if (!result) {
+    console.log(`[compact-iec-model] ${file} already compact`);
+    return;
+  }
+
+  fs.writeFileSync(file, result.output);
+  console.log(`[compact-iec-model] ${file}: ${result.entries} initial values, ${result.strings} unique strings, ${result.kept} statements kept`);
+}
+
+main();
@@ -0,0 +1,1192 @@
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "iec61850_client.h"
+#include "hal_thread.h"
+
+/*
+ * Bridge replay and benchmark harness for dubgg_libiec_server.
+ *
+ *   dubgg_libiec_bench [options] <server binary> [server args...]
+ *
+ * Starts the backend as `<server binary> <port> [server args...]`, switches
+ * its stdin bridge to the binary protocol and feeds it updates, either a
+ * synthetic sweep over every handle of the table or a recorded trace
+ * (RELAY_IEC_TRACE_FILE of the relay: "<ms> <ref>=<value>" per line).
+ * Meanwhile N MMS clients either enable a URCB each and time every data
+ * change from the frame that caused it to the report (report mode), or
+ * read the data sets of those URCBs in a loop (read mode). A separate
+ * connection operates one control at a fixed interval and times both the
+ * operate response and the CONTROL_UPDATE line on the bridge.
+ *
+ * Summary lines go to stdout; the last one is a single BENCH line of
+ * key=value pairs for scripts.
+ */
+
+#define BENCH_LINE_MAX 512
+#define BENCH_MAX_CLIENTS 64
+#define BENCH_HIST_BUCKETS (64 * 8)
+
+#define BRIDGE_OP_UPDATE 0x01
+#define BRIDGE_OP_BEGIN 0x02
+#define BRIDGE_OP_COMMIT 0x03
+
+enum {
+    BRIDGE_TYPE_BOOLEAN = 1,
+    BRIDGE_TYPE_INT32 = 2,
+    BRIDGE_TYPE_UINT32 = 3,
+    BRIDGE_TYPE_FLOAT = 4,
+    BRIDGE_TYPE_DBPOS = 9
+};
+
+typedef enum {
+    BENCH_MODE_REPORT,
+    BENCH_MODE_READ
+} BenchMode;
+
+typedef struct {
+    int port;
+    double rate;   /* updates per second, 0 for as fast as possible */
+    double seconds;
+    int batch;
+    int clients;
+    BenchMode mode;
+    const char* trace;
+    const char* rcbFilter;   /* LD name or RCB reference prefix */
+    const char* control;     /* control object reference */
+    int controlIntervalMs;   /* 0 disables the control probe */
+} BenchOptions;
+
+// --- Histograms ---
+
+/* Log-linear histogram of microseconds: 8 sub-buckets per power of two */
+typedef struct {
+    atomic_ullong buckets[BENCH_HIST_BUCKETS];
+    atomic_ullong count;
+    atomic_ullong maxUs;
+} Histogram;
+
+static int
+histogram_bucket(uint64_t us)
+{
+    if (us < 8)
+        return (int) us;
+
+    int log2 = 63 - __builtin_clzll(us);
+    int sub = (int) ((us >> (log2 - 3)) & 7);
+
+    return (log2 - 2) * 8 + sub;
+}
+
+static uint64_t
+histogram_bucket_value(int bucket)
+{
+    if (bucket < 8)
+        return (uint64_t) bucket;
+
+    int log2 = bucket / 8 + 2;
+
+    return ((uint64_t) (8 + bucket % 8)) << (log2 - 3);
+}
+
+static void
+histogram_add(Histogram* hist, uint64_t us)
+{
+    int bucket = histogram_bucket(us);
+
+    if (bucket >= BENCH_HIST_BUCKETS)
+        bucket = BENCH_HIST_BUCKETS - 1;
+
+    atomic_fetch_add_explicit(&hist->buckets[bucket], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&hist->count, 1, memory_order_relaxed);
+
+    unsigned long long seen = atomic_load_explicit(&hist->maxUs, memory_order_relaxed);
+
+    while ((us > seen) && !atomic_compare_exchange_weak(&hist->maxUs, &seen, us))
+        ;
+}
+
+static uint64_t
+histogram_percentile(Histogram* hist, double percentile)
+{
+    unsigned long long count = atomic_load(&hist->count);
+
+    if (count == 0)
+        return 0;
+
+    unsigned long long rank = (unsigned long long) (percentile / 100.0 * (double) (count - 1)) + 1;
+    unsigned long long seen = 0;
+
+    for (int i = 0; i < BENCH_HIST_BUCKETS; i++) {
+        seen += atomic_load(&hist->buckets[i]);
+
+        if (seen >= rank)
+            return histogram_bucket_value(i);
+    }
+
+    return atomic_load(&hist->maxUs);
+}
+
+static void
+histogram_print(const char* label, Histogram* hist)
+{
+    printf("%s: %llu samples, p50 %llu us, p99 %llu us, max %llu us\n", label, (unsigned long long) atomic_load(&hist->count),
+            (unsigned long long) histogram_percentile(hist, 50), (unsigned long long) histogram_percentile(hist, 99),
+            (unsigned long long) atomic_load(&hist->maxUs));
+}
+
+// --- Backend Process ---
+
+typedef struct {
+    int handle;
+    int type;
+    char* reference;
+} BenchHandle;
+
+typedef struct {
+    int id;
+    char* reference;
+} BenchControl;
+
+static pid_t gServerPid = -1;
+static FILE* gServerIn = NULL;
+static FILE* gServerOut = NULL;
+static BenchHandle* gHandles = NULL;
+static int gHandleCount = 0;
+static BenchControl* gControls = NULL;
+static int gControlCount = 0;
+static _Atomic(uint64_t)* gSentNs = NULL; /* per handle, monotonic time of the last frame sent */
+static atomic_ullong gBridgeErrors;
+static atomic_ullong gControlEvents;
+static _Atomic(uint64_t) gControlEventNs;
+static atomic_int gProtoBinary;
+static atomic_int gRunning;
+
+static uint64_t
+monotonic_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+}
+
+static bool
+start_server(char** argv, int argc, int port)
+{
+    int toServer[2], fromServer[2];
+
+    if ((pipe(toServer) != 0) || (pipe(fromServer) != 0)) {
+        perror("pipe");
+        return false;
+    }
+
+    gServerPid = fork();
+
+    if (gServerPid < 0) {
+        perror("fork");
+        return false;
+    }
+
+    if (gServerPid == 0) {
+        char portText[16];
+        char** args = (char**) calloc((size_t) argc + 2, sizeof(char*));
+
+        snprintf(portText, sizeof(portText), "%d", port);
+        args[0] = argv[0];
+        args[1] = portText;
+        for (int i = 1; i < argc; i++)
+            args[i + 1] = argv[i];
+
+        dup2(toServer[0], STDIN_FILENO);
+        dup2(fromServer[1], STDOUT_FILENO);
+        close(toServer[1]);
+        close(fromServer[0]);
+        execv(args[0], args);
+        perror(args[0]);
+        _exit(127);
+    }
+
+    close(toServer[0]);
+    close(fromServer[1]);
+    gServerIn = fdopen(toServer[1], "w");
+    gServerOut = fdopen(fromServer[0], "r");
+    setvbuf(gServerIn, NULL, _IOFBF, 64 * 1024);
+
+    return (gServerIn != NULL) && (gServerOut != NULL);
+}
+
+static void
+stop_server(void)
+{
+    if (gServerIn) {
+        fclose(gServerIn);
+        gServerIn = NULL;
+    }
+
+    if (gServerPid > 0) {
+        kill(gServerPid, SIGTERM);
+        waitpid(gServerPid, NULL, 0);
+        gServerPid = -1;
+    }
+}
+
+/* Startup lines up to the "server started" line: the control table */
+static bool
+read_startup(void)
+{
+    char line[BENCH_LINE_MAX];
+
+    while (fgets(line, sizeof(line), gServerOut)) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        int id;
+        char ref[BENCH_LINE_MAX];
+
+        if (sscanf(line, "BRIDGE_CONTROL %d %511s", &id, ref) == 2) {
+            gControls = (BenchControl*) realloc(gControls, (size_t) (gControlCount + 1) * sizeof(BenchControl));
+            gControls[gControlCount].id = id;
+            gControls[gControlCount].reference = strdup(ref);
+            gControlCount++;
+            continue;
+        }
+
+        if (strncmp(line, "IEC 61850 server started", 24) == 0)
+            return true;
+
+        if (strncmp(line, "BRIDGE_", 7) != 0)
+            fprintf(stderr, "[server] %s\n", line);
+    }
+
+    return false;
+}
+
+/* Handle table, then everything the backend reports while the run lasts */
+static void*
+server_reader_thread(void* arg)
+{
+    (void) arg;
+    char line[BENCH_LINE_MAX];
+
+    while (fgets(line, sizeof(line), gServerOut)) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        if (strncmp(line, "BRIDGE_HANDLE ", 14) == 0) {
+            int handle, type;
+            char ref[BENCH_LINE_MAX];
+
+            if (sscanf(line + 14, "%d %d %511s", &handle, &type, ref) == 3) {
+                gHandles = (BenchHandle*) realloc(gHandles, (size_t) (gHandleCount + 1) * sizeof(BenchHandle));
+                gHandles[gHandleCount].handle = handle;
+                gHandles[gHandleCount].type = type;
+                gHandles[gHandleCount].reference = strdup(ref);
+                gHandleCount++;
+            }
+        }
+        else if (strcmp(line, "BRIDGE_PROTO binary") == 0) {
+            atomic_store(&gProtoBinary, 1);
+        }
+        else if (strncmp(line, "CONTROL_UPDATE ", 15) == 0) {
+            atomic_store(&gControlEventNs, monotonic_ns());
+            atomic_fetch_add(&gControlEvents, 1);
+        }
+        else if (strncmp(line, "BRIDGE_ERR", 10) == 0) {
+            if (atomic_fetch_add(&gBridgeErrors, 1) < 5)
+                fprintf(stderr, "[server] %s\n", line);
+        }
+    }
+
+    return NULL;
+}
+
+static const BenchHandle*
+find_handle(const char* ref)
+{
+    for (int i = 0; i < gHandleCount; i++) {
+        if (strcmp(gHandles[i].reference, ref) == 0)
+            return &gHandles[i];
+    }
+
+    return NULL;
+}
+
+// --- Update Source ---
+
+typedef struct {
+    const BenchHandle* handle;
+    double value;
+    uint64_t offsetMs; /* trace time, 0 for the synthetic sweep */
+} BenchUpdate;
+
+static BenchUpdate* gUpdates = NULL;
+static int gUpdateCount = 0;
+
+static bool
+benchable_type(int type)
+{
+    return (type == BRIDGE_TYPE_BOOLEAN) || (type == BRIDGE_TYPE_INT32) || (type == BRIDGE_TYPE_UINT32) ||
+           (type == BRIDGE_TYPE_FLOAT) || (type == BRIDGE_TYPE_DBPOS);
+}
+
+static void
+add_update(const BenchHandle* handle, double value, uint64_t offsetMs)
+{
+    gUpdates = (BenchUpdate*) realloc(gUpdates, (size_t) (gUpdateCount + 1) * sizeof(BenchUpdate));
+    gUpdates[gUpdateCount].handle = handle;
+    gUpdates[gUpdateCount].value = value;
+    gUpdates[gUpdateCount].offsetMs = offsetMs;
+    gUpdateCount++;
+}
+
+/* Every numeric handle once, optionally only those under one of `prefixes` */
+static void
+build_synthetic_updates(char** prefixes, int prefixCount)
+{
+    for (int i = 0; i < gHandleCount; i++) {
+        const BenchHandle* handle = &gHandles[i];
+
+        if (!benchable_type(handle->type))
+            continue;
+
+        bool wanted = (prefixCount == 0);
+
+        for (int p = 0; !wanted && (p < prefixCount); p++) {
+            size_t len = strlen(prefixes[p]);
+            char next = handle->reference[len];
+
+            wanted = (strncmp(handle->reference, prefixes[p], len) == 0) && ((next == 0) || (next == '.'));
+        }
+
+        // Skip quality, timestamps and control configuration: the sweep should drive values
+        const char* leaf = strrchr(handle->reference, '.');
+
+        if (!wanted || (leaf && ((strcmp(leaf, ".q") == 0) || (strcmp(leaf, ".t") == 0) || (strcmp(leaf, ".ctlNum") == 0) ||
+                                        (strcmp(leaf, ".ctlModel") == 0))))
+            continue;
+
+        add_update(handle, 0, 0);
+    }
+}
+
+static bool
+parse_trace_value(int type, const char* text, double* value)
+{
+    if ((strcmp(text, "true") == 0) || (strcmp(text, "on") == 0)) {
+        *value = (type == BRIDGE_TYPE_DBPOS) ? 2 : 1;
+        return true;
+    }
+
+    if ((strcmp(text, "false") == 0) || (strcmp(text, "off") == 0)) {
+        *value = (type == BRIDGE_TYPE_DBPOS) ? 1 : 0;
+        return true;
+    }
+
+    char* end;
+
+    *value = strtod(text, &end);
+
+    return (end != text) && (*end == 0);
+}
+
+static bool
+load_trace(const char* file)
+{
+    FILE* in = fopen(file, "r");
+
+    if (in == NULL) {
+        fprintf(stderr, "Failed to open trace %s: %s\n", file, strerror(errno));
+        return false;
+    }
+
+    char line[BENCH_LINE_MAX];
+    int skipped = 0;
+
+    while (fgets(line, sizeof(line), in)) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        unsigned long long offsetMs;
+        int consumed = 0;
+
+        if ((line[0] == '#') || (sscanf(line, "%llu %n", &offsetMs, &consumed) != 1))
+            continue;
+
+        char* ref = line + consumed;
+        char* eq = strchr(ref, '=');
+
+        if (eq == NULL)
+            continue;
+
+        *eq = 0;
+
+        const BenchHandle* handle = find_handle(ref);
+        double value;
+
+        if ((handle == NULL) || !benchable_type(handle->type) || !parse_trace_value(handle->type, eq + 1, &value)) {
+            skipped++;
+            continue;
+        }
+
+        add_update(handle, value, offsetMs);
+    }
+
+    fclose(in);
+
+    printf("Trace %s: %d updates, %d skipped (unknown reference or non-numeric)\n", file, gUpdateCount, skipped);
+
+    return gUpdateCount > 0;
+}
+
+static size_t
+encode_update(uint8_t* out, const BenchHandle* handle, double value)
+{
+    size_t valueLen = ((handle->type == BRIDGE_TYPE_BOOLEAN) || (handle->type == BRIDGE_TYPE_DBPOS)) ? 1 : 4;
+    size_t frameLen = 1 + 4 + 1 + 1 + valueLen;
+    uint32_t bits = 0;
+
+    out[0] = (uint8_t) frameLen;
+    out[1] = (uint8_t) (frameLen >> 8);
+    out[2] = BRIDGE_OP_UPDATE;
+    out[3] = (uint8_t) handle->handle;
+    out[4] = (uint8_t) (handle->handle >> 8);
+    out[5] = (uint8_t) (handle->handle >> 16);
+    out[6] = (uint8_t) (handle->handle >> 24);
+    out[7] = (uint8_t) handle->type;
+    out[8] = 0;
+
+    switch (handle->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        out[9] = (value != 0);
+        break;
+    case BRIDGE_TYPE_DBPOS:
+        out[9] = (uint8_t) value;
+        break;
+    case BRIDGE_TYPE_FLOAT: {
+        float f = (float) value;
+        memcpy(&bits, &f, 4);
+        break;
+    }
+    default:
+        bits = (uint32_t) (int32_t) value;
+        break;
+    }
+
+    if (valueLen == 4) {
+        out[9] = (uint8_t) bits;
+        out[10] = (uint8_t) (bits >> 8);
+        out[11] = (uint8_t) (bits >> 16);
+        out[12] = (uint8_t) (bits >> 24);
+    }
+
+    return 2 + frameLen;
+}
+
+/* Synthetic values change on every pass so no update is a no-op */
+static double
+synthetic_value(const BenchHandle* handle, uint64_t pass)
+{
+    switch (handle->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        return (double) (pass & 1);
+    case BRIDGE_TYPE_DBPOS:
+        return (pass & 1) ? 2 : 1;
+    case BRIDGE_TYPE_FLOAT:
+        return 100.0 + (double) (pass % 1000) * 10.0;
+    default:
+        // Most integers are enums; 1 and 2 are valid for nearly all of them
+        return (double) (1 + (pass & 1));
+    }
+}
+
+/* Feeds the backend for the configured time; returns the number of updates sent */
+static uint64_t
+run_updates(const BenchOptions* options)
+{
+    uint8_t frame[16];
+    uint64_t startNs = monotonic_ns();
+    uint64_t endNs = startNs + (uint64_t) (options->seconds * 1e9);
+    uint64_t sent = 0, pass = 0;
+    uint64_t traceBaseMs = gUpdates[0].offsetMs;
+    uint64_t passStartNs = startNs;
+    int inBatch = 0;
+    int next = 0;
+    bool replayTiming = (options->trace != NULL) && (options->rate <= 0);
+
+    while (atomic_load(&gRunning)) {
+        uint64_t nowNs = monotonic_ns();
+
+        if (nowNs >= endNs)
+            break;
+
+        // Pace against the schedule: a trace keeps its own timing unless a rate is given
+        uint64_t dueNs;
+
+        if (replayTiming)
+            dueNs = passStartNs + (gUpdates[next].offsetMs - traceBaseMs) * 1000000ull;
+        else if (options->rate > 0)
+            dueNs = startNs + (uint64_t) ((double) sent * 1e9 / options->rate);
+        else
+            dueNs = 0;
+
+        if (dueNs > nowNs) {
+            if (inBatch) {
+                fwrite((uint8_t[]) { 1, 0, BRIDGE_OP_COMMIT }, 1, 3, gServerIn);
+                inBatch = 0;
+            }
+            fflush(gServerIn);
+
+            uint64_t waitNs = dueNs - nowNs;
+            struct timespec pause = { (time_t) (waitNs / 1000000000ull), (long) (waitNs % 1000000000ull) };
+
+            nanosleep(&pause, NULL);
+            continue;
+        }
+
+        if ((options->batch > 1) && (inBatch == 0))
+            fwrite((uint8_t[]) { 1, 0, BRIDGE_OP_BEGIN }, 1, 3, gServerIn);
+
+        const BenchUpdate* update = &gUpdates[next];
+        double value = options->trace ? update->value : synthetic_value(update->handle, pass);
+
+        atomic_store_explicit(&gSentNs[update->handle->handle], monotonic_ns(), memory_order_relaxed);
+        fwrite(frame, 1, encode_update(frame, update->handle, value), gServerIn);
+        sent++;
+
+        if ((options->batch > 1) && (++inBatch == options->batch)) {
+            fwrite((uint8_t[]) { 1, 0, BRIDGE_OP_COMMIT }, 1, 3, gServerIn);
+            inBatch = 0;
+        }
+
+        if (++next == gUpdateCount) {
+            next = 0;
+            pass++;
+            passStartNs = monotonic_ns();
+        }
+    }
+
+    if (inBatch)
+        fwrite((uint8_t[]) { 1, 0, BRIDGE_OP_COMMIT }, 1, 3, gServerIn);
+
+    fflush(gServerIn);
+
+    return sent;
+}
+
+// --- MMS Clients ---
+
+typedef struct {
+    char** prefixes; /* bridge reference prefix per data set member */
+    int* firstHandle; /* for each member: handles[] range */
+    int* handleCounts;
+    int* handles;
+    int memberCount;
+} MemberIndex;
+
+typedef struct {
+    int index;
+    IedConnection connection;
+    char rcbRef[260];
+    char dataSetRef[260];
+    MemberIndex members;
+    Thread thread;
+    atomic_ullong reports;
+    atomic_ullong reads;
+} BenchClient;
+
+static BenchClient gClients[BENCH_MAX_CLIENTS];
+static int gClientCount = 0;
+static Histogram gReportLatency;
+static Histogram gReadLatency;
+static Histogram gControlRtt;
+static Histogram gControlEventLatency;
+
+/* "LD/LN.DO.DA[FC]" from a data set directory into the matching bridge reference prefix */
+static char*
+member_prefix(const char* entry)
+{
+    char* prefix = strdup(entry);
+    char* bracket = strchr(prefix, '[');
+
+    if (bracket)
+        *bracket = 0;
+
+    return prefix;
+}
+
+static void
+index_members(MemberIndex* index, LinkedList directory)
+{
+    int count = LinkedList_size(directory);
+
+    index->prefixes = (char**) calloc((size_t) count, sizeof(char*));
+    index->firstHandle = (int*) calloc((size_t) count, sizeof(int));
+    index->handleCounts = (int*) calloc((size_t) count, sizeof(int));
+    index->handles = NULL;
+    index->memberCount = 0;
+
+    int total = 0;
+
+    for (LinkedList entry = LinkedList_getNext(directory); entry; entry = LinkedList_getNext(entry)) {
+        char* prefix = member_prefix((const char*) LinkedList_getData(entry));
+        size_t len = strlen(prefix);
+        int member = index->memberCount++;
+
+        index->prefixes[member] = prefix;
+        index->firstHandle[member] = total;
+
+        for (int i = 0; i < gHandleCount; i++) {
+            const char* ref = gHandles[i].reference;
+
+            if ((strncmp(ref, prefix, len) == 0) && ((ref[len] == 0) || (ref[len] == '.'))) {
+                index->handles = (int*) realloc(index->handles, (size_t) (total + 1) * sizeof(int));
+                index->handles[total++] = gHandles[i].handle;
+                index->handleCounts[member]++;
+            }
+        }
+    }
+}
+
+static void
+report_handler(void* parameter, ClientReport report)
+{
+    BenchClient* client = (BenchClient*) parameter;
+    uint64_t nowNs = monotonic_ns();
+
+    atomic_fetch_add(&client->reports, 1);
+
+    for (int member = 0; member < client->members.memberCount; member++) {
+        if (ClientReport_getReasonForInclusion(report, member) != IEC61850_REASON_DATA_CHANGE)
+            continue;
+
+        // The newest frame for any attribute of the member is what the report carries
+        uint64_t sentNs = 0;
+        const int* handles = client->members.handles + client->members.firstHandle[member];
+
+        for (int i = 0; i < client->members.handleCounts[member]; i++) {
+            uint64_t t = atomic_load_explicit(&gSentNs[handles[i]], memory_order_relaxed);
+
+            if (t > sentNs)
+                sentNs = t;
+        }
+
+        if ((sentNs > 0) && (nowNs > sentNs))
+            histogram_add(&gReportLatency, (nowNs - sentNs) / 1000);
+    }
+}
+
+static IedConnection
+connect_client(int port)
+{
+    IedClientError error;
+    IedConnection connection = IedConnection_create();
+
+    IedConnection_connect(connection, &error, "127.0.0.1", port);
+
+    if (error != IED_ERROR_OK) {
+        fprintf(stderr, "MMS connect to port %d failed (error %d)\n", port, (int) error);
+        IedConnection_destroy(connection);
+        return NULL;
+    }
+
+    return connection;
+}
+
+/* URCB references of the server, optionally limited to those starting with `filter` */
+static LinkedList
+list_urcbs(IedConnection connection, const char* filter)
+{
+    IedClientError error;
+    LinkedList result = LinkedList_create();
+    LinkedList devices = IedConnection_getLogicalDeviceList(connection, &error);
+
+    if (error != IED_ERROR_OK)
+        return result;
+
+    for (LinkedList device = LinkedList_getNext(devices); device; device = LinkedList_getNext(device)) {
+        char lnRef[130];
+
+        snprintf(lnRef, sizeof(lnRef), "%s/LLN0", (const char*) LinkedList_getData(device));
+
+        LinkedList urcbs = IedConnection_getLogicalNodeDirectory(connection, &error, lnRef, ACSI_CLASS_URCB);
+
+        if (error != IED_ERROR_OK)
+            continue;
+
+        for (LinkedList urcb = LinkedList_getNext(urcbs); urcb; urcb = LinkedList_getNext(urcb)) {
+            char rcbRef[260];
+
+            snprintf(rcbRef, sizeof(rcbRef), "%s.RP.%s", lnRef, (const char*) LinkedList_getData(urcb));
+
+            if ((filter == NULL) || (strncmp(rcbRef, filter, strlen(filter)) == 0))
+                LinkedList_add(result, strdup(rcbRef));
+        }
+
+        LinkedList_destroy(urcbs);
+    }
+
+    LinkedList_destroy(devices);
+
+    return result;
+}
+
+/* Enables the first free URCB for `client`, or in read mode just picks one */
+static bool
+attach_rcb(BenchClient* client, LinkedList urcbs, BenchMode mode)
+{
+    int skip = client->index;
+
+    for (LinkedList urcb = LinkedList_getNext(urcbs); urcb; urcb = LinkedList_getNext(urcb)) {
+        const char* rcbRef = (const char*) LinkedList_getData(urcb);
+        IedClientError error;
+
+        // Read mode shares RCBs; spread the clients over the data sets anyway
+        if ((mode == BENCH_MODE_READ) && (skip-- > 0) && LinkedList_getNext(urcb))
+            continue;
+
+        ClientReportControlBlock rcb = IedConnection_getRCBValues(client->connection, &error, rcbRef, NULL);
+
+        if (error != IED_ERROR_OK)
+            continue;
+
+        const char* dataSet = ClientReportControlBlock_getDataSetReference(rcb);
+
+        if ((dataSet == NULL) || (*dataSet == 0)) {
+            ClientReportControlBlock_destroy(rcb);
+            continue;
+        }
+
+        snprintf(client->rcbRef, sizeof(client->rcbRef), "%s", rcbRef);
+        snprintf(client->dataSetRef, sizeof(client->dataSetRef), "%s", dataSet);
+        for (char* p = client->dataSetRef; *p; p++) {
+            if (*p == '$')
+                *p = '.';
+        }
+
+        if (mode == BENCH_MODE_REPORT) {
+            IedConnection_installReportHandler(client->connection, rcbRef, ClientReportControlBlock_getRptId(rcb),
+                    report_handler, client);
+            ClientReportControlBlock_setTrgOps(rcb, TRG_OPT_DATA_CHANGED | TRG_OPT_QUALITY_CHANGED);
+            ClientReportControlBlock_setOptFlds(rcb, RPT_OPT_REASON_FOR_INCLUSION | RPT_OPT_DATA_SET);
+            ClientReportControlBlock_setRptEna(rcb, true);
+            IedConnection_setRCBValues(client->connection, &error, rcb,
+                    RCB_ELEMENT_TRG_OPS | RCB_ELEMENT_OPT_FLDS | RCB_ELEMENT_RPT_ENA, true);
+
+            if (error != IED_ERROR_OK) {
+                // Owned by another client already
+                IedConnection_uninstallReportHandler(client->connection, rcbRef);
+                ClientReportControlBlock_destroy(rcb);
+                continue;
+            }
+        }
+
+        ClientReportControlBlock_destroy(rcb);
+
+        IedClientError dirError;
+        LinkedList directory = IedConnection_getDataSetDirectory(client->connection, &dirError, client->dataSetRef, NULL);
+
+        if (dirError == IED_ERROR_OK) {
+            index_members(&client->members, directory);
+            LinkedList_destroyDeep(directory, free);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+static void*
+read_client_thread(void* arg)
+{
+    BenchClient* client = (BenchClient*) arg;
+    ClientDataSet dataSet = NULL;
+
+    while (atomic_load(&gRunning)) {
+        IedClientError error;
+        uint64_t startNs = monotonic_ns();
+
+        dataSet = IedConnection_readDataSetValues(client->connection, &error, client->dataSetRef, dataSet);
+
+        if (error != IED_ERROR_OK) {
+            Thread_sleep(10);
+            continue;
+        }
+
+        histogram_add(&gReadLatency, (monotonic_ns() - startNs) / 1000);
+        atomic_fetch_add(&client->reads, 1);
+    }
+
+    if (dataSet)
+        ClientDataSet_destroy(dataSet);
+
+    return NULL;
+}
+
+static void
+disconnect_clients(void)
+{
+    for (int i = 0; i < gClientCount; i++) {
+        BenchClient* client = &gClients[i];
+
+        if (client->thread)
+            Thread_destroy(client->thread);
+
+        IedConnection_close(client->connection);
+        IedConnection_destroy(client->connection);
+
+        for (int m = 0; m < client->members.memberCount; m++)
+            free(client->members.prefixes[m]);
+
+        free(client->members.prefixes);
+        free(client->members.firstHandle);
+        free(client->members.handleCounts);
+        free(client->members.handles);
+    }
+
+    gClientCount = 0;
+}
+
+/* Connects the clients; returns the member prefixes of their data sets for the synthetic sweep */
+static bool
+connect_clients(const BenchOptions* options, char*** prefixes, int* prefixCount)
+{
+    *prefixes = NULL;
+    *prefixCount = 0;
+
+    if (options->clients == 0)
+        return true;
+
+    LinkedList urcbs = NULL;
+
+    for (int i = 0; i < options->clients; i++) {
+        BenchClient* client = &gClients[gClientCount];
+
+        memset(client, 0, sizeof(*client));
+        client->index = i;
+        client->connection = connect_client(options->port);
+
+        if (client->connection == NULL)
+            break;
+
+        if (urcbs == NULL)
+            urcbs = list_urcbs(client->connection, options->rcbFilter);
+
+        if (!attach_rcb(client, urcbs, options->mode)) {
+            fprintf(stderr, "Client %d: no %sURCB with a data set%s%s\n", i, (options->mode == BENCH_MODE_REPORT) ? "free " : "",
+                    options->rcbFilter ? " under " : "", options->rcbFilter ? options->rcbFilter : "");
+            IedConnection_close(client->connection);
+            IedConnection_destroy(client->connection);
+            break;
+        }
+
+        printf("Client %d: %s on %s (%d members)\n", i, (options->mode == BENCH_MODE_REPORT) ? "reports" : "reads",
+                client->rcbRef, client->members.memberCount);
+
+        for (int m = 0; m < client->members.memberCount; m++) {
+            *prefixes = (char**) realloc(*prefixes, (size_t) (*prefixCount + 1) * sizeof(char*));
+            (*prefixes)[(*prefixCount)++] = client->members.prefixes[m];
+        }
+
+        gClientCount++;
+    }
+
+    if (urcbs)
+        LinkedList_destroyDeep(urcbs, free);
+
+    return gClientCount > 0;
+}
+
+// --- Control Probe ---
+
+typedef struct {
+    const char* reference;
+    int intervalMs;
+    int port;
+    atomic_ullong failures;
+} ControlProbe;
+
+static MmsValue*
+probe_value(MmsType type, uint64_t round)
+{
+    switch (type) {
+    case MMS_BOOLEAN:
+        return MmsValue_newBoolean((round & 1) == 0);
+    case MMS_INTEGER:
+        return MmsValue_newIntegerFromInt32(1);
+    default:
+        return NULL;
+    }
+}
+
+static void*
+control_probe_thread(void* arg)
+{
+    ControlProbe* probe = (ControlProbe*) arg;
+    IedConnection connection = connect_client(probe->port);
+
+    if (connection == NULL)
+        return NULL;
+
+    ControlObjectClient control = ControlObjectClient_create(probe->reference, connection);
+
+    if (control == NULL) {
+        fprintf(stderr, "Control %s not found\n", probe->reference);
+        IedConnection_destroy(connection);
+        return NULL;
+    }
+
+    ControlModel model = ControlObjectClient_getControlModel(control);
+    MmsType type = ControlObjectClient_getCtlValType(control);
+
+    for (uint64_t round = 0; atomic_load(&gRunning); round++) {
+        MmsValue* value = probe_value(type, round);
+
+        if (value == NULL) {
+            fprintf(stderr, "Control %s: ctlVal type %d is not probed\n", probe->reference, (int) type);
+            break;
+        }
+
+        uint64_t startNs = monotonic_ns();
+        bool ok = true;
+
+        if ((model == CONTROL_MODEL_SBO_NORMAL) || (model == CONTROL_MODEL_SBO_ENHANCED))
+            ok = (model == CONTROL_MODEL_SBO_NORMAL) ? ControlObjectClient_select(control)
+                                                     : ControlObjectClient_selectWithValue(control, value);
+
+        ok = ok && ControlObjectClient_operate(control, value, 0);
+        MmsValue_delete(value);
+
+        uint64_t doneNs = monotonic_ns();
+
+        if (!ok) {
+            atomic_fetch_add(&probe->failures, 1);
+        }
+        else {
+            histogram_add(&gControlRtt, (doneNs - startNs) / 1000);
+
+            // The CONTROL_UPDATE line reaches the bridge independently of the MMS response
+            for (int waitMs = 0; waitMs < 1000; waitMs++) {
+                uint64_t eventNs = atomic_load(&gControlEventNs);
+
+                if (eventNs >= startNs) {
+                    histogram_add(&gControlEventLatency, (eventNs - startNs) / 1000);
+                    break;
+                }
+
+                Thread_sleep(1);
+            }
+        }
+
+        Thread_sleep(probe->intervalMs);
+    }
+
+    ControlObjectClient_destroy(control);
+    IedConnection_close(connection);
+    IedConnection_destroy(connection);
+
+    return NULL;
+}
+
+static const char*
+default_control(void)
+{
+    // Prefer a switching device over the Mod/health controls every LN carries
+    for (int i = 0; i < gControlCount; i++) {
+        const char* dot = strrchr(gControls[i].reference, '.');
+
+        if (dot && (strcmp(dot, ".Pos") == 0))
+            return gControls[i].reference;
+    }
+
+    return (gControlCount > 0) ? gControls[0].reference : NULL;
+}
+
+// --- Main ---
+
+static void
+usage(const char* program)
+{
+    fprintf(stderr,
+            "usage: %s [options] <server binary> [server args...]\n"
+            "  -p port      MMS port passed to the server (default 8102)\n"
+            "  -r rate      updates per second, 0 = unpaced / trace timing (default 0)\n"
+            "  -d seconds   run time (default 10)\n"
+            "  -b batch     updates per BEGIN/COMMIT batch (default 1)\n"
+            "  -t trace     replay a recorded trace (\"<ms> <ref>=<value>\" lines)\n"
+            "  -c clients   MMS client connections (default 1)\n"
+            "  -m mode      report | read (default report)\n"
+            "  -R prefix    only use URCBs whose reference starts with prefix\n"
+            "  -C control   control object to probe (default: first Pos control)\n"
+            "  -k ms        control probe interval, 0 disables (default 100)\n",
+            program);
+}
+
+int
+main(int argc, char** argv)
+{
+    BenchOptions options = { 8102, 0, 10, 1, 1, BENCH_MODE_REPORT, NULL, NULL, NULL, 100 };
+    int opt;
+
+    while ((opt = getopt(argc, argv, "+p:r:d:b:t:c:m:R:C:k:h")) != -1) {
+        switch (opt) {
+        case 'p': options.port = atoi(optarg); break;
+        case 'r': options.rate = atof(optarg); break;
+        case 'd': options.seconds = atof(optarg); break;
+        case 'b': options.batch = atoi(optarg); break;
+        case 't': options.trace = optarg; break;
+        case 'c': options.clients = atoi(optarg); break;
+        case 'm': options.mode = (strcmp(optarg, "read") == 0) ? BENCH_MODE_READ : BENCH_MODE_REPORT; break;
+        case 'R': options.rcbFilter = optarg; break;
+        case 'C': options.control = optarg; break;
+        case 'k': options.controlIntervalMs = atoi(optarg); break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((optind >= argc) || (options.clients < 0) || (options.clients > BENCH_MAX_CLIENTS)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    atomic_store(&gRunning, 1);
+
+    if (!start_server(argv + optind, argc - optind, options.port) || !read_startup()) {
+        fprintf(stderr, "Backend did not start\n");
+        stop_server();
+        return 2;
+    }
+
+    pthread_t reader;
+
+    pthread_create(&reader, NULL, server_reader_thread, NULL);
+
+    fputs("PROTO binary\n", gServerIn);
+    fflush(gServerIn);
+
+    for (int waited = 0; !atomic_load(&gProtoBinary) && (waited < 5000); waited++)
+        Thread_sleep(1);
+
+    if (!atomic_load(&gProtoBinary)) {
+        fprintf(stderr, "Backend did not switch to the binary bridge\n");
+        stop_server();
+        return 2;
+    }
+
+    int handleSlots = 0;
+
+    for (int i = 0; i < gHandleCount; i++) {
+        if (gHandles[i].handle >= handleSlots)
+            handleSlots = gHandles[i].handle + 1;
+    }
+
+    gSentNs = (_Atomic(uint64_t)*) calloc((size_t) handleSlots + 1, sizeof(uint64_t));
+
+    char** prefixes;
+    int prefixCount;
+
+    if (!connect_clients(&options, &prefixes, &prefixCount) && (options.clients > 0))
+        fprintf(stderr, "No MMS client attached; measuring the bridge only\n");
+
+    if (options.trace)
+        load_trace(options.trace);
+    else
+        build_synthetic_updates((options.mode == BENCH_MODE_REPORT) ? prefixes : NULL,
+                (options.mode == BENCH_MODE_REPORT) ? prefixCount : 0);
+
+    free(prefixes);
+
+    if (gUpdateCount == 0) {
+        fprintf(stderr, "Nothing to update\n");
+        disconnect_clients();
+        stop_server();
+        return 2;
+    }
+
+    printf("Feeding %d attributes for %.1f s (%s, batch %d)\n", gUpdateCount, options.seconds,
+            (options.rate > 0) ? "paced" : (options.trace ? "trace timing" : "unpaced"), options.batch);
+
+    for (int i = 0; (options.mode == BENCH_MODE_READ) && (i < gClientCount); i++) {
+        gClients[i].thread = Thread_create(read_client_thread, &gClients[i], false);
+        Thread_start(gClients[i].thread);
+    }
+
+    ControlProbe probe = { options.control ? options.control : default_control(), options.controlIntervalMs,
+        options.port, 0 };
+    Thread probeThread = NULL;
+
+    if ((probe.intervalMs > 0) && probe.reference) {
+        printf("Probing control %s every %d ms\n", probe.reference, probe.intervalMs);
+        probeThread = Thread_create(control_probe_thread, &probe, false);
+        Thread_start(probeThread);
+    }
+
+    uint64_t startNs = monotonic_ns();
+    uint64_t sent = run_updates(&options);
+    double elapsed = (double) (monotonic_ns() - startNs) / 1e9;
+
+    // Let the last reports arrive before tearing down
+    Thread_sleep(500);
+    atomic_store(&gRunning, 0);
+
+    if (probeThread)
+        Thread_destroy(probeThread);
+
+    unsigned long long reports = 0, reads = 0;
+
+    for (int i = 0; i < gClientCount; i++) {
+        if (gClients[i].thread) {
+            Thread_destroy(gClients[i].thread);
+            gClients[i].thread = NULL;
+        }
+        reports += atomic_load(&gClients[i].reports);
+        reads += atomic_load(&gClients[i].reads);
+    }
+
+    disconnect_clients();
+    stop_server();
+    pthread_join(reader, NULL);
+
+    printf("Updates: %llu in %.2f s, %.0f/s, %llu bridge errors\n", (unsigned long long) sent, elapsed,
+            (double) sent / elapsed, (unsigned long long) atomic_load(&gBridgeErrors));
+
+    if (options.mode == BENCH_MODE_REPORT) {
+        printf("Reports: %llu\n", reports);
+        histogram_print("Update->report latency", &gReportLatency);
+    }
+    else {
+        printf("Data set reads: %llu, %.0f/s\n", reads, (double) reads / elapsed);
+        histogram_print("Read latency", &gReadLatency);
+    }
+
+    if (probeThread) {
+        histogram_print("Control operate RTT", &gControlRtt);
+        histogram_print("Control->bridge event", &gControlEventLatency);
+        if (atomic_load(&probe.failures))
+            printf("Control failures: %llu\n", (unsigned long long) atomic_load(&probe.failures));
+    }
+
+    printf("BENCH updates_per_sec=%.0f bridge_errors=%llu report_p50_us=%llu report_p99_us=%llu read_p50_us=%llu "
+           "read_p99_us=%llu control_p50_us=%llu control_p99_us=%llu\n",
+            (double) sent / elapsed, (unsigned long long) atomic_load(&gBridgeErrors),
+            (unsigned long long) histogram_percentile(&gReportLatency, 50),
+            (unsigned long long) histogram_percentile(&gReportLatency, 99),
+            (unsigned long long) histogram_percentile(&gReadLatency, 50),
+            (unsigned long long) histogram_percentile(&gReadLatency, 99),
+            (unsigned long long) histogram_percentile(&gControlRtt, 50),
+            (unsigned long long) histogram_percentile(&gControlRtt, 99));
+
+    return 0;
+}
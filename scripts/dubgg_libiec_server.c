@@ -1,237 +1,6403 @@
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
 #include <signal.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <semaphore.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/signalfd.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 #include "iec61850_server.h"
+#include "iec61850_config_file_parser.h"
+#include "iec61850_dynamic_model.h"
+#include "sv_publisher.h"
+#include "goose_receiver.h"
+#include "goose_subscriber.h"
+#include "hal_ethernet.h"
 #include "hal_thread.h"
 #include "ied_model.h"
 
 static int running = 1;
-static IedServer gIedServer = NULL;
 
+// --- Hosted IEDs ---
+
+/*
+ * One process can host several IEDs, each with its own IedServer on its
+ * own port (and optionally IP). They share the stdin bridge, the reference
+ * index and the control table; references start with the IED name, so the
+ * bridge routes an update to its IED through the index alone.
+ *
+ * With IEC_BACKEND_WORKERS set, the IEDs are spread round-robin over that
+ * many worker threads (see Workers); otherwise all of them are served by
+ * the main loop.
+ *
+ * IEC_GOOSE_INTERFACE=<ifname> enables every GoCB of every hosted IED on
+ * that interface at startup. libiec61850 then publishes a GOOSE as soon as
+ * a data set member changes (when the data model is unlocked after the
+ * update or batch) and retransmits from the GSE MinTime up to MaxTime from
+ * the periodic tasks of the serving loop.
+ */
+
+#define BRIDGE_MAX_IEDS 64
+#define BRIDGE_MMS_WAIT_MS 2 /* longest MMS wait slice of a serving loop */
+
+typedef struct {
+    IedModel* model;
+    IedServer server;
+    const char* modelFile; /* NULL for the compiled-in model */
+    const char* ipAddress; /* NULL to listen on all interfaces */
+    int port;
+    int worker; /* owning worker, -1 when served by the main loop */
+    atomic_ullong reportPendingNs; /* arrival of the oldest batch applied since the last report, 0 when none */
+} HostedIed;
+
+static HostedIed gIeds[BRIDGE_MAX_IEDS];
+static int gIedCount = 0;
+static atomic_bool gStateChanged; /* any bridge, control or GOOSE write since the last state snapshot */
+
+/* Called by every thread that writes the models; the load keeps the flag's cache line shared while it is set */
+static inline void
+mark_state_changed(void)
+{
+    if (!atomic_load_explicit(&gStateChanged, memory_order_relaxed))
+        atomic_store_explicit(&gStateChanged, true, memory_order_relaxed);
+}
+
+// --- Metrics ---
+
+/*
+ * Hot-path counters and latency histograms, kept per serving thread so
+ * that recording is a relaxed load and store by the only writer. Shard 0
+ * belongs to the main loop (bridge and, without workers, MMS), shard w + 1
+ * to worker w and the last one to the GOOSE receiver thread, whose updates
+ * can create reports too. Nothing is formatted until the relay asks with STATS (text)
+ * or BRIDGE_OP_STATS (binary); the log writer then sums the shards into
+ *
+ *   BRIDGE_METRICS uptime_s=<n> lines=<n> lines_per_s=<n> updates=<n> errors=<n> lookup_misses=<n>
+ *       controls=<n> clients=<n> connections=<n> control_n=<n> control_p50_us=<n> control_p99_us=<n>
+ *       control_max_us=<n> reports=<n> report_n=<n> report_p50_us=<n> report_p99_us=<n> report_max_us=<n>
+ *       overflows=<n> purges=<n> shm_scan_n=<n> shm_scan_p50_us=<n> shm_scan_p99_us=<n> shm_scan_max_us=<n>
+ *       reads=<n> reads_limited=<n>
+ *   BRIDGE_METRICS_RCB <rcb ref> overflows=<n> purges=<n>     (one per RCB with either)
+ *
+ * on one line (wrapped here). lines_per_s covers the time since the
+ * previous request. Update-to-report latency runs from the read burst that
+ * carried a batch to the next report libiec61850 creates for the IED the
+ * batch touched; a GI or integrity report that happens to come first is
+ * counted too. Control time is the operate handler itself, scan time one tick
+ * of the shared value table.
+ */
+
+#define METRICS_HIST_BUCKETS 320 /* 8 per power of two of nanoseconds, up to ~18 minutes */
+
+typedef struct {
+    atomic_ullong buckets[METRICS_HIST_BUCKETS];
+    atomic_ullong count;
+    atomic_ullong maxNs;
+} MetricsHistogram;
+
+typedef struct {
+    _Alignas(64) MetricsHistogram controlNs;
+    MetricsHistogram reportNs;
+    MetricsHistogram shmScanNs;
+    MetricsHistogram scenarioLateNs;    /* main loop only, see Scenario Player */
+    MetricsHistogram scenarioControlNs;
+    atomic_ullong reports;
+    atomic_ullong connects;
+    atomic_ullong disconnects;
+    atomic_ullong reads;
+    atomic_ullong readsLimited;
+} MetricsShard;
+
+typedef struct {
+    ReportControlBlock* rcb;
+    HostedIed* ied;
+    char* reference;
+    atomic_ullong overflows;
+    atomic_ullong purges;
+} RcbMetrics;
+
+typedef struct {
+    atomic_ullong lines;
+    atomic_ullong lookupMisses;
+} BridgeMetrics;
+
+#define METRICS_SHARD_GOOSE (BRIDGE_MAX_IEDS + 1)
+
+static MetricsShard gMetricsShards[METRICS_SHARD_GOOSE + 1];
+static BridgeMetrics gBridgeMetrics;
+static RcbMetrics* gRcbMetrics = NULL;
+static int gRcbMetricsCount = 0;
+static uint64_t gMetricsStartNs = 0;
+
+/* The shard of the calling thread; workers and the GOOSE thread point it at their own */
+static _Thread_local MetricsShard* tMetrics = &gMetricsShards[0];
+
+static uint64_t
+monotonic_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+}
+
+/* Every metric has a single writing thread */
+static inline void
+metrics_add(atomic_ullong* counter, uint64_t amount)
+{
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + amount, memory_order_relaxed);
+}
+
+static int
+metrics_bucket(uint64_t ns)
+{
+    if (ns < 8)
+        return (int) ns;
+
+    int log2 = 63 - __builtin_clzll(ns);
+    int bucket = (log2 - 2) * 8 + (int) ((ns >> (log2 - 3)) & 7);
+
+    return (bucket < METRICS_HIST_BUCKETS) ? bucket : METRICS_HIST_BUCKETS - 1;
+}
+
+/* Upper bound of a bucket */
+static uint64_t
+metrics_bucket_limit(int bucket)
+{
+    if (bucket < 8)
+        return (uint64_t) bucket;
+
+    int log2 = bucket / 8 + 2;
+
+    return (((uint64_t) (8 + bucket % 8 + 1)) << (log2 - 3)) - 1;
+}
+
+static void
+metrics_record(MetricsHistogram* hist, uint64_t ns)
+{
+    metrics_add(&hist->buckets[metrics_bucket(ns)], 1);
+    metrics_add(&hist->count, 1);
+
+    if (ns > atomic_load_explicit(&hist->maxNs, memory_order_relaxed))
+        atomic_store_explicit(&hist->maxNs, ns, memory_order_relaxed);
+}
+
+/* Sums one histogram over all shards; `offset` selects it within MetricsShard */
+static void
+metrics_merge(size_t offset, uint64_t* buckets, uint64_t* count, uint64_t* maxNs)
+{
+    memset(buckets, 0, METRICS_HIST_BUCKETS * sizeof(uint64_t));
+    *count = 0;
+    *maxNs = 0;
+
+    for (size_t s = 0; s < sizeof(gMetricsShards) / sizeof(gMetricsShards[0]); s++) {
+        MetricsHistogram* hist = (MetricsHistogram*) ((char*) &gMetricsShards[s] + offset);
+
+        for (int i = 0; i < METRICS_HIST_BUCKETS; i++)
+            buckets[i] += atomic_load_explicit(&hist->buckets[i], memory_order_relaxed);
+
+        *count += atomic_load_explicit(&hist->count, memory_order_relaxed);
+
+        uint64_t max = atomic_load_explicit(&hist->maxNs, memory_order_relaxed);
+
+        if (max > *maxNs)
+            *maxNs = max;
+    }
+}
+
+static uint64_t
+metrics_percentile_us(const uint64_t* buckets, uint64_t count, uint64_t maxNs, double percentile)
+{
+    if (count == 0)
+        return 0;
+
+    uint64_t rank = (uint64_t) (percentile / 100.0 * (double) (count - 1)) + 1;
+    uint64_t seen = 0;
+
+    for (int i = 0; i < METRICS_HIST_BUCKETS; i++) {
+        seen += buckets[i];
+
+        if (seen >= rank) {
+            uint64_t limit = metrics_bucket_limit(i);
+            return ((limit < maxNs) ? limit : maxNs) / 1000;
+        }
+    }
+
+    return maxNs / 1000;
+}
+
+static void
+rcb_event_handler(void* parameter, ReportControlBlock* rcb, ClientConnection connection, IedServer_RCBEventType event,
+        const char* parameterName, MmsDataAccessError serviceError)
+{
+    HostedIed* ied = (HostedIed*) parameter;
+
+    (void) connection;
+    (void) parameterName;
+    (void) serviceError;
+
+    if (event == RCB_EVENT_REPORT_CREATED) {
+        metrics_add(&tMetrics->reports, 1);
+
+        // Reports may be created on the thread serving the IED or on the GOOSE thread
+        uint64_t pendingNs = atomic_exchange_explicit(&ied->reportPendingNs, 0, memory_order_relaxed);
+
+        if (pendingNs)
+            metrics_record(&tMetrics->reportNs, monotonic_ns() - pendingNs);
+    }
+    else if ((event == RCB_EVENT_OVERFLOW) || (event == RCB_EVENT_PURGEBUF)) {
+        for (int i = 0; i < gRcbMetricsCount; i++) {
+            if (gRcbMetrics[i].rcb == rcb) {
+                metrics_add((event == RCB_EVENT_OVERFLOW) ? &gRcbMetrics[i].overflows : &gRcbMetrics[i].purges, 1);
+                break;
+            }
+        }
+    }
+}
+
+static void
+connection_indication_handler(IedServer server, ClientConnection connection, bool connected, void* parameter)
+{
+    (void) server;
+    (void) connection;
+    (void) parameter;
+
+    metrics_add(connected ? &tMetrics->connects : &tMetrics->disconnects, 1);
+}
+
+/* Indexes the RCBs of the hosted IEDs and installs the event handlers; runs before the servers start */
+static bool
+metrics_setup(void)
+{
+    gMetricsStartNs = monotonic_ns();
+
+    int count = 0;
+
+    for (int i = 0; i < gIedCount; i++) {
+        for (ReportControlBlock* rcb = gIeds[i].model->rcbs; rcb; rcb = rcb->sibling)
+            count++;
+    }
+
+    gRcbMetrics = (RcbMetrics*) calloc((size_t) count + 1, sizeof(RcbMetrics));
+
+    if (gRcbMetrics == NULL) {
+        fprintf(stderr, "Failed to allocate metrics for %d report control blocks\n", count);
+        return false;
+    }
+
+    for (int i = 0; i < gIedCount; i++) {
+        HostedIed* ied = &gIeds[i];
+
+        for (ReportControlBlock* rcb = ied->model->rcbs; rcb; rcb = rcb->sibling) {
+            RcbMetrics* metrics = &gRcbMetrics[gRcbMetricsCount++];
+            char lnRef[130];
+            char reference[200];
+
+            ModelNode_getObjectReference((ModelNode*) rcb->parent, lnRef);
+            snprintf(reference, sizeof(reference), "%s.%s.%s", lnRef, rcb->buffered ? "BR" : "RP", rcb->name);
+
+            metrics->rcb = rcb;
+            metrics->ied = ied;
+            metrics->reference = strdup(reference);
+        }
+
+        IedServer_setRCBEventHandler(ied->server, rcb_event_handler, ied);
+    }
+
+    return true;
+}
+
+static void
+metrics_destroy(void)
+{
+    for (int i = 0; i < gRcbMetricsCount; i++)
+        free(gRcbMetrics[i].reference);
+
+    free(gRcbMetrics);
+    gRcbMetrics = NULL;
+    gRcbMetricsCount = 0;
+}
+
+/*
+ * Appends the BRIDGE_METRICS lines to `out` and returns the new fill;
+ * writes out through stdout when the buffer runs full. Called by the log
+ * writer only, which also owns the rate baseline.
+ */
+static size_t
+metrics_format(char* out, size_t used, size_t capacity, unsigned long long updates, unsigned long long errors,
+        unsigned long long controls)
+{
+    static uint64_t lastNs = 0;
+    static uint64_t lastLines = 0;
+    static uint64_t buckets[METRICS_HIST_BUCKETS];
+
+    uint64_t nowNs = monotonic_ns();
+    uint64_t lines = atomic_load_explicit(&gBridgeMetrics.lines, memory_order_relaxed);
+    uint64_t sinceNs = nowNs - (lastNs ? lastNs : gMetricsStartNs);
+    uint64_t connects = 0, disconnects = 0, reports = 0, overflows = 0, purges = 0;
+    uint64_t reads = 0, readsLimited = 0;
+
+    for (size_t s = 0; s < sizeof(gMetricsShards) / sizeof(gMetricsShards[0]); s++) {
+        connects += atomic_load_explicit(&gMetricsShards[s].connects, memory_order_relaxed);
+        disconnects += atomic_load_explicit(&gMetricsShards[s].disconnects, memory_order_relaxed);
+        reports += atomic_load_explicit(&gMetricsShards[s].reports, memory_order_relaxed);
+        reads += atomic_load_explicit(&gMetricsShards[s].reads, memory_order_relaxed);
+        readsLimited += atomic_load_explicit(&gMetricsShards[s].readsLimited, memory_order_relaxed);
+    }
+
+    for (int i = 0; i < gRcbMetricsCount; i++) {
+        overflows += atomic_load_explicit(&gRcbMetrics[i].overflows, memory_order_relaxed);
+        purges += atomic_load_explicit(&gRcbMetrics[i].purges, memory_order_relaxed);
+    }
+
+    if (used + 1024 > capacity) {
+        fwrite(out, 1, used, stdout);
+        used = 0;
+    }
+
+    uint64_t controlCount, controlMax, reportCount, reportMax, shmScanCount, shmScanMax;
+    uint64_t controlP50, controlP99, shmScanP50, shmScanP99;
+
+    metrics_merge(offsetof(MetricsShard, controlNs), buckets, &controlCount, &controlMax);
+    controlP50 = metrics_percentile_us(buckets, controlCount, controlMax, 50);
+    controlP99 = metrics_percentile_us(buckets, controlCount, controlMax, 99);
+    metrics_merge(offsetof(MetricsShard, shmScanNs), buckets, &shmScanCount, &shmScanMax);
+    shmScanP50 = metrics_percentile_us(buckets, shmScanCount, shmScanMax, 50);
+    shmScanP99 = metrics_percentile_us(buckets, shmScanCount, shmScanMax, 99);
+    metrics_merge(offsetof(MetricsShard, reportNs), buckets, &reportCount, &reportMax);
+
+    used += (size_t) snprintf(out + used, capacity - used,
+            "BRIDGE_METRICS uptime_s=%llu lines=%llu lines_per_s=%llu updates=%llu errors=%llu lookup_misses=%llu "
+            "controls=%llu clients=%llu connections=%llu control_n=%llu control_p50_us=%llu control_p99_us=%llu "
+            "control_max_us=%llu reports=%llu report_n=%llu report_p50_us=%llu report_p99_us=%llu report_max_us=%llu "
+            "overflows=%llu purges=%llu shm_scan_n=%llu shm_scan_p50_us=%llu shm_scan_p99_us=%llu shm_scan_max_us=%llu "
+            "reads=%llu reads_limited=%llu\n",
+            (unsigned long long) ((nowNs - gMetricsStartNs) / 1000000000ull), (unsigned long long) lines,
+            (unsigned long long) (sinceNs ? (lines - lastLines) * 1000000000ull / sinceNs : 0), updates, errors,
+            (unsigned long long) atomic_load_explicit(&gBridgeMetrics.lookupMisses, memory_order_relaxed), controls,
+            (unsigned long long) (connects - disconnects), (unsigned long long) connects,
+            (unsigned long long) controlCount, (unsigned long long) controlP50, (unsigned long long) controlP99,
+            (unsigned long long) (controlMax / 1000), (unsigned long long) reports, (unsigned long long) reportCount,
+            (unsigned long long) metrics_percentile_us(buckets, reportCount, reportMax, 50),
+            (unsigned long long) metrics_percentile_us(buckets, reportCount, reportMax, 99),
+            (unsigned long long) (reportMax / 1000), (unsigned long long) overflows, (unsigned long long) purges,
+            (unsigned long long) shmScanCount, (unsigned long long) shmScanP50, (unsigned long long) shmScanP99,
+            (unsigned long long) (shmScanMax / 1000), (unsigned long long) reads, (unsigned long long) readsLimited);
+
+    for (int i = 0; i < gRcbMetricsCount; i++) {
+        unsigned long long rcbOverflows = atomic_load_explicit(&gRcbMetrics[i].overflows, memory_order_relaxed);
+        unsigned long long rcbPurges = atomic_load_explicit(&gRcbMetrics[i].purges, memory_order_relaxed);
+
+        if ((rcbOverflows == 0) && (rcbPurges == 0))
+            continue;
+
+        if (used + 300 > capacity) {
+            fwrite(out, 1, used, stdout);
+            used = 0;
+        }
+
+        used += (size_t) snprintf(out + used, capacity - used, "BRIDGE_METRICS_RCB %s overflows=%llu purges=%llu\n",
+                gRcbMetrics[i].reference, rcbOverflows, rcbPurges);
+    }
+
+    lastNs = nowNs;
+    lastLines = lines;
+
+    return used;
+}
+
+// --- Bridge Log ---
+
+/*
+ * Acknowledgements, errors and control events are not written to stdout on
+ * the update path. Producers format into a single-producer/single-consumer
+ * ring and a writer thread drains the rings into one write per flush
+ * interval. Bridge messages and control events have separate rings so a
+ * flood of acknowledgements cannot hold back a control event. Bridge
+ * messages come from the main loop thread; control events come from
+ * whichever thread serves the IED, so each worker has its own control ring.
+ * The SV publisher and GOOSE receiver threads each report through a ring of
+ * their own.
+ *
+ * IEC_BRIDGE_LOG selects what is reported:
+ *   ack    - BRIDGE_OK per text update, errors and control events (default)
+ *   stats  - a BRIDGE_STATS line of counters per interval and control events
+ *   errors - only errors and control events
+ *
+ * Scenario results (see Scenario Player) go to the bridge ring in every mode.
+ * Credit (see Bridge Logic) is not queued: the loop publishes its latest
+ * input count and the writer prints it with the next flush when it moved,
+ * so a full ring can never hold back the relay.
+ * Control events are never dropped; if their ring is full they are written
+ * synchronously. Other messages are dropped and reported as a count. The
+ * writer also answers metrics requests (see Metrics).
+ */
+
+#define BRIDGE_LOG_RING_SIZE 1024
+#define BRIDGE_LOG_LINE_SIZE 320
+#define BRIDGE_LOG_FLUSH_MS 2
+#define BRIDGE_LOG_STATS_MS 1000
+
+typedef enum {
+    BRIDGE_LOG_ACK,
+    BRIDGE_LOG_STATS,
+    BRIDGE_LOG_ERRORS
+} BridgeLogMode;
+
+typedef struct {
+    uint16_t len;
+    char text[BRIDGE_LOG_LINE_SIZE];
+} LogEntry;
+
+typedef struct {
+    _Alignas(64) atomic_uint head;
+    _Alignas(64) atomic_uint tail;
+    atomic_uint dropped;
+    LogEntry entries[BRIDGE_LOG_RING_SIZE];
+} LogRing;
+
+typedef struct {
+    atomic_ullong updates;
+    atomic_ullong errors;
+    atomic_ullong controls;
+} LogCounters;
+
+static LogRing gBridgeLogRing;
+static LogRing gControlLogRing;
+static LogRing* gThreadLogRings[BRIDGE_MAX_IEDS + 2]; /* worker control rings, SV and GOOSE rings; registered before the writer starts */
+static int gThreadLogRingCount = 0;
+static LogCounters gLogCounters;
+static BridgeLogMode gLogMode = BRIDGE_LOG_ACK;
+static sem_t gLogWake;
+static atomic_int gLogRunning;
+static atomic_int gMetricsRequested;
+static atomic_ullong gCreditConsumed;
+static atomic_uint gCreditWindow; /* 0 until the relay asks for credit */
+static Thread gLogThread = NULL;
+
+/* The ring control events from the calling thread go to; workers point it at their own */
+static _Thread_local LogRing* tControlLogRing = &gControlLogRing;
+
+/* Update and error counters have a single writing thread, so a plain relaxed store suffices */
+static inline void
+log_counter_increment(atomic_ullong* counter)
+{
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + 1, memory_order_relaxed);
+}
+
+static LogEntry*
+log_ring_reserve(LogRing* ring)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    if (head - tail == BRIDGE_LOG_RING_SIZE)
+        return NULL;
+
+    return &ring->entries[head & (BRIDGE_LOG_RING_SIZE - 1)];
+}
+
+static void
+log_ring_publish(LogRing* ring)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+    if (atomic_load_explicit(&gLogRunning, memory_order_relaxed))
+        sem_post(&gLogWake);
+}
+
+static bool
+log_ring_vpush(LogRing* ring, const char* fmt, va_list args)
+{
+    LogEntry* entry = log_ring_reserve(ring);
+
+    if (entry == NULL)
+        return false;
+
+    int len = vsnprintf(entry->text, sizeof(entry->text) - 1, fmt, args);
+
+    if (len < 0)
+        len = 0;
+    else if (len > (int) sizeof(entry->text) - 2)
+        len = (int) sizeof(entry->text) - 2;
+
+    entry->text[len++] = '\n';
+    entry->len = (uint16_t) len;
+
+    log_ring_publish(ring);
+
+    return true;
+}
+
+static bool
+log_ring_push(LogRing* ring, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+
+    bool queued = log_ring_vpush(ring, fmt, args);
+
+    va_end(args);
+
+    return queued;
+}
+
+static void
+bridge_log_error(const char* fmt, ...)
+{
+    log_counter_increment(&gLogCounters.errors);
+
+    if (gLogMode == BRIDGE_LOG_STATS)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+
+    if (!log_ring_vpush(&gBridgeLogRing, fmt, args))
+        atomic_fetch_add_explicit(&gBridgeLogRing.dropped, 1, memory_order_relaxed);
+
+    va_end(args);
+}
+
+static void
+bridge_log_ack(const char* fmt, ...)
+{
+    log_counter_increment(&gLogCounters.updates);
+
+    if (gLogMode != BRIDGE_LOG_ACK)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+
+    if (!log_ring_vpush(&gBridgeLogRing, fmt, args))
+        atomic_fetch_add_explicit(&gBridgeLogRing.dropped, 1, memory_order_relaxed);
+
+    va_end(args);
+}
+
+/* Queues a line that is reported whatever IEC_BRIDGE_LOG says; main loop thread only */
+static void
+bridge_log_status(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+
+    if (!log_ring_vpush(&gBridgeLogRing, fmt, args))
+        atomic_fetch_add_explicit(&gBridgeLogRing.dropped, 1, memory_order_relaxed);
+
+    va_end(args);
+}
+
+/* Queues a preformatted control event line, which must end in '\n' */
+static void
+bridge_log_control(const char* line, size_t len)
+{
+    LogRing* ring = tControlLogRing;
+
+    atomic_fetch_add_explicit(&gLogCounters.controls, 1, memory_order_relaxed);
+
+    LogEntry* entry = log_ring_reserve(ring);
+
+    if (entry == NULL) {
+        fwrite(line, 1, len, stdout);
+        fflush(stdout);
+        return;
+    }
+
+    memcpy(entry->text, line, len);
+    entry->len = (uint16_t) len;
+
+    log_ring_publish(ring);
+}
+
+static size_t
+log_ring_drain(LogRing* ring, char* out, size_t used, size_t capacity)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    while (tail != head) {
+        LogEntry* entry = &ring->entries[tail & (BRIDGE_LOG_RING_SIZE - 1)];
+
+        if (used + entry->len > capacity) {
+            fwrite(out, 1, used, stdout);
+            used = 0;
+        }
+
+        memcpy(out + used, entry->text, entry->len);
+        used += entry->len;
+        tail++;
+    }
+
+    atomic_store_explicit(&ring->tail, tail, memory_order_release);
+
+    unsigned dropped = atomic_exchange_explicit(&ring->dropped, 0, memory_order_relaxed);
+
+    if (dropped) {
+        if (used + 64 > capacity) {
+            fwrite(out, 1, used, stdout);
+            used = 0;
+        }
+
+        used += (size_t) snprintf(out + used, capacity - used, "BRIDGE_ERR: Log ring full, %u messages dropped\n", dropped);
+    }
+
+    return used;
+}
+
+static void*
+bridge_log_thread(void* arg)
+{
+    (void) arg;
+    static char out[64 * 1024];
+    uint64_t nextStatsMs = Hal_getTimeInMs() + BRIDGE_LOG_STATS_MS;
+    unsigned long long lastUpdates = 0, lastErrors = 0, lastControls = 0;
+    uint64_t lastCredit = UINT64_MAX;
+
+    while (true) {
+        bool stopping = !atomic_load(&gLogRunning);
+        struct timespec deadline;
+
+        if (!stopping) {
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += BRIDGE_LOG_STATS_MS / 1000;
+
+            while ((sem_timedwait(&gLogWake, &deadline) == -1) && (errno == EINTR))
+                ;
+
+            // Let a burst accumulate so it leaves in one write
+            Thread_sleep(BRIDGE_LOG_FLUSH_MS);
+
+            while (sem_trywait(&gLogWake) == 0)
+                ;
+        }
+
+        size_t used = log_ring_drain(&gControlLogRing, out, 0, sizeof(out));
+
+        for (int i = 0; i < gThreadLogRingCount; i++)
+            used = log_ring_drain(gThreadLogRings[i], out, used, sizeof(out));
+
+        used = log_ring_drain(&gBridgeLogRing, out, used, sizeof(out));
+
+        unsigned window = atomic_load_explicit(&gCreditWindow, memory_order_relaxed);
+        uint64_t credit = atomic_load_explicit(&gCreditConsumed, memory_order_relaxed);
+
+        if (window && (credit != lastCredit)) {
+            if (used + 64 > sizeof(out)) {
+                fwrite(out, 1, used, stdout);
+                used = 0;
+            }
+
+            used += (size_t) snprintf(out + used, sizeof(out) - used, "BRIDGE_CREDIT %llu %u\n", (unsigned long long) credit, window);
+            lastCredit = credit;
+        }
+
+        if (atomic_exchange_explicit(&gMetricsRequested, 0, memory_order_relaxed)) {
+            used = metrics_format(out, used, sizeof(out), atomic_load_explicit(&gLogCounters.updates, memory_order_relaxed),
+                    atomic_load_explicit(&gLogCounters.errors, memory_order_relaxed),
+                    atomic_load_explicit(&gLogCounters.controls, memory_order_relaxed));
+        }
+
+        if ((gLogMode == BRIDGE_LOG_STATS) && (stopping || (Hal_getTimeInMs() >= nextStatsMs))) {
+            unsigned long long updates = atomic_load_explicit(&gLogCounters.updates, memory_order_relaxed);
+            unsigned long long errors = atomic_load_explicit(&gLogCounters.errors, memory_order_relaxed);
+            unsigned long long controls = atomic_load_explicit(&gLogCounters.controls, memory_order_relaxed);
+
+            if ((updates != lastUpdates) || (errors != lastErrors) || (controls != lastControls)) {
+                if (used + 128 > sizeof(out)) {
+                    fwrite(out, 1, used, stdout);
+                    used = 0;
+                }
+
+                used += (size_t) snprintf(out + used, sizeof(out) - used,
+                        "BRIDGE_STATS updates=%llu errors=%llu controls=%llu\n",
+                        updates - lastUpdates, errors - lastErrors, controls - lastControls);
+
+                lastUpdates = updates;
+                lastErrors = errors;
+                lastControls = controls;
+            }
+
+            nextStatsMs = Hal_getTimeInMs() + BRIDGE_LOG_STATS_MS;
+        }
+
+        if (used) {
+            fwrite(out, 1, used, stdout);
+            fflush(stdout);
+        }
+
+        if (stopping)
+            break;
+    }
+
+    return NULL;
+}
+
+static void
+bridge_log_start(void)
+{
+    const char* mode = getenv("IEC_BRIDGE_LOG");
+
+    if (mode && (strcmp(mode, "stats") == 0))
+        gLogMode = BRIDGE_LOG_STATS;
+    else if (mode && (strcmp(mode, "errors") == 0))
+        gLogMode = BRIDGE_LOG_ERRORS;
+    else
+        gLogMode = BRIDGE_LOG_ACK;
+
+    sem_init(&gLogWake, 0, 0);
+    atomic_store(&gLogRunning, 1);
+
+    gLogThread = Thread_create(bridge_log_thread, NULL, false);
+    Thread_start(gLogThread);
+}
+
+/* Has the writer emit the metrics lines with its next flush */
+static void
+bridge_log_request_metrics(void)
+{
+    atomic_store_explicit(&gMetricsRequested, 1, memory_order_relaxed);
+
+    if (atomic_load_explicit(&gLogRunning, memory_order_relaxed))
+        sem_post(&gLogWake);
+}
+
+/* Has the writer report `consumed` input bytes with its next flush */
+static void
+bridge_log_credit(uint64_t consumed, unsigned window)
+{
+    atomic_store_explicit(&gCreditConsumed, consumed, memory_order_relaxed);
+    atomic_store_explicit(&gCreditWindow, window, memory_order_relaxed);
+
+    if (atomic_load_explicit(&gLogRunning, memory_order_relaxed))
+        sem_post(&gLogWake);
+}
+
+/* Flushes everything still queued and joins the writer */
+static void
+bridge_log_stop(void)
+{
+    if (gLogThread == NULL)
+        return;
+
+    atomic_store(&gLogRunning, 0);
+    sem_post(&gLogWake);
+    Thread_destroy(gLogThread);
+    gLogThread = NULL;
+    sem_destroy(&gLogWake);
+}
+
+// --- Control Handlers ---
+
+/*
+ * Controllable DOs are collected in one walk over each model into a growing
+ * binding array and a pool of reference strings. The handlers are only
+ * registered once the walk is done, so the bindings never move once their
+ * address has been handed to libiec61850.
+ *
+ * Each binding has a small integer id. The id table is published once at
+ * startup as "BRIDGE_CONTROL <id> <ref>" lines and every operate is then
+ * reported, composed without printf, as
+ *
+ *   CONTROL_UPDATE <id> <ctlVal> ctlNum=<n> orCat=<n> test=<0|1> orIdent=<hex>
+ *
+ * so the simulation can apply the command without reading the state back.
+ * Test operates are reported but do not change stVal.
+ */
+
+typedef struct {
+    HostedIed* ied;
+    DataObject* controlDo;
+    DataAttribute* stValAttr;
+    DataAttribute* tAttr;
+    const char* reference;
+    uint32_t id;
+    _Atomic uint64_t expectedSinceNs; /* set while a scenario waits for this control */
+    _Atomic uint64_t operatedNs;      /* first operate since then */
+} ControlBinding;
+
+/* Oper, stVal and t found so far among the children of a DO */
+typedef struct {
+    DataAttribute* oper;
+    DataAttribute* stVal;
+    DataAttribute* t;
+} ControlCandidates;
+
+static ControlBinding* gBindings = NULL;
+static int gBindingCount = 0;
+static int gBindingCapacity = 0;
+static char* gControlRefs = NULL;
+static size_t gControlRefBytes = 0;
+static size_t gControlRefCapacity = 0;
+
+#define CONTROL_LINE_PREFIX "CONTROL_UPDATE "
+
+static char*
+format_u64(char* out, uint64_t value)
+{
+    char digits[20];
+    int n = 0;
+
+    do {
+        digits[n++] = (char) ('0' + (value % 10));
+        value /= 10;
+    } while (value);
+
+    while (n)
+        *out++ = digits[--n];
+
+    return out;
+}
+
+static char*
+format_hex(char* out, const uint8_t* bytes, int size)
+{
+    static const char digits[] = "0123456789abcdef";
+
+    for (int i = 0; i < size; i++) {
+        *out++ = digits[bytes[i] >> 4];
+        *out++ = digits[bytes[i] & 0x0f];
+    }
+
+    return out;
+}
+
+static char*
+append_literal(char* out, const char* text, size_t len)
+{
+    memcpy(out, text, len);
+    return out + len;
+}
+
+#define APPEND_LITERAL(out, text) append_literal((out), (text), sizeof(text) - 1)
+
+static char*
+format_i64(char* out, int64_t value)
+{
+    if (value < 0) {
+        *out++ = '-';
+        return format_u64(out, (uint64_t) 0 - (uint64_t) value);
+    }
+
+    return format_u64(out, (uint64_t) value);
+}
+
+/* Writes ctlVal as text; out must have room for at least 64 bytes */
+static char*
+format_control_value(char* out, size_t room, MmsValue* value)
+{
+    if (value == NULL) {
+        memcpy(out, "null", 4);
+        return out + 4;
+    }
+
+    switch (MmsValue_getType(value)) {
+    case MMS_BOOLEAN:
+        if (MmsValue_getBoolean(value)) {
+            memcpy(out, "true", 4);
+            return out + 4;
+        }
+        memcpy(out, "false", 5);
+        return out + 5;
+    case MMS_INTEGER:
+        return format_i64(out, MmsValue_toInt64(value));
+    case MMS_UNSIGNED:
+        return format_u64(out, MmsValue_toUint32(value));
+    case MMS_BIT_STRING:
+        return format_u64(out, MmsValue_getBitStringAsInteger(value));
+    case MMS_FLOAT:
+        // Analogue setpoints are rare enough to not need a custom formatter
+        return out + snprintf(out, room, "%g", MmsValue_toDouble(value));
+    case MMS_STRUCTURE:
+        // AnalogueValue {i, f}: report the first present member
+        if (MmsValue_getArraySize(value) > 0)
+            return format_control_value(out, room, MmsValue_getElement(value, 0));
+        break;
+    default:
+        break;
+    }
+
+    *out++ = '?';
+    return out;
+}
+
+static CheckHandlerResult
+perform_check_handler(ControlAction action, void* parameter, MmsValue* ctlVal, bool test, bool interlockCheck)
+{
+    (void) action;
+    (void) parameter;
+    (void) ctlVal;
+    (void) test;
+    (void) interlockCheck;
+    return CONTROL_ACCEPTED;
+}
+
+static ControlHandlerResult
+generic_control_handler(ControlAction action, void* parameter, MmsValue* ctlVal, bool test)
+{
+    ControlBinding* binding = (ControlBinding*) parameter;
+
+    if (binding == NULL)
+        return CONTROL_RESULT_FAILED;
+
+    if (ControlAction_isSelect(action))
+        return CONTROL_RESULT_OK;
+
+    uint64_t startNs = monotonic_ns();
+
+    // A scenario waiting for this control keeps the time of its first operate
+    if (atomic_load_explicit(&binding->expectedSinceNs, memory_order_acquire) != 0) {
+        uint64_t none = 0;
+        atomic_compare_exchange_strong(&binding->operatedNs, &none, startNs);
+    }
+
+    if (!test) {
+        if (binding->stValAttr)
+            IedServer_updateAttributeValue(binding->ied->server, binding->stValAttr, ctlVal);
+
+        if (binding->tAttr)
+            IedServer_updateUTCTimeAttributeValue(binding->ied->server, binding->tAttr, Hal_getTimeInMs());
+
+        mark_state_changed();
+    }
+
+    int orIdentSize = 0;
+    uint8_t* orIdent = ControlAction_getOrIdent(action, &orIdentSize);
+
+    // orIdent is at most 64 octets, so the hex form always fits
+    if ((orIdent == NULL) || (orIdentSize < 0))
+        orIdentSize = 0;
+    else if (orIdentSize > 64)
+        orIdentSize = 64;
+
+    char line[BRIDGE_LOG_LINE_SIZE];
+    char* p = line;
+
+    p = APPEND_LITERAL(p, CONTROL_LINE_PREFIX);
+    p = format_u64(p, binding->id);
+    *p++ = ' ';
+    p = format_control_value(p, 64, ctlVal);
+    p = APPEND_LITERAL(p, " ctlNum=");
+    p = format_u64(p, (uint64_t) (ControlAction_getCtlNum(action) & 0xff));
+    p = APPEND_LITERAL(p, " orCat=");
+    p = format_i64(p, ControlAction_getOrCat(action));
+    p = APPEND_LITERAL(p, test ? " test=1" : " test=0");
+    p = APPEND_LITERAL(p, " orIdent=");
+    p = format_hex(p, orIdent, orIdentSize);
+    *p++ = '\n';
+
+    bridge_log_control(line, (size_t) (p - line));
+    metrics_record(&tMetrics->controlNs, monotonic_ns() - startNs);
+
+    return CONTROL_RESULT_OK;
+}
+
+// Same preference as ModelNode_getChildWithFc() with a ModelNode_getChild() fallback
+static void
+control_candidate(ControlCandidates* found, DataAttribute* da)
+{
+    const char* name = da->name;
+
+    if (strcmp(name, "Oper") == 0) {
+        if ((found->oper == NULL) || ((da->fc == IEC61850_FC_CO) && (found->oper->fc != IEC61850_FC_CO)))
+            found->oper = da;
+    }
+    else if (strcmp(name, "stVal") == 0) {
+        if ((found->stVal == NULL) || ((da->fc == IEC61850_FC_ST) && (found->stVal->fc != IEC61850_FC_ST)))
+            found->stVal = da;
+    }
+    else if (strcmp(name, "t") == 0) {
+        if ((found->t == NULL) || ((da->fc == IEC61850_FC_ST) && (found->t->fc != IEC61850_FC_ST)))
+            found->t = da;
+    }
+}
+
+/* Called once the walk leaves the DO's children; `ref` is its object reference */
+static bool
+add_control_binding(HostedIed* ied, ModelNode* node, const ControlCandidates* found, const char* ref, size_t refLen)
+{
+    if ((found->oper == NULL) || (found->stVal == NULL))
+        return true;
+
+    if (gBindingCount == gBindingCapacity) {
+        int grown = (gBindingCapacity > 0) ? gBindingCapacity * 2 : 64;
+        ControlBinding* resized = (ControlBinding*) realloc(gBindings, (size_t) grown * sizeof(ControlBinding));
+
+        if (resized == NULL)
+            return false;
+
+        gBindings = resized;
+        gBindingCapacity = grown;
+    }
+
+    if (gControlRefBytes + refLen + 1 > gControlRefCapacity) {
+        size_t grown = (gControlRefCapacity > 0) ? gControlRefCapacity * 2 : 4096;
+
+        while (grown < gControlRefBytes + refLen + 1)
+            grown *= 2;
+
+        char* resized = (char*) realloc(gControlRefs, grown);
+
+        if (resized == NULL)
+            return false;
+
+        gControlRefs = resized;
+        gControlRefCapacity = grown;
+    }
+
+    ControlBinding* binding = &gBindings[gBindingCount];
+    binding->ied = ied;
+    binding->controlDo = (DataObject*) node;
+    binding->stValAttr = found->stVal;
+    binding->tAttr = found->t;
+    binding->id = (uint32_t) gBindingCount;
+    binding->reference = NULL; /* set once the pool stops moving */
+    atomic_init(&binding->expectedSinceNs, 0);
+    atomic_init(&binding->operatedNs, 0);
+
+    memcpy(gControlRefs + gControlRefBytes, ref, refLen + 1);
+    gControlRefBytes += refLen + 1;
+    gBindingCount++;
+
+    return true;
+}
+
+#define CONTROL_SCAN_DEPTH 16 /* LN, DO and nested SDOs */
+
+/*
+ * Walks a model without recursion, following the parent links back up. The
+ * children of a DO are visited once: its DataAttributes are checked for
+ * Oper, stVal and t but never entered, and its SDOs are descended into. The
+ * binding is added when the walk climbs back out of the DO. The reference of
+ * the current node is kept in one buffer, trimmed back per level.
+ */
+static bool
+scan_model_controls(HostedIed* ied)
+{
+    IedModel* model = ied->model;
+    char path[256];
+    size_t lens[CONTROL_SCAN_DEPTH + 1];
+    ControlCandidates found[CONTROL_SCAN_DEPTH + 1];
+
+    for (LogicalDevice* ld = model->firstChild; ld; ld = (LogicalDevice*) ld->sibling) {
+        ModelNode* root = (ModelNode*) ld;
+        ModelNode* node = root->firstChild;
+        int depth = 0;
+
+        if (ld->ldName)
+            lens[0] = (size_t) snprintf(path, sizeof(path), "%s", ld->ldName);
+        else
+            lens[0] = (size_t) snprintf(path, sizeof(path), "%s%s", model->name, ld->name);
+
+        if (lens[0] >= sizeof(path))
+            continue;
+
+        while (node) {
+            if (node->modelType == DataAttributeModelType) {
+                if ((node->parent->modelType == DataObjectModelType) && node->name)
+                    control_candidate(&found[depth], (DataAttribute*) node);
+            }
+            else if (node->name && node->firstChild && (depth < CONTROL_SCAN_DEPTH)) {
+                size_t nameLen = strlen(node->name);
+                size_t len = lens[depth] + 1 + nameLen;
+
+                if (len < sizeof(path)) {
+                    path[lens[depth]] = (node->parent == root) ? '/' : '.';
+                    memcpy(path + lens[depth] + 1, node->name, nameLen + 1);
+                    lens[++depth] = len;
+                    memset(&found[depth], 0, sizeof(found[depth]));
+                    node = node->firstChild;
+                    continue;
+                }
+            }
+
+            while ((node != root) && (node->sibling == NULL)) {
+                node = node->parent;
+
+                if (node->modelType == DataObjectModelType) {
+                    path[lens[depth]] = '\0';
+
+                    if (!add_control_binding(ied, node, &found[depth], path, lens[depth]))
+                        return false;
+                }
+
+                depth--;
+            }
+
+            node = (node == root) ? NULL : node->sibling;
+        }
+    }
+
+    return true;
+}
+
+static bool
+register_all_control_handlers(void)
+{
+    uint64_t startNs = monotonic_ns();
+
+    for (int i = 0; i < gIedCount; i++) {
+        if (!scan_model_controls(&gIeds[i])) {
+            fprintf(stderr, "Failed to allocate control bindings\n");
+            return false;
+        }
+    }
+
+    const char* ref = gControlRefs;
+
+    for (int i = 0; i < gBindingCount; i++) {
+        ControlBinding* binding = &gBindings[i];
+
+        binding->reference = ref;
+        ref += strlen(ref) + 1;
+
+        IedServer_setPerformCheckHandler(binding->ied->server, binding->controlDo, perform_check_handler, binding);
+        IedServer_setControlHandler(binding->ied->server, binding->controlDo, generic_control_handler, binding);
+        printf("BRIDGE_CONTROL %u %s\n", binding->id, binding->reference);
+    }
+
+    printf("Registered %d controllable data object handlers in %.1f ms\n", gBindingCount,
+            (double) (monotonic_ns() - startNs) / 1e6);
+
+    return true;
+}
+
+// --- Reference Index ---
+
+/*
+ * Every leaf DataAttribute of the model is indexed once at startup so the
+ * bridge never walks the model tree per update. A DataObject reference is
+ * also accepted as an alias for its stVal, and the DO's timestamp attribute
+ * is resolved up front.
+ *
+ * With IEC_BRIDGE_STREAM=1 the deadbanded magnitudes (mag.f/mag.i and
+ * cVal.mag.f/cVal.mag.i) of DOs that have a db attribute also get a
+ * DeadbandState; see apply_bridge_value().
+ */
+
+/* Value type tags shared with the relay (scripts/lib/iec-bridge.cjs) */
+typedef enum {
+    BRIDGE_TYPE_NONE = 0,
+    BRIDGE_TYPE_BOOLEAN = 1,
+    BRIDGE_TYPE_INT32 = 2,
+    BRIDGE_TYPE_UINT32 = 3,
+    BRIDGE_TYPE_FLOAT = 4,
+    BRIDGE_TYPE_INT64 = 5,
+    BRIDGE_TYPE_BITSTRING = 6,
+    BRIDGE_TYPE_UTCTIME = 7,
+    BRIDGE_TYPE_STRING = 8,
+    BRIDGE_TYPE_DBPOS = 9
+} BridgeValueType;
+
+typedef struct {
+    DataAttribute* db;       /* CF db, in 0.001 % of the range */
+    DataAttribute* zeroDb;   /* CF zeroDb, same unit; NULL if the DO has none */
+    DataAttribute* rangeMin; /* CF rangeC.min.f/max.f; without them db is relative to the reported value */
+    DataAttribute* rangeMax;
+    double reported;         /* last value that went through report processing */
+    bool hasReported;
+} DeadbandState;
+
+typedef struct {
+    HostedIed* ied;
+    DataAttribute* attr;
+    DataAttribute* tAttr;
+    const char* reference;
+    BridgeValueType type;
+    DeadbandState* deadband; /* accessed with the IED's data model locked */
+} AttributeBinding;
+
+typedef struct {
+    const char* key;
+    uint32_t keyLen;
+    uint32_t hash;
+    AttributeBinding* binding;
+} IndexSlot;
+
+static AttributeBinding* gAttrBindings = NULL;
+static int gAttrBindingCount = 0;
+static DeadbandState* gDeadbands = NULL;
+static int gDeadbandCount = 0;
+static uint16_t* gStagedSlots = NULL; /* streaming mode: per binding, 1 + its slot in the open batch */
+static bool gStreamMode = false;
+static int gAttrAliasCount = 0;
+static char* gRefPool = NULL;
+static size_t gRefPoolUsed = 0;
+static IndexSlot* gIndexSlots = NULL;
+static uint32_t gIndexMask = 0;
+static _Atomic uint8_t* gShmCurrent = NULL; /* shared value table: per binding, 1 while its last staged value came from the table */
+
+/* Any source but the shared value table calls this after it wrote or staged the attribute */
+static inline void
+shm_value_overwritten(const AttributeBinding* binding)
+{
+    if (gShmCurrent)
+        atomic_store_explicit(&gShmCurrent[binding - gAttrBindings], 0, memory_order_relaxed);
+}
+
+static uint32_t
+index_hash(const char* key, size_t len)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t) key[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static void
+index_insert(const char* key, size_t len, AttributeBinding* binding)
+{
+    uint32_t hash = index_hash(key, len);
+    uint32_t pos = hash & gIndexMask;
+
+    while (gIndexSlots[pos].binding) {
+        IndexSlot* slot = &gIndexSlots[pos];
+
+        if ((slot->hash == hash) && (slot->keyLen == len) && (memcmp(slot->key, key, len) == 0))
+            return;
+
+        pos = (pos + 1) & gIndexMask;
+    }
+
+    gIndexSlots[pos].key = key;
+    gIndexSlots[pos].keyLen = (uint32_t) len;
+    gIndexSlots[pos].hash = hash;
+    gIndexSlots[pos].binding = binding;
+}
+
+static AttributeBinding*
+index_lookup(const char* key, size_t len)
+{
+    if (gIndexSlots == NULL)
+        return NULL;
+
+    uint32_t hash = index_hash(key, len);
+    uint32_t pos = hash & gIndexMask;
+
+    while (gIndexSlots[pos].binding) {
+        IndexSlot* slot = &gIndexSlots[pos];
+
+        if ((slot->hash == hash) && (slot->keyLen == len) && (memcmp(slot->key, key, len) == 0))
+            return slot->binding;
+
+        pos = (pos + 1) & gIndexMask;
+    }
+
+    return NULL;
+}
+
+static BridgeValueType
+bridge_type_from_da_type(DataAttributeType type)
+{
+    switch (type) {
+    case IEC61850_BOOLEAN:
+        return BRIDGE_TYPE_BOOLEAN;
+    case IEC61850_INT8:
+    case IEC61850_INT16:
+    case IEC61850_INT32:
+    case IEC61850_ENUMERATED:
+        return BRIDGE_TYPE_INT32;
+    case IEC61850_INT8U:
+    case IEC61850_INT16U:
+    case IEC61850_INT24U:
+    case IEC61850_INT32U:
+        return BRIDGE_TYPE_UINT32;
+    case IEC61850_FLOAT32:
+        return BRIDGE_TYPE_FLOAT;
+    case IEC61850_INT64:
+        return BRIDGE_TYPE_INT64;
+    case IEC61850_QUALITY:
+    case IEC61850_CHECK:
+    case IEC61850_GENERIC_BITSTRING:
+        return BRIDGE_TYPE_BITSTRING;
+    case IEC61850_CODEDENUM:
+        return BRIDGE_TYPE_DBPOS;
+    case IEC61850_TIMESTAMP:
+        return BRIDGE_TYPE_UTCTIME;
+    case IEC61850_VISIBLE_STRING_32:
+    case IEC61850_VISIBLE_STRING_64:
+    case IEC61850_VISIBLE_STRING_65:
+    case IEC61850_VISIBLE_STRING_129:
+    case IEC61850_VISIBLE_STRING_255:
+        return BRIDGE_TYPE_STRING;
+    default:
+        return BRIDGE_TYPE_NONE;
+    }
+}
+
+/*
+ * The typed IedServer_update*AttributeValue functions write the model value
+ * in place but require the matching MmsType, so only accept attributes whose
+ * live value agrees with the declared type.
+ */
+static BridgeValueType
+bridge_type_for_attribute(DataAttribute* da)
+{
+    static const MmsType mmsTypes[] = {
+        [BRIDGE_TYPE_BOOLEAN] = MMS_BOOLEAN,
+        [BRIDGE_TYPE_INT32] = MMS_INTEGER,
+        [BRIDGE_TYPE_UINT32] = MMS_UNSIGNED,
+        [BRIDGE_TYPE_FLOAT] = MMS_FLOAT,
+        [BRIDGE_TYPE_INT64] = MMS_INTEGER,
+        [BRIDGE_TYPE_BITSTRING] = MMS_BIT_STRING,
+        [BRIDGE_TYPE_UTCTIME] = MMS_UTC_TIME,
+        [BRIDGE_TYPE_STRING] = MMS_VISIBLE_STRING,
+        [BRIDGE_TYPE_DBPOS] = MMS_BIT_STRING
+    };
+
+    BridgeValueType type = bridge_type_from_da_type(da->type);
+
+    if ((type == BRIDGE_TYPE_NONE) || (da->mmsValue == NULL) || (MmsValue_getType(da->mmsValue) != mmsTypes[type]))
+        return BRIDGE_TYPE_NONE;
+
+    return type;
+}
+
+static DataAttribute*
+find_attribute_child(ModelNode* parent, const char* name)
+{
+    ModelNode* child = parent ? parent->firstChild : NULL;
+
+    while (child) {
+        if ((ModelNode_getType(child) == DataAttributeModelType) && (strcmp(child->name, name) == 0))
+            return (DataAttribute*) child;
+
+        child = child->sibling;
+    }
+
+    return NULL;
+}
+
+/* Returns the DO whose db applies to `da` (mag.f, mag.i, cVal.mag.f, cVal.mag.i), or NULL */
+static ModelNode*
+deadband_data_object(DataAttribute* da)
+{
+    ModelNode* mag = da->parent;
+
+    if ((da->fc != IEC61850_FC_MX) || ((strcmp(da->name, "f") != 0) && (strcmp(da->name, "i") != 0)) ||
+            (mag == NULL) || (strcmp(mag->name, "mag") != 0))
+        return NULL;
+
+    ModelNode* parent = mag->parent;
+
+    if (parent && (ModelNode_getType(parent) == DataAttributeModelType) && (strcmp(parent->name, "cVal") == 0))
+        parent = parent->parent;
+
+    if ((parent == NULL) || (ModelNode_getType(parent) != DataObjectModelType))
+        return NULL;
+
+    DataAttribute* db = find_attribute_child(parent, "db");
+
+    return ((db != NULL) && (db->mmsValue != NULL)) ? parent : NULL;
+}
+
+static void
+init_deadband(DeadbandState* state, ModelNode* dataObject)
+{
+    memset(state, 0, sizeof(*state));
+
+    state->db = find_attribute_child(dataObject, "db");
+    state->zeroDb = find_attribute_child(dataObject, "zeroDb");
+
+    DataAttribute* range = find_attribute_child(dataObject, "rangeC");
+
+    state->rangeMin = find_attribute_child((ModelNode*) find_attribute_child((ModelNode*) range, "min"), "f");
+    state->rangeMax = find_attribute_child((ModelNode*) find_attribute_child((ModelNode*) range, "max"), "f");
+
+    if ((state->zeroDb && !state->zeroDb->mmsValue) || !state->rangeMin || !state->rangeMin->mmsValue ||
+            !state->rangeMax || !state->rangeMax->mmsValue) {
+        state->rangeMin = state->rangeMax = NULL;
+    }
+}
+
+/* First pass (fill == false) only sizes the pool and table, second pass populates them */
+static void
+index_walk(HostedIed* ied, ModelNode* node, char* path, size_t len, DataAttribute* tAttr, bool fill)
+{
+    for (ModelNode* child = node->firstChild; child; child = child->sibling) {
+        if (child->name == NULL)
+            continue;
+
+        size_t nameLen = strlen(child->name);
+        size_t childLen = len + 1 + nameLen;
+
+        if (childLen >= 256)
+            continue;
+
+        path[len] = (ModelNode_getType(node) == LogicalDeviceModelType) ? '/' : '.';
+        memcpy(path + len + 1, child->name, nameLen + 1);
+
+        if (ModelNode_getType(child) == LogicalNodeModelType) {
+            index_walk(ied, child, path, childLen, NULL, fill);
+            continue;
+        }
+
+        if (ModelNode_getType(child) == DataObjectModelType) {
+            index_walk(ied, child, path, childLen, find_attribute_child(child, "t"), fill);
+            continue;
+        }
+
+        if (ModelNode_getType(child) != DataAttributeModelType)
+            continue;
+
+        DataAttribute* da = (DataAttribute*) child;
+
+        if (da->type == IEC61850_CONSTRUCTED) {
+            index_walk(ied, child, path, childLen, tAttr, fill);
+            continue;
+        }
+
+        bool isStVal = (ModelNode_getType(node) == DataObjectModelType) && (strcmp(child->name, "stVal") == 0);
+        ModelNode* deadbandDo = gStreamMode ? deadband_data_object(da) : NULL;
+
+        if (!fill) {
+            gAttrBindingCount++;
+            gRefPoolUsed += childLen + 1;
+            if (isStVal)
+                gAttrAliasCount++;
+            if (deadbandDo)
+                gDeadbandCount++;
+            continue;
+        }
+
+        AttributeBinding* binding = &gAttrBindings[gAttrBindingCount++];
+        char* reference = gRefPool + gRefPoolUsed;
+
+        memcpy(reference, path, childLen + 1);
+        gRefPoolUsed += childLen + 1;
+
+        binding->ied = ied;
+        binding->attr = da;
+        binding->reference = reference;
+        binding->type = bridge_type_for_attribute(da);
+
+        /* Only touch the DO timestamp for attributes of the same FC (stVal/q -> ST t, mag.f -> MX t) */
+        binding->tAttr = ((tAttr != NULL) && (tAttr != da) && (tAttr->fc == da->fc)) ? tAttr : NULL;
+
+        if (deadbandDo && ((binding->type == BRIDGE_TYPE_FLOAT) || (binding->type == BRIDGE_TYPE_INT32))) {
+            binding->deadband = &gDeadbands[gDeadbandCount++];
+            init_deadband(binding->deadband, deadbandDo);
+        }
+
+        index_insert(reference, childLen, binding);
+
+        if (isStVal) {
+            index_insert(reference, childLen - strlen(".stVal"), binding);
+            gAttrAliasCount++;
+        }
+    }
+}
+
+static void
+index_walk_model(HostedIed* ied, bool fill)
+{
+    char path[256];
+    IedModel* model = ied->model;
+    int ldCount = IedModel_getLogicalDeviceCount(model);
+
+    for (int i = 0; i < ldCount; i++) {
+        LogicalDevice* ld = IedModel_getDeviceByIndex(model, i);
+
+        if (ld->ldName)
+            snprintf(path, sizeof(path), "%s", ld->ldName);
+        else
+            snprintf(path, sizeof(path), "%s%s", model->name, ld->name);
+
+        index_walk(ied, (ModelNode*) ld, path, strlen(path), NULL, fill);
+    }
+}
+
+static bool
+build_reference_index(void)
+{
+    const char* stream = getenv("IEC_BRIDGE_STREAM");
+
+    gStreamMode = stream && (strcmp(stream, "1") == 0);
+    gAttrBindingCount = 0;
+    gAttrAliasCount = 0;
+    gDeadbandCount = 0;
+    gRefPoolUsed = 0;
+    for (int i = 0; i < gIedCount; i++)
+        index_walk_model(&gIeds[i], false);
+
+    uint32_t capacity = 16;
+    while (capacity < (uint32_t) (gAttrBindingCount + gAttrAliasCount) * 2)
+        capacity <<= 1;
+
+    gAttrBindings = (AttributeBinding*) calloc(gAttrBindingCount > 0 ? gAttrBindingCount : 1, sizeof(AttributeBinding));
+    gRefPool = (char*) malloc(gRefPoolUsed > 0 ? gRefPoolUsed : 1);
+    gIndexSlots = (IndexSlot*) calloc(capacity, sizeof(IndexSlot));
+    gDeadbands = (DeadbandState*) calloc(gDeadbandCount > 0 ? gDeadbandCount : 1, sizeof(DeadbandState));
+    gStagedSlots = (uint16_t*) calloc(gAttrBindingCount > 0 ? gAttrBindingCount : 1, sizeof(uint16_t));
+
+    if ((gAttrBindings == NULL) || (gRefPool == NULL) || (gIndexSlots == NULL) || (gDeadbands == NULL) ||
+            (gStagedSlots == NULL)) {
+        fprintf(stderr, "Failed to allocate bridge reference index\n");
+        return false;
+    }
+
+    gIndexMask = capacity - 1;
+    gAttrBindingCount = 0;
+    gAttrAliasCount = 0;
+    gDeadbandCount = 0;
+    gRefPoolUsed = 0;
+    for (int i = 0; i < gIedCount; i++)
+        index_walk_model(&gIeds[i], true);
+
+    printf("Indexed %d bridge attributes (%d stVal aliases, %u slots)\n", gAttrBindingCount, gAttrAliasCount, capacity);
+
+    if (gStreamMode)
+        printf("Streaming mode: %d deadbanded attributes, coalescing updates per batch\n", gDeadbandCount);
+
+    return true;
+}
+
+static void
+free_reference_index(void)
+{
+    free(gIndexSlots);
+    free(gRefPool);
+    free(gAttrBindings);
+    free(gDeadbands);
+    free(gStagedSlots);
+    gDeadbands = NULL;
+    gStagedSlots = NULL;
+    gIndexSlots = NULL;
+    gRefPool = NULL;
+    gAttrBindings = NULL;
+    gAttrBindingCount = 0;
+}
+
+// --- Bridge Logic ---
+
+/*
+ * Two stdin protocols are supported. The default is text, one "REF=VALUE"
+ * line per update. After the relay sends "PROTO binary" the backend
+ * publishes its handle table (the index of gAttrBindings) and from then on
+ * expects length-prefixed little-endian frames:
+ *
+ *   u16 length (bytes following this field) | u8 opcode | payload
+ *
+ *   BRIDGE_OP_UPDATE: u32 handle | u8 type | u8 flags | value | [u64 t ms]
+ *   BRIDGE_OP_BEGIN / BRIDGE_OP_COMMIT: no payload
+ *   BRIDGE_OP_SV_SAMPLES: u8 stream | samples (see Sampled Values)
+ *   BRIDGE_OP_STATS: no payload, same as the STATS line (see Metrics)
+ *   BRIDGE_OP_DATASET: u16 data set | u8 flags | [u64 t ms] | members
+ *       (see Data Set Index), like the "DATASET REF=v1;v2;..." line
+ *
+ * Value sizes follow the type tag (boolean and Dbpos 1, 32-bit types 4,
+ * int64 and UTC time 8); strings take the remainder of the frame. Dbpos
+ * values are the enumeration (0 intermediate, 1 off, 2 on, 3 bad), not raw
+ * bits.
+ *
+ * Updates are staged and applied under a single data model lock, sharing
+ * one timestamp, so reports see each batch as one change. A batch ends with
+ * the read burst it arrived in, or spans lines/frames from BEGIN to COMMIT.
+ * The lock is never held while waiting for input.
+ *
+ * After a "CREDIT" line the backend reports flow control on stdout: after
+ * every read burst that consumed input, the log writer prints (with its
+ * next flush, only the latest count)
+ *
+ *   BRIDGE_CREDIT <bytes consumed since start> <window bytes>
+ *
+ * The relay counts the bytes it has written and keeps no more than the
+ * window in flight; what it cannot send yet it coalesces to the latest
+ * value per reference (see scripts/modbus-relay.cjs).
+ */
+
+#define BRIDGE_INPUT_BUFFER_SIZE (64 * 1024 + 2)
+#define BRIDGE_OP_UPDATE 0x01
+#define BRIDGE_OP_BEGIN 0x02
+#define BRIDGE_OP_COMMIT 0x03
+#define BRIDGE_OP_SV_SAMPLES 0x04
+#define BRIDGE_OP_STATS 0x05
+#define BRIDGE_OP_DATASET 0x06
+#define BRIDGE_BATCH_CAPACITY 1024
+#define BRIDGE_CREDIT_WINDOW (4 * BRIDGE_INPUT_BUFFER_SIZE)
+#define BRIDGE_FLAG_TIMESTAMP 0x01
+
+typedef enum {
+    BRIDGE_PROTO_TEXT,
+    BRIDGE_PROTO_BINARY
+} BridgeProtocol;
+
+typedef struct {
+    BridgeValueType type;
+    union {
+        bool boolean;
+        int32_t int32;
+        uint32_t uint32;
+        float float32;
+        int64_t int64;
+        uint64_t timeMs;
+    } v;
+    char str[256];
+} BridgeValue;
+
+typedef struct {
+    const AttributeBinding* binding;
+    uint64_t timestampMs;
+    BridgeValue value;
+} StagedUpdate;
+
+static BridgeProtocol gBridgeProtocol = BRIDGE_PROTO_TEXT;
+static StagedUpdate gStaged[BRIDGE_BATCH_CAPACITY];
+static int gStagedCount = 0;
+static bool gInTransaction = false;
+static bool gCreditEnabled = false;
+static uint64_t gInputConsumed = 0;   /* bytes of stdin processed, for BRIDGE_CREDIT */
+static uint64_t gCreditAdvertised = 0;
+static uint64_t gInputArrivalNs = 0; /* when the current read burst arrived */
+static uint64_t gBatchArrivalNs = 0; /* when the first update of the staged batch arrived */
+
+static uint32_t
+read_u32le(const uint8_t* p)
+{
+    return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint64_t
+read_u64le(const uint8_t* p)
+{
+    return (uint64_t) read_u32le(p) | ((uint64_t) read_u32le(p + 4) << 32);
+}
+
+/* Converts between numeric representations, e.g. an integer-valued update for a FLOAT32 attribute */
+static bool
+coerce_bridge_value(BridgeValue* value, BridgeValueType target)
+{
+    if (value->type == target)
+        return true;
+
+    if ((target == BRIDGE_TYPE_NONE) || (target == BRIDGE_TYPE_STRING) || (value->type == BRIDGE_TYPE_STRING))
+        return false;
+
+    bool isReal = false;
+    double real = 0;
+    int64_t integer = 0;
+
+    switch (value->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        integer = value->v.boolean ? 1 : 0;
+        break;
+    case BRIDGE_TYPE_INT32:
+        integer = value->v.int32;
+        break;
+    case BRIDGE_TYPE_UINT32:
+    case BRIDGE_TYPE_BITSTRING:
+    case BRIDGE_TYPE_DBPOS:
+        integer = value->v.uint32;
+        break;
+    case BRIDGE_TYPE_FLOAT:
+        isReal = true;
+        real = value->v.float32;
+        break;
+    case BRIDGE_TYPE_INT64:
+        integer = value->v.int64;
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        integer = (int64_t) value->v.timeMs;
+        break;
+    default:
+        return false;
+    }
+
+    if (isReal)
+        integer = (int64_t) real;
+    else
+        real = (double) integer;
+
+    switch (target) {
+    case BRIDGE_TYPE_BOOLEAN:
+        value->v.boolean = isReal ? (real != 0) : (integer != 0);
+        break;
+    case BRIDGE_TYPE_INT32:
+        if ((integer < INT32_MIN) || (integer > INT32_MAX))
+            return false;
+        value->v.int32 = (int32_t) integer;
+        break;
+    case BRIDGE_TYPE_UINT32:
+    case BRIDGE_TYPE_BITSTRING:
+    case BRIDGE_TYPE_DBPOS:
+        if ((integer < 0) || (integer > UINT32_MAX))
+            return false;
+        value->v.uint32 = (uint32_t) integer;
+        break;
+    case BRIDGE_TYPE_FLOAT:
+        value->v.float32 = (float) real;
+        break;
+    case BRIDGE_TYPE_INT64:
+        value->v.int64 = integer;
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        value->v.timeMs = (uint64_t) integer;
+        break;
+    default:
+        return false;
+    }
+
+    value->type = target;
+
+    return true;
+}
+
+/*
+ * Text values are decoded in one pass by a parser chosen from the
+ * attribute's type. The parsers are locale independent and reject trailing
+ * garbage, out-of-range integers and unknown keywords.
+ */
+
+static const double gPow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static bool
+parse_real_text(const char* p, double* out)
+{
+    bool negative = false;
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exp10 = 0;
+    bool any = false;
+
+    if ((*p == '+') || (*p == '-'))
+        negative = (*p++ == '-');
+
+    for (; (*p >= '0') && (*p <= '9'); p++, any = true) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t) (*p - '0');
+            if (mantissa)
+                digits++;
+        }
+        else
+            exp10++;
+    }
+
+    if (*p == '.') {
+        for (p++; (*p >= '0') && (*p <= '9'); p++, any = true) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (uint64_t) (*p - '0');
+                if (mantissa)
+                    digits++;
+                exp10--;
+            }
+        }
+    }
+
+    if (!any)
+        return false;
+
+    if ((*p == 'e') || (*p == 'E')) {
+        bool expNegative = false;
+        int exponent = 0;
+
+        p++;
+        if ((*p == '+') || (*p == '-'))
+            expNegative = (*p++ == '-');
+
+        if ((*p < '0') || (*p > '9'))
+            return false;
+
+        for (; (*p >= '0') && (*p <= '9'); p++) {
+            if (exponent < 10000)
+                exponent = exponent * 10 + (*p - '0');
+        }
+
+        exp10 += expNegative ? -exponent : exponent;
+    }
+
+    if (*p != 0)
+        return false;
+
+    double result = (double) mantissa;
+
+    // Exact for the common case; larger exponents only need float32 precision
+    while (exp10 > 22) {
+        result *= 1e22;
+        exp10 -= 22;
+    }
+    while (exp10 < -22) {
+        result /= 1e22;
+        exp10 += 22;
+    }
+
+    result = (exp10 < 0) ? result / gPow10[-exp10] : result * gPow10[exp10];
+
+    *out = negative ? -result : result;
+
+    return true;
+}
+
+static bool
+parse_integer_text(const char* p, int64_t* out)
+{
+    bool negative = false;
+    uint64_t magnitude = 0;
+
+    if ((*p == '+') || (*p == '-'))
+        negative = (*p++ == '-');
+
+    if ((*p < '0') || (*p > '9'))
+        return false;
+
+    for (; (*p >= '0') && (*p <= '9'); p++) {
+        if (magnitude > (UINT64_MAX - 9) / 10)
+            return false;
+        magnitude = magnitude * 10 + (uint64_t) (*p - '0');
+    }
+
+    if ((*p != 0) || (magnitude > (uint64_t) INT64_MAX + (negative ? 1 : 0)))
+        return false;
+
+    *out = negative ? (int64_t) (0 - magnitude) : (int64_t) magnitude;
+
+    return true;
+}
+
+/* Hex with or without 0x prefix (0x0040) or a decimal value */
+static bool
+parse_bits_text(const char* p, uint32_t* out)
+{
+    uint64_t bits = 0;
+
+    if ((p[0] != '0') || ((p[1] != 'x') && (p[1] != 'X'))) {
+        int64_t decimal;
+
+        if (!parse_integer_text(p, &decimal) || (decimal < 0) || (decimal > UINT32_MAX))
+            return false;
+
+        *out = (uint32_t) decimal;
+        return true;
+    }
+
+    p += 2;
+
+    if (*p == 0)
+        return false;
+
+    for (; *p; p++) {
+        int nibble;
+
+        if ((*p >= '0') && (*p <= '9'))
+            nibble = *p - '0';
+        else if ((*p >= 'a') && (*p <= 'f'))
+            nibble = *p - 'a' + 10;
+        else if ((*p >= 'A') && (*p <= 'F'))
+            nibble = *p - 'A' + 10;
+        else
+            return false;
+
+        bits = (bits << 4) | (uint64_t) nibble;
+
+        if (bits > UINT32_MAX)
+            return false;
+    }
+
+    *out = (uint32_t) bits;
+
+    return true;
+}
+
+/* Quality as bits or as '|' separated keywords, e.g. "invalid|test" */
+static bool
+parse_quality_text(const char* p, uint32_t* out)
+{
+    static const struct {
+        const char* name;
+        uint32_t bits;
+    } keywords[] = {
+        { "good", QUALITY_VALIDITY_GOOD },
+        { "invalid", QUALITY_VALIDITY_INVALID },
+        { "questionable", QUALITY_VALIDITY_QUESTIONABLE },
+        { "overflow", QUALITY_DETAIL_OVERFLOW },
+        { "outofrange", QUALITY_DETAIL_OUT_OF_RANGE },
+        { "badreference", QUALITY_DETAIL_BAD_REFERENCE },
+        { "oscillatory", QUALITY_DETAIL_OSCILLATORY },
+        { "failure", QUALITY_DETAIL_FAILURE },
+        { "olddata", QUALITY_DETAIL_OLD_DATA },
+        { "inconsistent", QUALITY_DETAIL_INCONSISTENT },
+        { "inaccurate", QUALITY_DETAIL_INACCURATE },
+        { "substituted", QUALITY_SOURCE_SUBSTITUTED },
+        { "test", QUALITY_TEST },
+        { "blocked", QUALITY_OPERATOR_BLOCKED },
+        { "derived", QUALITY_DERIVED }
+    };
+
+    if ((*p >= '0') && (*p <= '9'))
+        return parse_bits_text(p, out);
+
+    uint32_t bits = 0;
+
+    // An empty value or keyword ("", "invalid|") matches no keyword and is refused
+    for (;;) {
+        size_t len = strcspn(p, "|");
+        bool found = false;
+
+        for (size_t i = 0; i < sizeof(keywords) / sizeof(keywords[0]); i++) {
+            if ((strlen(keywords[i].name) == len) && (strncasecmp(p, keywords[i].name, len) == 0)) {
+                bits |= keywords[i].bits;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+            return false;
+
+        p += len;
+        if (*p == 0)
+            break;
+        p++;
+    }
+
+    *out = bits;
+
+    return true;
+}
+
+static bool
+parse_dbpos_text(const char* p, uint32_t* out)
+{
+    static const char* names[] = { "intermediate", "off", "on", "bad" };
+
+    for (uint32_t i = 0; i < 4; i++) {
+        if (strcasecmp(p, names[i]) == 0) {
+            *out = i;
+            return true;
+        }
+    }
+
+    int64_t number;
+
+    if (!parse_integer_text(p, &number) || (number < 0) || (number > 3))
+        return false;
+
+    *out = (uint32_t) number;
+
+    return true;
+}
+
+static int64_t
+days_from_civil(int64_t year, unsigned month, unsigned day)
+{
+    year -= (month <= 2);
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yoe = (unsigned) (year - era * 400);
+    unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + (int64_t) doe - 719468;
+}
+
+static bool
+parse_fixed_digits(const char** p, int count, unsigned* out)
+{
+    unsigned value = 0;
+
+    for (int i = 0; i < count; i++) {
+        if (((*p)[i] < '0') || ((*p)[i] > '9'))
+            return false;
+        value = value * 10 + (unsigned) ((*p)[i] - '0');
+    }
+
+    *p += count;
+    *out = value;
+
+    return true;
+}
+
+/* Milliseconds since epoch, or ISO 8601 UTC "2024-05-01T12:30:00.250Z" */
+static bool
+parse_utc_text(const char* p, uint64_t* out)
+{
+    if (strchr(p, '-') == NULL) {
+        int64_t ms;
+
+        if (!parse_integer_text(p, &ms) || (ms < 0))
+            return false;
+
+        *out = (uint64_t) ms;
+        return true;
+    }
+
+    unsigned year, month, day, hour, minute, second, millis = 0;
+
+    if (!parse_fixed_digits(&p, 4, &year) || (*p++ != '-') || !parse_fixed_digits(&p, 2, &month) ||
+            (*p++ != '-') || !parse_fixed_digits(&p, 2, &day))
+        return false;
+
+    if ((*p != 'T') && (*p != ' '))
+        return false;
+    p++;
+
+    if (!parse_fixed_digits(&p, 2, &hour) || (*p++ != ':') || !parse_fixed_digits(&p, 2, &minute) ||
+            (*p++ != ':') || !parse_fixed_digits(&p, 2, &second))
+        return false;
+
+    if (*p == '.') {
+        unsigned scale = 100;
+
+        for (p++; (*p >= '0') && (*p <= '9'); p++) {
+            millis += (unsigned) (*p - '0') * scale;
+            scale /= 10;
+        }
+    }
+
+    if ((*p == 'Z') && (p[1] == 0))
+        p++;
+
+    if ((*p != 0) || (month < 1) || (month > 12) || (day < 1) || (day > 31) || (hour > 23) || (minute > 59) || (second > 60))
+        return false;
+
+    int64_t days = days_from_civil(year, month, day);
+
+    *out = (uint64_t) (((days * 24 + hour) * 60 + minute) * 60 + second) * 1000 + millis;
+
+    return true;
+}
+
+static void
+integer_range_for_attribute(const DataAttribute* da, int64_t* min, int64_t* max)
+{
+    switch (da->type) {
+    case IEC61850_INT8:
+        *min = INT8_MIN; *max = INT8_MAX;
+        break;
+    case IEC61850_INT16:
+        *min = INT16_MIN; *max = INT16_MAX;
+        break;
+    case IEC61850_INT8U:
+        *min = 0; *max = UINT8_MAX;
+        break;
+    case IEC61850_INT16U:
+        *min = 0; *max = UINT16_MAX;
+        break;
+    case IEC61850_INT24U:
+        *min = 0; *max = 0xffffff;
+        break;
+    case IEC61850_INT32U:
+        *min = 0; *max = UINT32_MAX;
+        break;
+    case IEC61850_INT64:
+        *min = INT64_MIN; *max = INT64_MAX;
+        break;
+    default:
+        *min = INT32_MIN; *max = INT32_MAX;
+        break;
+    }
+}
+
+/* Final check shared by the text and binary paths once value->type == binding->type */
+static bool
+bridge_value_in_range(const AttributeBinding* binding, const BridgeValue* value)
+{
+    int64_t min, max;
+
+    switch (value->type) {
+    case BRIDGE_TYPE_INT32:
+        integer_range_for_attribute(binding->attr, &min, &max);
+        return (value->v.int32 >= min) && (value->v.int32 <= max);
+    case BRIDGE_TYPE_UINT32:
+        integer_range_for_attribute(binding->attr, &min, &max);
+        return (value->v.uint32 <= max);
+    case BRIDGE_TYPE_DBPOS:
+        return value->v.uint32 <= DBPOS_BAD_STATE;
+    default:
+        return true;
+    }
+}
+
+/* Parses a text update straight into the attribute's native type */
+static bool
+parse_text_value(const AttributeBinding* binding, const char* text, BridgeValue* value)
+{
+    BridgeValueType type = binding->type;
+    int64_t integer;
+    double real;
+
+    // Booleans from the simulation arrive as "true"/"false" for any attribute type
+    if ((type != BRIDGE_TYPE_STRING) && ((strcasecmp(text, "true") == 0) || (strcasecmp(text, "false") == 0))) {
+        value->type = BRIDGE_TYPE_BOOLEAN;
+        value->v.boolean = (strcasecmp(text, "true") == 0);
+        return coerce_bridge_value(value, type) && bridge_value_in_range(binding, value);
+    }
+
+    value->type = type;
+
+    switch (type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        if (!parse_integer_text(text, &integer))
+            return false;
+        value->v.boolean = (integer != 0);
+        return true;
+    case BRIDGE_TYPE_INT32:
+        if (!parse_integer_text(text, &integer) || (integer < INT32_MIN) || (integer > INT32_MAX))
+            return false;
+        value->v.int32 = (int32_t) integer;
+        break;
+    case BRIDGE_TYPE_UINT32:
+        if (!parse_integer_text(text, &integer) || (integer < 0) || (integer > UINT32_MAX))
+            return false;
+        value->v.uint32 = (uint32_t) integer;
+        break;
+    case BRIDGE_TYPE_FLOAT:
+        if (!parse_real_text(text, &real))
+            return false;
+        value->v.float32 = (float) real;
+        return true;
+    case BRIDGE_TYPE_INT64:
+        return parse_integer_text(text, &value->v.int64);
+    case BRIDGE_TYPE_BITSTRING:
+        if (binding->attr->type == IEC61850_QUALITY)
+            return parse_quality_text(text, &value->v.uint32);
+        return parse_bits_text(text, &value->v.uint32);
+    case BRIDGE_TYPE_DBPOS:
+        return parse_dbpos_text(text, &value->v.uint32);
+    case BRIDGE_TYPE_UTCTIME:
+        return parse_utc_text(text, &value->v.timeMs);
+    case BRIDGE_TYPE_STRING:
+        snprintf(value->str, sizeof(value->str), "%s", text);
+        return true;
+    default:
+        return false;
+    }
+
+    return bridge_value_in_range(binding, value);
+}
+
+/*
+ * Deadband check for a magnitude, called with the data model locked. A
+ * change counts once it exceeds db (0.001 % of rangeC, or of the last
+ * reported value when the DO has no range); with a range, values within
+ * zeroDb of zero are clamped to zero. Returns true if the update stays
+ * inside the deadband.
+ */
+static bool
+deadband_absorbs(DeadbandState* state, double* value)
+{
+    double range = fabs(state->reported);
+
+    if (state->rangeMin) {
+        range = fabs((double) MmsValue_toFloat(state->rangeMax->mmsValue) - (double) MmsValue_toFloat(state->rangeMin->mmsValue));
+
+        if (state->zeroDb && (fabs(*value) <= range * MmsValue_toUint32(state->zeroDb->mmsValue) / 100000.0))
+            *value = 0;
+    }
+
+    double threshold = range * MmsValue_toUint32(state->db->mmsValue) / 100000.0;
+
+    if (state->hasReported && (fabs(*value - state->reported) <= threshold))
+        return true;
+
+    state->reported = *value;
+    state->hasReported = true;
+
+    return false;
+}
+
+/* Expects value->type to already match binding->type */
+static bool
+apply_bridge_value(const AttributeBinding* binding, const BridgeValue* value, uint64_t timestampMs)
+{
+    DataAttribute* attr = binding->attr;
+    IedServer server = binding->ied->server;
+    BridgeValue clamped;
+
+    if (binding->deadband) {
+        double magnitude = (binding->type == BRIDGE_TYPE_FLOAT) ? value->v.float32 : value->v.int32;
+        double original = magnitude;
+        bool absorbed = deadband_absorbs(binding->deadband, &magnitude);
+
+        if (magnitude != original) {
+            clamped = *value;
+            if (binding->type == BRIDGE_TYPE_FLOAT)
+                clamped.v.float32 = (float) magnitude;
+            else
+                clamped.v.int32 = (int32_t) magnitude;
+            value = &clamped;
+        }
+
+        // Inside the deadband the shadow value is written without report processing:
+        // reads, GI and integrity reports see it, data-change reports and 't' do not
+        if (absorbed) {
+            if (binding->type == BRIDGE_TYPE_FLOAT)
+                MmsValue_setFloat(attr->mmsValue, value->v.float32);
+            else
+                MmsValue_setInt32(attr->mmsValue, value->v.int32);
+            return true;
+        }
+    }
+
+    switch (binding->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        IedServer_updateBooleanAttributeValue(server, attr, value->v.boolean);
+        break;
+    case BRIDGE_TYPE_INT32:
+        IedServer_updateInt32AttributeValue(server, attr, value->v.int32);
+        break;
+    case BRIDGE_TYPE_UINT32:
+        IedServer_updateUnsignedAttributeValue(server, attr, value->v.uint32);
+        break;
+    case BRIDGE_TYPE_FLOAT:
+        IedServer_updateFloatAttributeValue(server, attr, value->v.float32);
+        break;
+    case BRIDGE_TYPE_INT64:
+        IedServer_updateInt64AttributeValue(server, attr, value->v.int64);
+        break;
+    case BRIDGE_TYPE_BITSTRING:
+        if (attr->type == IEC61850_QUALITY)
+            IedServer_updateQuality(server, attr, (Quality) value->v.uint32);
+        else
+            IedServer_updateBitStringAttributeValue(server, attr, value->v.uint32);
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        IedServer_updateUTCTimeAttributeValue(server, attr, value->v.timeMs);
+        break;
+    case BRIDGE_TYPE_STRING:
+        IedServer_updateVisibleStringAttributeValue(server, attr, (char*) value->str);
+        break;
+    case BRIDGE_TYPE_DBPOS:
+        IedServer_updateDbposValue(server, attr, (Dbpos) value->v.uint32);
+        break;
+    default:
+        return false;
+    }
+
+    // Also update timestamp 't' if it exists in the same DO
+    if (binding->tAttr)
+        IedServer_updateUTCTimeAttributeValue(server, binding->tAttr, timestampMs ? timestampMs : Hal_getTimeInMs());
+
+    return true;
+}
+
+/*
+ * Applies the updates of one batch that belong to the IEDs of `worker` (-1
+ * for all). `staged` is indexed modulo `mask + 1`, so the same code serves
+ * the linear staging array and a worker queue. Each IED touched by the
+ * batch is locked once; the others are skipped.
+ */
+static void
+apply_staged_batch(int worker, const StagedUpdate* staged, unsigned first, unsigned count, unsigned mask,
+        uint64_t batchTimeMs, uint64_t arrivalNs)
+{
+    for (int n = 0; n < gIedCount; n++) {
+        HostedIed* ied = &gIeds[n];
+        bool locked = false;
+
+        if ((worker >= 0) && (ied->worker != worker))
+            continue;
+
+        // Explicit writes to timestamp attributes go last so they win over the automatic DO 't' update
+        for (int pass = 0; pass < 2; pass++) {
+            for (unsigned i = 0; i < count; i++) {
+                const StagedUpdate* update = &staged[(first + i) & mask];
+
+                if ((update->binding->ied != ied) || ((update->binding->type == BRIDGE_TYPE_UTCTIME) != (pass == 1)))
+                    continue;
+
+                if (!locked) {
+                    IedServer_lockDataModel(ied->server);
+                    locked = true;
+                }
+
+                apply_bridge_value(update->binding, &update->value, update->timestampMs ? update->timestampMs : batchTimeMs);
+            }
+        }
+
+        // Reports triggered by the batch may already be created while unlocking
+        if (locked) {
+            unsigned long long idle = 0;
+
+            atomic_compare_exchange_strong_explicit(&ied->reportPendingNs, &idle, arrivalNs, memory_order_relaxed,
+                    memory_order_relaxed);
+
+            IedServer_unlockDataModel(ied->server);
+        }
+    }
+}
+
+// --- Workers ---
+
+/*
+ * IEC_BACKEND_WORKERS=<n> moves MMS service off the main loop into n
+ * threads. IED i belongs to worker i % n, which alone calls its IedServer
+ * (threadless mode) and therefore runs its control handlers. Workers are
+ * pinned to CPUs, by default the first n the process may run on, or the
+ * list in IEC_BACKEND_CPUS ("2,3,4,5").
+ *
+ * The main loop stays the single bridge dispatcher. On commit it copies
+ * each staged update into the queue of the worker owning its IED, closes
+ * the batch with a marker entry carrying the batch time (and, in its
+ * value, the arrival time for Metrics), and publishes the
+ * whole batch with one release store. Each queue is single-producer/
+ * single-consumer, so no locks are shared between threads. A worker picks
+ * up new batches between MMS wait slices. When a queue is full the
+ * dispatcher waits, which pushes back on the relay through stdin.
+ */
+
+#define BRIDGE_WORKER_QUEUE_SIZE 2048 /* power of two, more than one full batch */
+
+typedef struct {
+    int index;
+    int cpu; /* -1 to leave placement to the scheduler */
+    Thread thread;
+    LogRing controlLog;
+    unsigned pendingHead; /* dispatcher-private */
+    _Alignas(64) atomic_uint head;
+    _Alignas(64) atomic_uint tail;
+    StagedUpdate queue[BRIDGE_WORKER_QUEUE_SIZE]; /* binding == NULL marks the end of a batch */
+} BridgeWorker;
+
+static BridgeWorker* gWorkers = NULL;
+static int gWorkerCount = 0;
+static atomic_int gWorkersRunning;
+
+static unsigned
+worker_queue_free(BridgeWorker* worker)
+{
+    return BRIDGE_WORKER_QUEUE_SIZE - (worker->pendingHead - atomic_load_explicit(&worker->tail, memory_order_acquire));
+}
+
+static void
+dispatch_staged_updates(uint64_t batchTimeMs, uint64_t arrivalNs)
+{
+    unsigned counts[BRIDGE_MAX_IEDS] = { 0 };
+
+    for (int i = 0; i < gStagedCount; i++)
+        counts[gStaged[i].binding->ied->worker]++;
+
+    for (int w = 0; w < gWorkerCount; w++) {
+        while (counts[w] && (worker_queue_free(&gWorkers[w]) < counts[w] + 1))
+            Thread_sleep(1);
+    }
+
+    for (int i = 0; i < gStagedCount; i++) {
+        BridgeWorker* worker = &gWorkers[gStaged[i].binding->ied->worker];
+        StagedUpdate* slot = &worker->queue[worker->pendingHead++ & (BRIDGE_WORKER_QUEUE_SIZE - 1)];
+        const StagedUpdate* staged = &gStaged[i];
+
+        slot->binding = staged->binding;
+        slot->timestampMs = staged->timestampMs;
+        slot->value.type = staged->value.type;
+        slot->value.v = staged->value.v;
+
+        if (staged->value.type == BRIDGE_TYPE_STRING)
+            strcpy(slot->value.str, staged->value.str);
+    }
+
+    for (int w = 0; w < gWorkerCount; w++) {
+        BridgeWorker* worker = &gWorkers[w];
+
+        if (counts[w] == 0)
+            continue;
+
+        StagedUpdate* marker = &worker->queue[worker->pendingHead++ & (BRIDGE_WORKER_QUEUE_SIZE - 1)];
+        marker->binding = NULL;
+        marker->timestampMs = batchTimeMs;
+        marker->value.v.int64 = (int64_t) arrivalNs;
+
+        atomic_store_explicit(&worker->head, worker->pendingHead, memory_order_release);
+    }
+}
+
+static void
+worker_drain_queue(BridgeWorker* worker)
+{
+    unsigned tail = atomic_load_explicit(&worker->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&worker->head, memory_order_acquire);
+    unsigned first = tail;
+
+    // The dispatcher publishes whole batches only, so the range always ends with a marker
+    while (tail != head) {
+        const StagedUpdate* entry = &worker->queue[tail & (BRIDGE_WORKER_QUEUE_SIZE - 1)];
+
+        if (entry->binding == NULL) {
+            apply_staged_batch(worker->index, worker->queue, first, tail - first, BRIDGE_WORKER_QUEUE_SIZE - 1,
+                    entry->timestampMs, (uint64_t) entry->value.v.int64);
+            first = tail + 1;
+        }
+
+        tail++;
+    }
+
+    atomic_store_explicit(&worker->tail, tail, memory_order_release);
+}
+
+static void
+pin_current_thread(int cpu)
+{
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    int result = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+
+    if (result != 0)
+        fprintf(stderr, "Failed to pin worker to CPU %d: %s\n", cpu, strerror(result));
+}
+
+static void*
+bridge_worker_thread(void* arg)
+{
+    BridgeWorker* worker = (BridgeWorker*) arg;
+
+    tControlLogRing = &worker->controlLog;
+    tMetrics = &gMetricsShards[worker->index + 1];
+
+    if (worker->cpu >= 0)
+        pin_current_thread(worker->cpu);
+
+    while (atomic_load_explicit(&gWorkersRunning, memory_order_relaxed)) {
+        worker_drain_queue(worker);
+
+        // Only the last owned server waits, and only if none of the others had input
+        bool busy = false;
+        int last = -1;
+
+        for (int i = 0; i < gIedCount; i++) {
+            if (gIeds[i].worker == worker->index)
+                last = i;
+        }
+
+        for (int i = 0; i <= last; i++) {
+            if (gIeds[i].worker != worker->index)
+                continue;
+
+            IedServer server = gIeds[i].server;
+            unsigned int waitMs = (!busy && (i == last)) ? BRIDGE_MMS_WAIT_MS : 0;
+
+            if (IedServer_waitReady(server, waitMs) > 0) {
+                IedServer_processIncomingData(server);
+                busy = true;
+            }
+
+            IedServer_performPeriodicTasks(server);
+        }
+    }
+
+    // Batches committed before shutdown still reach the model
+    worker_drain_queue(worker);
+
+    return NULL;
+}
+
+/* Assigns IEDs to workers; must run before the log writer starts */
+static bool
+create_workers(void)
+{
+    for (int i = 0; i < gIedCount; i++)
+        gIeds[i].worker = -1;
+
+    const char* countText = getenv("IEC_BACKEND_WORKERS");
+    int count = countText ? atoi(countText) : 0;
+
+    if (count <= 0)
+        return true;
+
+    if (count > gIedCount)
+        count = gIedCount;
+
+    gWorkers = (BridgeWorker*) calloc((size_t) count, sizeof(BridgeWorker));
+
+    if (gWorkers == NULL) {
+        fprintf(stderr, "Failed to allocate %d bridge workers\n", count);
+        return false;
+    }
+
+    gWorkerCount = count;
+
+    cpu_set_t allowed;
+    int allowedCpus[CPU_SETSIZE];
+    int allowedCount = 0;
+
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &allowed))
+                allowedCpus[allowedCount++] = cpu;
+        }
+    }
+
+    const char* cpuList = getenv("IEC_BACKEND_CPUS");
+
+    for (int w = 0; w < count; w++) {
+        BridgeWorker* worker = &gWorkers[w];
+
+        worker->index = w;
+        worker->cpu = (allowedCount > 0) ? allowedCpus[w % allowedCount] : -1;
+
+        if (cpuList && *cpuList) {
+            worker->cpu = atoi(cpuList);
+            cpuList = strchr(cpuList, ',');
+            cpuList = cpuList ? cpuList + 1 : NULL;
+        }
+
+        gThreadLogRings[gThreadLogRingCount++] = &worker->controlLog;
+    }
+
+    for (int i = 0; i < gIedCount; i++)
+        gIeds[i].worker = i % count;
+
+    return true;
+}
+
+/* Starts the workers once their servers are running */
+static void
+start_workers(void)
+{
+    atomic_store(&gWorkersRunning, 1);
+
+    for (int w = 0; w < gWorkerCount; w++) {
+        BridgeWorker* worker = &gWorkers[w];
+
+        worker->thread = Thread_create(bridge_worker_thread, worker, false);
+        Thread_start(worker->thread);
+
+        if (worker->cpu >= 0)
+            printf("Bridge worker %d on CPU %d\n", w, worker->cpu);
+    }
+}
+
+/* Joins the workers after they have applied every dispatched batch; their control rings stay for the log writer */
+static void
+stop_workers(void)
+{
+    atomic_store(&gWorkersRunning, 0);
+
+    for (int w = 0; w < gWorkerCount; w++) {
+        if (gWorkers[w].thread)
+            Thread_destroy(gWorkers[w].thread);
+
+        gWorkers[w].thread = NULL;
+    }
+}
+
+// --- Sampled Values ---
+
+/*
+ * IEC_SV_INTERFACE=<ifname> starts an IEC 61850-9-2LE publisher. Every
+ * stream is one ASDU of eight INT32/quality pairs (Ia, Ib, Ic, In in mA,
+ * Va, Vb, Vc, Vn in 10 mV) sent IEC_SV_RATE times per second (4000, or
+ * 4800 for 60 Hz). IEC_SV_STREAMS lists the streams as "svID[@appId]" (hex
+ * appId); by default each hosted IED gets "<IED>MU01". Stream n uses appId
+ * 0x4000 + n and destination 01:0C:CD:04:00:<n> unless given.
+ *
+ * The relay feeds waveforms in bulk with BRIDGE_OP_SV_SAMPLES frames
+ *
+ *   u8 stream | n x 8 x i32 (channel order above)
+ *
+ * queued into one single-producer/single-consumer ring per stream. One
+ * publisher thread, SCHED_FIFO at IEC_SV_PRIORITY (default 80) and pinned
+ * to IEC_SV_CPU if set, sends the next sample of every stream on an
+ * absolute CLOCK_MONOTONIC schedule. The publishers and their ASDUs are
+ * built once at startup; the send path only sets values. When a ring runs
+ * dry the last sample is repeated with questionable/oldData quality. Once
+ * per second each stream reports
+ *
+ *   SV_STATS stream=<n> sent=<n> underruns=<n> overruns=<n> jitter_avg_us=<n> jitter_max_us=<n>
+ *
+ * where jitter is the wake-up lateness against the schedule and overruns
+ * counts samples dropped because the ring was full.
+ */
+
+#define SV_CHANNELS 8
+#define SV_RING_SIZE 16384 /* power of two; 4 s at 4000 samples/s */
+#define SV_MAX_STREAMS 8
+#define SV_STATS_NS 1000000000ull
+
+typedef struct {
+    int32_t values[SV_CHANNELS];
+} SvSample;
+
+typedef struct {
+    char svId[65];
+    CommParameters params;
+    SVPublisher publisher;
+    SVPublisher_ASDU asdu;
+    int valueIndex[SV_CHANNELS];
+    int qualityIndex[SV_CHANNELS];
+    uint16_t smpCnt;
+    bool stale;
+    SvSample last;
+    uint64_t sent;             /* publisher thread */
+    uint64_t underruns;        /* publisher thread */
+    atomic_ullong overruns;    /* dispatcher */
+    _Alignas(64) atomic_uint head;
+    _Alignas(64) atomic_uint tail;
+    SvSample ring[SV_RING_SIZE];
+} SvStream;
+
+static SvStream* gSvStreams = NULL;
+static int gSvStreamCount = 0;
+static unsigned gSvRate = 4000;
+static int gSvPriority = 80;
+static int gSvCpu = -1;
+static Thread gSvThread = NULL;
+static atomic_int gSvRunning;
+static LogRing gSvLogRing;
+
+static bool
+sv_add_stream(const char* iface, const char* svId, uint16_t appId)
+{
+    if (gSvStreamCount == SV_MAX_STREAMS) {
+        fprintf(stderr, "At most %d SV streams can be published\n", SV_MAX_STREAMS);
+        return false;
+    }
+
+    SvStream* stream = &gSvStreams[gSvStreamCount];
+    static const uint8_t dstAddress[6] = { 0x01, 0x0c, 0xcd, 0x04, 0x00, 0x00 };
+
+    snprintf(stream->svId, sizeof(stream->svId), "%s", svId);
+    stream->params.vlanPriority = 4;
+    stream->params.vlanId = 0;
+    stream->params.appId = appId ? appId : (uint16_t) (0x4000 + gSvStreamCount);
+    memcpy(stream->params.dstAddress, dstAddress, sizeof(dstAddress));
+    stream->params.dstAddress[5] = (uint8_t) gSvStreamCount;
+
+    stream->publisher = SVPublisher_create(&stream->params, iface);
+
+    if (stream->publisher == NULL) {
+        fprintf(stderr, "Failed to create SV publisher on %s (raw socket access is required)\n", iface);
+        return false;
+    }
+
+    stream->asdu = SVPublisher_addASDU(stream->publisher, stream->svId, NULL, 1);
+
+    for (int ch = 0; ch < SV_CHANNELS; ch++) {
+        stream->valueIndex[ch] = SVPublisher_ASDU_addINT32(stream->asdu);
+        stream->qualityIndex[ch] = SVPublisher_ASDU_addQuality(stream->asdu);
+    }
+
+    SVPublisher_setupComplete(stream->publisher);
+
+    gSvStreamCount++;
+
+    return true;
+}
+
+static void
+sv_destroy_streams(void)
+{
+    for (int i = 0; i < gSvStreamCount; i++)
+        SVPublisher_destroy(gSvStreams[i].publisher);
+
+    free(gSvStreams);
+    gSvStreams = NULL;
+    gSvStreamCount = 0;
+}
+
+/* Creates the configured streams; must run before the log writer starts. SV stays off if setup fails. */
+static bool
+sv_setup(void)
+{
+    const char* iface = getenv("IEC_SV_INTERFACE");
+
+    if ((iface == NULL) || (*iface == 0))
+        return true;
+
+    const char* rate = getenv("IEC_SV_RATE");
+    const char* priority = getenv("IEC_SV_PRIORITY");
+    const char* cpu = getenv("IEC_SV_CPU");
+
+    gSvRate = (rate && (atoi(rate) == 4800)) ? 4800 : 4000;
+    gSvPriority = priority ? atoi(priority) : 80;
+    gSvCpu = (cpu && *cpu) ? atoi(cpu) : -1;
+
+    gSvStreams = (SvStream*) calloc(SV_MAX_STREAMS, sizeof(SvStream));
+
+    if (gSvStreams == NULL) {
+        fprintf(stderr, "Failed to allocate SV streams\n");
+        return false;
+    }
+
+    const char* list = getenv("IEC_SV_STREAMS");
+    bool ok = true;
+
+    if (list && *list) {
+        char* specs = strdup(list);
+        char* save = NULL;
+
+        for (char* spec = strtok_r(specs, ",", &save); ok && spec; spec = strtok_r(NULL, ",", &save)) {
+            char* at = strchr(spec, '@');
+            uint16_t appId = 0;
+
+            if (at) {
+                *at = 0;
+                appId = (uint16_t) strtoul(at + 1, NULL, 16);
+            }
+
+            ok = sv_add_stream(iface, spec, appId);
+        }
+
+        free(specs);
+    }
+    else {
+        for (int i = 0; ok && (i < gIedCount) && (i < SV_MAX_STREAMS); i++) {
+            char svId[65];
+
+            snprintf(svId, sizeof(svId), "%sMU01", gIeds[i].model->name);
+            ok = sv_add_stream(iface, svId, 0);
+        }
+    }
+
+    if (!ok) {
+        sv_destroy_streams();
+        fprintf(stderr, "Sampled values disabled\n");
+        return true;
+    }
+
+    gThreadLogRings[gThreadLogRingCount++] = &gSvLogRing;
+
+    for (int i = 0; i < gSvStreamCount; i++)
+        printf("BRIDGE_SV %d %s %u\n", i, gSvStreams[i].svId, gSvRate);
+
+    return true;
+}
+
+/* Dispatcher side: queues `count` samples of little-endian i32 channels */
+static void
+sv_enqueue(int index, const uint8_t* data, size_t count)
+{
+    SvStream* stream = &gSvStreams[index];
+    unsigned head = atomic_load_explicit(&stream->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&stream->tail, memory_order_acquire);
+    size_t room = SV_RING_SIZE - (head - tail);
+
+    if (count > room) {
+        atomic_fetch_add_explicit(&stream->overruns, count - room, memory_order_relaxed);
+        count = room;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        SvSample* sample = &stream->ring[(head + i) & (SV_RING_SIZE - 1)];
+
+        for (int ch = 0; ch < SV_CHANNELS; ch++)
+            sample->values[ch] = (int32_t) read_u32le(data + (i * SV_CHANNELS + ch) * 4);
+    }
+
+    atomic_store_explicit(&stream->head, head + (unsigned) count, memory_order_release);
+}
+
+static void
+sv_publish_next(SvStream* stream)
+{
+    unsigned tail = atomic_load_explicit(&stream->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&stream->head, memory_order_acquire);
+    bool stale = (tail == head);
+
+    if (!stale) {
+        stream->last = stream->ring[tail & (SV_RING_SIZE - 1)];
+        atomic_store_explicit(&stream->tail, tail + 1, memory_order_release);
+    }
+    else {
+        stream->underruns++;
+    }
+
+    for (int ch = 0; ch < SV_CHANNELS; ch++)
+        SVPublisher_ASDU_setINT32(stream->asdu, stream->valueIndex[ch], stream->last.values[ch]);
+
+    if (stale != stream->stale) {
+        Quality quality = stale ? (QUALITY_VALIDITY_QUESTIONABLE | QUALITY_DETAIL_OLD_DATA) : QUALITY_VALIDITY_GOOD;
+
+        for (int ch = 0; ch < SV_CHANNELS; ch++)
+            SVPublisher_ASDU_setQuality(stream->asdu, stream->qualityIndex[ch], quality);
+
+        stream->stale = stale;
+    }
+
+    SVPublisher_ASDU_setSmpCnt(stream->asdu, stream->smpCnt);
+    stream->smpCnt = (uint16_t) ((stream->smpCnt + 1) % gSvRate);
+
+    SVPublisher_publish(stream->publisher);
+    stream->sent++;
+}
+
+static void*
+sv_publisher_thread(void* arg)
+{
+    (void) arg;
+    struct sched_param param;
+
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = gSvPriority;
+
+    int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+
+    if (result != 0)
+        fprintf(stderr, "SV publisher runs without SCHED_FIFO: %s\n", strerror(result));
+
+    if (gSvCpu >= 0)
+        pin_current_thread(gSvCpu);
+
+    uint64_t startNs = monotonic_ns();
+    uint64_t nextStatsNs = startNs + SV_STATS_NS;
+    uint64_t sample = 0;
+    uint64_t jitterSumNs = 0, jitterMaxNs = 0, wakeups = 0;
+    uint64_t lastSent[SV_MAX_STREAMS] = { 0 }, lastUnderruns[SV_MAX_STREAMS] = { 0 };
+    unsigned long long lastOverruns[SV_MAX_STREAMS] = { 0 };
+
+    // Every deadline is derived from the start time, so rounding of 1e9 / rate never accumulates
+    while (atomic_load_explicit(&gSvRunning, memory_order_relaxed)) {
+        sample++;
+
+        uint64_t deadlineNs = startNs + sample * 1000000000ull / gSvRate;
+        struct timespec deadline = { (time_t) (deadlineNs / 1000000000ull), (long) (deadlineNs % 1000000000ull) };
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+            ;
+
+        uint64_t nowNs = monotonic_ns();
+        uint64_t lateNs = (nowNs > deadlineNs) ? nowNs - deadlineNs : 0;
+
+        for (int i = 0; i < gSvStreamCount; i++)
+            sv_publish_next(&gSvStreams[i]);
+
+        jitterSumNs += lateNs;
+        if (lateNs > jitterMaxNs)
+            jitterMaxNs = lateNs;
+        wakeups++;
+
+        // After a stall of more than a second restart the schedule instead of bursting to catch up
+        if (lateNs > SV_STATS_NS) {
+            startNs = nowNs;
+            sample = 0;
+        }
+
+        if (nowNs < nextStatsNs)
+            continue;
+
+        for (int i = 0; i < gSvStreamCount; i++) {
+            SvStream* stream = &gSvStreams[i];
+            unsigned long long overruns = atomic_load_explicit(&stream->overruns, memory_order_relaxed);
+
+            if (!log_ring_push(&gSvLogRing,
+                    "SV_STATS stream=%d sent=%llu underruns=%llu overruns=%llu jitter_avg_us=%llu jitter_max_us=%llu", i,
+                    (unsigned long long) (stream->sent - lastSent[i]),
+                    (unsigned long long) (stream->underruns - lastUnderruns[i]), overruns - lastOverruns[i],
+                    (unsigned long long) (jitterSumNs / wakeups / 1000), (unsigned long long) (jitterMaxNs / 1000)))
+                atomic_fetch_add_explicit(&gSvLogRing.dropped, 1, memory_order_relaxed);
+
+            lastSent[i] = stream->sent;
+            lastUnderruns[i] = stream->underruns;
+            lastOverruns[i] = overruns;
+        }
+
+        jitterSumNs = jitterMaxNs = wakeups = 0;
+        nextStatsNs = nowNs + SV_STATS_NS;
+    }
+
+    return NULL;
+}
+
+static void
+sv_start(void)
+{
+    if (gSvStreamCount == 0)
+        return;
+
+    atomic_store(&gSvRunning, 1);
+
+    gSvThread = Thread_create(sv_publisher_thread, NULL, false);
+    Thread_start(gSvThread);
+
+    printf("Publishing %d SV stream(s) at %u samples/s\n", gSvStreamCount, gSvRate);
+}
+
+static void
+sv_stop(void)
+{
+    if (gSvThread) {
+        atomic_store(&gSvRunning, 0);
+        Thread_destroy(gSvThread);
+        gSvThread = NULL;
+    }
+}
+
+// --- GOOSE Subscriber ---
+
+/*
+ * IEC_GOOSE_SUBSCRIPTIONS=<file> subscribes the hosted IEDs to the GOOSE
+ * of their peers and writes received values straight into the bound
+ * attributes, without a round trip through the relay. The file is built
+ * from the SCD ExtRefs by scripts/goose-subscriptions.cjs:
+ *
+ *   GOCB <gocbRef> <appId hex> <data set ref> <confRev> <dst MAC>
+ *   MAP <data set index> <target ref>
+ *   LGOS <St.stVal ref>
+ *
+ * Targets resolve through the reference index, so the bridge and GOOSE
+ * share one binding per attribute; only attributes the bridge can write are
+ * mapped. A GooseReceiver on IEC_GOOSE_INTERFACE is ticked by a thread of
+ * its own; for each message the mapped members that changed are compared
+ * and applied under the lock of their IED through apply_bridge_value(), so
+ * deadbands and 't' (from the message timestamp) are handled exactly as for
+ * bridge updates. LGOS St.stVal follows the subscription's
+ * validity (timeAllowedToLive), checked after every wake-up and at least
+ * every GOOSE_SUPERVISION_MS; each change is logged as
+ *
+ *   GOOSE_SUPERVISION <gocbRef> valid|lost
+ */
+
+#define GOOSE_SUPERVISION_MS 100
+#define GOOSE_LINE_MAX 512
+
+typedef struct {
+    AttributeBinding* binding;
+    int index; /* data set member, -1 for an LGOS St.stVal */
+} GooseTarget;
+
+typedef struct {
+    char* gocbRef;
+    GooseSubscriber subscriber;
+    GooseTarget* targets;
+    int targetCount;
+    bool supervised; /* validity last written to the LGOS targets */
+    bool mismatchLogged;
+} GooseSubscription;
+
+static GooseSubscription* gGooseSubscriptions = NULL;
+static int gGooseSubscriptionCount = 0;
+static GooseReceiver gGooseReceiver = NULL;
+static Thread gGooseThread = NULL;
+static atomic_int gGooseRunning;
+static LogRing gGooseLogRing;
+
+static void
+goose_log(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+
+    if (!log_ring_vpush(&gGooseLogRing, fmt, args))
+        atomic_fetch_add_explicit(&gGooseLogRing.dropped, 1, memory_order_relaxed);
+
+    va_end(args);
+}
+
+/* Converts a received member to the binding's bridge type; the MMS types were checked by the caller */
+static void
+bridge_value_from_mms(const AttributeBinding* binding, const MmsValue* mms, BridgeValue* value)
+{
+    MmsValue* source = (MmsValue*) mms;
+
+    value->type = binding->type;
+
+    switch (binding->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        value->v.boolean = MmsValue_getBoolean(source);
+        break;
+    case BRIDGE_TYPE_INT32:
+        value->v.int32 = MmsValue_toInt32(source);
+        break;
+    case BRIDGE_TYPE_UINT32:
+        value->v.uint32 = MmsValue_toUint32(source);
+        break;
+    case BRIDGE_TYPE_FLOAT:
+        value->v.float32 = MmsValue_toFloat(source);
+        break;
+    case BRIDGE_TYPE_INT64:
+        value->v.int64 = MmsValue_toInt64(source);
+        break;
+    case BRIDGE_TYPE_BITSTRING:
+        value->v.uint32 = MmsValue_getBitStringAsInteger(source);
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        value->v.timeMs = MmsValue_getUtcTimeInMs(source);
+        break;
+    case BRIDGE_TYPE_STRING: {
+        const char* text = MmsValue_toString(source);
+
+        snprintf(value->str, sizeof(value->str), "%s", text ? text : "");
+        break;
+    }
+    case BRIDGE_TYPE_DBPOS:
+        value->v.uint32 = (uint32_t) Dbpos_fromMmsValue(source);
+        break;
+    default:
+        break;
+    }
+}
+
+static void
+goose_supervise(GooseSubscription* sub, bool valid)
+{
+    if (valid == sub->supervised)
+        return;
+
+    sub->supervised = valid;
+
+    BridgeValue value = { .type = BRIDGE_TYPE_BOOLEAN, .v.boolean = valid };
+
+    for (int i = 0; i < sub->targetCount; i++) {
+        GooseTarget* target = &sub->targets[i];
+
+        if (target->index >= 0)
+            continue;
+
+        IedServer server = target->binding->ied->server;
+
+        IedServer_lockDataModel(server);
+        apply_bridge_value(target->binding, &value, 0);
+        IedServer_unlockDataModel(server);
+        shm_value_overwritten(target->binding);
+        mark_state_changed();
+    }
+
+    goose_log("GOOSE_SUPERVISION %s %s", sub->gocbRef, valid ? "valid" : "lost");
+}
+
+static void
+goose_listener(GooseSubscriber subscriber, void* parameter)
+{
+    GooseSubscription* sub = (GooseSubscription*) parameter;
+    MmsValue* values = GooseSubscriber_getDataSetValues(subscriber);
+    bool valid = GooseSubscriber_isValid(subscriber) && (values != NULL);
+
+    if (valid) {
+        uint64_t timestampMs = GooseSubscriber_getTimestamp(subscriber);
+        HostedIed* locked = NULL;
+
+        // Targets are grouped by IED, so each IED is locked once per message
+        for (int i = 0; i < sub->targetCount; i++) {
+            GooseTarget* target = &sub->targets[i];
+
+            if (target->index < 0)
+                continue;
+
+            DataAttribute* attr = target->binding->attr;
+            MmsValue* value = MmsValue_getElement(values, target->index);
+
+            if ((value == NULL) || (MmsValue_getType(value) != MmsValue_getType(attr->mmsValue))) {
+                if (!sub->mismatchLogged) {
+                    goose_log("BRIDGE_ERR: GOOSE %s member %d does not match %s", sub->gocbRef, target->index,
+                            target->binding->reference);
+                    sub->mismatchLogged = true;
+                }
+                continue;
+            }
+
+            if (target->binding->ied != locked) {
+                if (locked)
+                    IedServer_unlockDataModel(locked->server);
+                locked = target->binding->ied;
+                IedServer_lockDataModel(locked->server);
+            }
+
+            if (MmsValue_equals(value, attr->mmsValue))
+                continue;
+
+            BridgeValue update;
+
+            bridge_value_from_mms(target->binding, value, &update);
+            apply_bridge_value(target->binding, &update, timestampMs);
+            shm_value_overwritten(target->binding);
+            mark_state_changed();
+        }
+
+        if (locked)
+            IedServer_unlockDataModel(locked->server);
+    }
+
+    goose_supervise(sub, valid);
+}
+
+static bool
+parse_mac(const char* text, uint8_t mac[6])
+{
+    unsigned bytes[6];
+
+    if (sscanf(text, "%2x%*1[-:]%2x%*1[-:]%2x%*1[-:]%2x%*1[-:]%2x%*1[-:]%2x", &bytes[0], &bytes[1], &bytes[2], &bytes[3],
+                &bytes[4], &bytes[5]) != 6)
+        return false;
+
+    for (int i = 0; i < 6; i++)
+        mac[i] = (uint8_t) bytes[i];
+
+    return true;
+}
+
+static GooseSubscription*
+goose_add_subscription(const char* gocbRef, unsigned appId, const char* mac)
+{
+    GooseSubscription* grown = (GooseSubscription*) realloc(gGooseSubscriptions,
+            (size_t) (gGooseSubscriptionCount + 1) * sizeof(GooseSubscription));
+
+    if (grown == NULL)
+        return NULL;
+
+    gGooseSubscriptions = grown;
+
+    GooseSubscription* sub = &gGooseSubscriptions[gGooseSubscriptionCount++];
+    uint8_t dstMac[6];
+
+    memset(sub, 0, sizeof(*sub));
+    sub->gocbRef = strdup(gocbRef);
+    sub->subscriber = GooseSubscriber_create(sub->gocbRef, NULL);
+    GooseSubscriber_setAppId(sub->subscriber, (uint16_t) appId);
+
+    if (parse_mac(mac, dstMac))
+        GooseSubscriber_setDstMac(sub->subscriber, dstMac);
+
+    return sub;
+}
+
+static bool
+goose_add_target(GooseSubscription* sub, AttributeBinding* binding, int index)
+{
+    GooseTarget* grown = (GooseTarget*) realloc(sub->targets, (size_t) (sub->targetCount + 1) * sizeof(GooseTarget));
+
+    if (grown == NULL)
+        return false;
+
+    sub->targets = grown;
+    sub->targets[sub->targetCount].binding = binding;
+    sub->targets[sub->targetCount].index = index;
+    sub->targetCount++;
+
+    return true;
+}
+
+static void
+goose_destroy_subscriptions(void)
+{
+    // The receiver owns and destroys the subscribers it was given
+    if (gGooseReceiver)
+        GooseReceiver_destroy(gGooseReceiver);
+
+    for (int i = 0; i < gGooseSubscriptionCount; i++) {
+        if (gGooseReceiver == NULL)
+            GooseSubscriber_destroy(gGooseSubscriptions[i].subscriber);
+
+        free(gGooseSubscriptions[i].gocbRef);
+        free(gGooseSubscriptions[i].targets);
+    }
+
+    free(gGooseSubscriptions);
+    gGooseSubscriptions = NULL;
+    gGooseSubscriptionCount = 0;
+    gGooseReceiver = NULL;
+}
+
+/* Loads the subscription table; runs after the reference index is built and before the log writer starts */
+static bool
+goose_setup(void)
+{
+    const char* file = getenv("IEC_GOOSE_SUBSCRIPTIONS");
+
+    if ((file == NULL) || (*file == 0))
+        return true;
+
+    FILE* in = fopen(file, "r");
+
+    if (in == NULL) {
+        fprintf(stderr, "Failed to open GOOSE subscriptions %s: %s\n", file, strerror(errno));
+        return false;
+    }
+
+    char line[GOOSE_LINE_MAX];
+    GooseSubscription* sub = NULL;
+    int mapped = 0, unresolved = 0, lineNo = 0;
+    bool ok = true;
+
+    while (ok && fgets(line, sizeof(line), in)) {
+        char ref[GOOSE_LINE_MAX], mac[32];
+        unsigned appId;
+        int index;
+
+        lineNo++;
+        line[strcspn(line, "\r\n")] = 0;
+
+        if ((line[0] == 0) || (line[0] == '#'))
+            continue;
+
+        if (sscanf(line, "GOCB %511s %x %*s %*u %31s", ref, &appId, mac) == 3) {
+            sub = goose_add_subscription(ref, appId, mac);
+            ok = (sub != NULL);
+            continue;
+        }
+
+        bool isMap = (sscanf(line, "MAP %d %511s", &index, ref) == 2);
+        bool isLgos = !isMap && (sscanf(line, "LGOS %511s", ref) == 1);
+
+        if ((!isMap && !isLgos) || (sub == NULL)) {
+            fprintf(stderr, "%s:%d: malformed GOOSE subscription line\n", file, lineNo);
+            ok = false;
+            break;
+        }
+
+        AttributeBinding* binding = index_lookup(ref, strlen(ref));
+
+        if ((binding == NULL) || (binding->type == BRIDGE_TYPE_NONE) ||
+                (isLgos && (binding->type != BRIDGE_TYPE_BOOLEAN))) {
+            unresolved++;
+            continue;
+        }
+
+        ok = goose_add_target(sub, binding, isMap ? index : -1);
+        mapped++;
+    }
+
+    fclose(in);
+
+    if (!ok) {
+        goose_destroy_subscriptions();
+        return false;
+    }
+
+    // Drop GoCBs none of whose targets exist in the hosted models
+    int kept = 0;
+
+    for (int i = 0; i < gGooseSubscriptionCount; i++) {
+        GooseSubscription* entry = &gGooseSubscriptions[i];
+
+        if (entry->targetCount == 0) {
+            GooseSubscriber_destroy(entry->subscriber);
+            free(entry->gocbRef);
+            free(entry->targets);
+            continue;
+        }
+
+        gGooseSubscriptions[kept++] = *entry;
+    }
+
+    gGooseSubscriptionCount = kept;
+
+    if (gGooseSubscriptionCount == 0) {
+        printf("GOOSE subscriptions: no target of %s is in the hosted models\n", file);
+        goose_destroy_subscriptions();
+        return true;
+    }
+
+    const char* iface = getenv("IEC_GOOSE_INTERFACE");
+
+    gGooseReceiver = GooseReceiver_create();
+
+    if (iface && *iface)
+        GooseReceiver_setInterfaceId(gGooseReceiver, iface);
+
+    // The table no longer moves, so its entries can serve as listener parameters
+    for (int i = 0; i < gGooseSubscriptionCount; i++) {
+        GooseSubscription* entry = &gGooseSubscriptions[i];
+
+        GooseSubscriber_setListener(entry->subscriber, goose_listener, entry);
+        GooseReceiver_addSubscriber(gGooseReceiver, entry->subscriber);
+    }
+
+    gThreadLogRings[gThreadLogRingCount++] = &gGooseLogRing;
+
+    printf("GOOSE subscriptions: %d control blocks, %d targets", gGooseSubscriptionCount, mapped);
+    if (unresolved)
+        printf(", %d not in the hosted models", unresolved);
+    printf("\n");
+
+    return true;
+}
+
+static void*
+goose_receiver_thread(void* arg)
+{
+    (void) arg;
+    tMetrics = &gMetricsShards[METRICS_SHARD_GOOSE];
+
+    EthernetSocket socket = GooseReceiver_startThreadless(gGooseReceiver);
+
+    if (socket == NULL) {
+        fprintf(stderr, "Failed to start GOOSE receiver (raw socket access is required)\n");
+        return NULL;
+    }
+
+    EthernetHandleSet handles = EthernetHandleSet_new();
+
+    EthernetHandleSet_addSocket(handles, socket);
+
+    while (atomic_load_explicit(&gGooseRunning, memory_order_relaxed)) {
+        if (EthernetHandleSet_waitReady(handles, GOOSE_SUPERVISION_MS) > 0) {
+            while (GooseReceiver_tick(gGooseReceiver))
+                ;
+        }
+
+        // Subscriptions whose timeAllowedToLive ran out produce no callback
+        for (int i = 0; i < gGooseSubscriptionCount; i++)
+            goose_supervise(&gGooseSubscriptions[i], GooseSubscriber_isValid(gGooseSubscriptions[i].subscriber));
+    }
+
+    EthernetHandleSet_destroy(handles);
+    GooseReceiver_stopThreadless(gGooseReceiver);
+
+    return NULL;
+}
+
+static void
+goose_start(void)
+{
+    if (gGooseReceiver == NULL)
+        return;
+
+    atomic_store(&gGooseRunning, 1);
+
+    gGooseThread = Thread_create(goose_receiver_thread, NULL, false);
+    Thread_start(gGooseThread);
+}
+
+static void
+goose_stop(void)
+{
+    if (gGooseThread) {
+        atomic_store(&gGooseRunning, 0);
+        Thread_destroy(gGooseThread);
+        gGooseThread = NULL;
+    }
+}
+
+// --- Data Set Index ---
+
+/*
+ * The simulation produces whole vectors such as the 21 MMXU measurements of
+ * LLN0.DataSet_1, so a data set can also be updated in one message (see
+ * Bridge Staging). Each DataSetEntry is resolved once at startup to the
+ * binding of the attribute that carries its value: the attribute itself for
+ * DA-level FCDAs, otherwise the first leaf of the member's FC below it that
+ * is not q, t or an inst* value (stVal, cVal.mag.f, mag.f, setVal, ...). The DO
+ * timestamp then follows from the binding as for single updates. With the
+ * binary protocol each data set is published as "BRIDGE_DATASET <index>
+ * <ref> <member handles>".
+ */
+
+typedef struct {
+    const char* reference;    /* "<IED><LD>/LLN0.<name>" */
+    HostedIed* ied;
+    int memberCount;
+    AttributeBinding** members; /* NULL where the member has no writable value */
+} DataSetBinding;
+
+static DataSetBinding* gDataSetBindings = NULL;
+static int gDataSetBindingCount = 0;
+static AttributeBinding** gDataSetMembers = NULL;
+static BridgeValue* gDataSetValues = NULL; /* parsed values of the message being staged */
+
+/* Resolves the entry's "LN$FC$DO$DA" variable name within its LD */
+static ModelNode*
+resolve_data_set_entry(IedModel* model, DataSetEntry* entry, FunctionalConstraint* fc)
+{
+    ModelNode* node = NULL;
+
+    for (LogicalDevice* ld = model->firstChild; ld; ld = (LogicalDevice*) ld->sibling) {
+        if (strcmp(ld->name, entry->logicalDeviceName) == 0) {
+            node = (ModelNode*) ld;
+            break;
+        }
+    }
+
+    char path[200];
+    char* save = NULL;
+    int depth = 0;
+
+    *fc = IEC61850_FC_NONE;
+    snprintf(path, sizeof(path), "%s", entry->variableName);
+
+    for (char* name = strtok_r(path, "$", &save); name && node; name = strtok_r(NULL, "$", &save), depth++) {
+        if (depth == 1)
+            *fc = FunctionalConstraint_fromString(name);
+        else
+            node = ModelNode_getChild(node, name);
+    }
+
+    return node;
+}
+
+static DataAttribute*
+data_set_member_value(ModelNode* node, FunctionalConstraint fc)
+{
+    if (node->modelType == DataAttributeModelType) {
+        DataAttribute* da = (DataAttribute*) node;
+
+        if (da->type != IEC61850_CONSTRUCTED)
+            return ((da->fc == fc) && (bridge_type_for_attribute(da) != BRIDGE_TYPE_NONE)) ? da : NULL;
+    }
+
+    for (ModelNode* child = node->firstChild; child; child = child->sibling) {
+        // instMag/instCVal bypass the deadband, the data set carries mag/cVal
+        if ((child->modelType == DataAttributeModelType) && ((strcmp(child->name, "q") == 0) ||
+                (strcmp(child->name, "t") == 0) || (strncmp(child->name, "inst", 4) == 0)))
+            continue;
+
+        DataAttribute* da = data_set_member_value(child, fc);
+
+        if (da)
+            return da;
+    }
+
+    return NULL;
+}
+
+/* Looks the attribute up by the reference index_walk() gave it */
+static AttributeBinding*
+binding_for_attribute(IedModel* model, DataAttribute* da)
+{
+    ModelNode* chain[16];
+    int depth = 0;
+    ModelNode* node = (ModelNode*) da;
+
+    while (node && (node->modelType != LogicalDeviceModelType) && (depth < 16)) {
+        chain[depth++] = node;
+        node = node->parent;
+    }
+
+    if ((node == NULL) || (node->modelType != LogicalDeviceModelType))
+        return NULL;
+
+    LogicalDevice* ld = (LogicalDevice*) node;
+    char path[256];
+    int len;
+
+    if (ld->ldName)
+        len = snprintf(path, sizeof(path), "%s", ld->ldName);
+    else
+        len = snprintf(path, sizeof(path), "%s%s", model->name, ld->name);
+
+    while ((depth > 0) && (len < (int) sizeof(path))) {
+        ModelNode* part = chain[--depth];
+        len += snprintf(path + len, sizeof(path) - len, "%c%s", (part->parent == node) ? '/' : '.', part->name);
+    }
+
+    return (len < (int) sizeof(path)) ? index_lookup(path, (size_t) len) : NULL;
+}
+
+static bool
+build_data_set_index(void)
+{
+    int totalMembers = 0;
+    int maxMembers = 1;
+
+    for (int i = 0; i < gIedCount; i++) {
+        for (DataSet* ds = gIeds[i].model->dataSets; ds; ds = ds->sibling) {
+            gDataSetBindingCount++;
+            totalMembers += ds->elementCount;
+            if (ds->elementCount > maxMembers)
+                maxMembers = ds->elementCount;
+        }
+    }
+
+    gDataSetBindings = (DataSetBinding*) calloc(gDataSetBindingCount > 0 ? gDataSetBindingCount : 1, sizeof(DataSetBinding));
+    gDataSetMembers = (AttributeBinding**) calloc(totalMembers > 0 ? totalMembers : 1, sizeof(AttributeBinding*));
+    gDataSetValues = (BridgeValue*) calloc(maxMembers, sizeof(BridgeValue));
+
+    if ((gDataSetBindings == NULL) || (gDataSetMembers == NULL) || (gDataSetValues == NULL)) {
+        fprintf(stderr, "Failed to allocate data set index\n");
+        return false;
+    }
+
+    int count = 0;
+    int used = 0;
+    int unresolved = 0;
+
+    for (int i = 0; i < gIedCount; i++) {
+        IedModel* model = gIeds[i].model;
+
+        for (DataSet* ds = model->dataSets; ds; ds = ds->sibling) {
+            DataSetBinding* binding = &gDataSetBindings[count++];
+            const char* ldName = NULL;
+            char reference[260];
+
+            for (LogicalDevice* ld = model->firstChild; ld; ld = (LogicalDevice*) ld->sibling) {
+                if (strcmp(ld->name, ds->logicalDeviceName) == 0)
+                    ldName = ld->ldName;
+            }
+
+            if (ldName)
+                snprintf(reference, sizeof(reference), "%s/%s", ldName, ds->name);
+            else
+                snprintf(reference, sizeof(reference), "%s%s/%s", model->name, ds->logicalDeviceName, ds->name);
+
+            for (char* c = strchr(reference, '/'); *c; c++) {
+                if (*c == '$')
+                    *c = '.';
+            }
+
+            binding->reference = strdup(reference);
+
+            if (binding->reference == NULL) {
+                fprintf(stderr, "Failed to allocate data set index\n");
+                return false;
+            }
+
+            binding->ied = &gIeds[i];
+            binding->members = gDataSetMembers + used;
+
+            for (DataSetEntry* entry = ds->fcdas; entry && (binding->memberCount < ds->elementCount); entry = entry->sibling) {
+                FunctionalConstraint fc;
+                ModelNode* node = resolve_data_set_entry(model, entry, &fc);
+                DataAttribute* da = node ? data_set_member_value(node, fc) : NULL;
+                AttributeBinding* member = da ? binding_for_attribute(model, da) : NULL;
+
+                if (member == NULL)
+                    unresolved++;
+
+                binding->members[binding->memberCount++] = member;
+            }
+
+            used += binding->memberCount;
+        }
+    }
+
+    printf("Indexed %d data sets (%d members, %d without a writable value)\n", gDataSetBindingCount, used, unresolved);
+
+    return true;
+}
+
+/* Accepts "LLN0.DataSet_1" as well as the MMS form "LLN0$DataSet_1" */
+static DataSetBinding*
+find_data_set_binding(char* ref)
+{
+    char* slash = strchr(ref, '/');
+
+    for (char* c = slash; c && *c; c++) {
+        if (*c == '$')
+            *c = '.';
+    }
+
+    for (int i = 0; i < gDataSetBindingCount; i++) {
+        if (strcmp(gDataSetBindings[i].reference, ref) == 0)
+            return &gDataSetBindings[i];
+    }
+
+    return NULL;
+}
+
+static void
+free_data_set_index(void)
+{
+    for (int i = 0; i < gDataSetBindingCount; i++)
+        free((char*) gDataSetBindings[i].reference);
+
+    free(gDataSetBindings);
+    free(gDataSetMembers);
+    free(gDataSetValues);
+    gDataSetBindings = NULL;
+    gDataSetMembers = NULL;
+    gDataSetValues = NULL;
+    gDataSetBindingCount = 0;
+}
+
+// --- Client Reads ---
+
+/*
+ * Every MMS read passes the read access handler of its IED, on the thread
+ * serving that IED. With IEC_CLIENT_READ_RATE=<n> each client connection
+ * gets a token bucket of n object accesses per second (bursts up to
+ * IEC_CLIENT_READ_BURST, default n); accesses beyond it are answered with
+ * temporarily-unavailable, so one polling-heavy HMI cannot take the serving
+ * loop away from report delivery, other clients or the bridge. The handler
+ * also counts reads and limited reads for the metrics.
+ *
+ * Responses are not cached: the handler can only allow or refuse an access,
+ * libiec61850 encodes the response itself inside its MMS layer and offers
+ * no hook to hand it pre-encoded data.
+ */
+
+#define CLIENT_BUDGET_SLOTS 32
+
+typedef struct {
+    ClientConnection connection; /* NULL when free */
+    double tokens;
+    uint64_t lastNs;
+} ClientBudget;
+
+static ClientBudget gClientBudgets[BRIDGE_MAX_IEDS][CLIENT_BUDGET_SLOTS];
+static double gClientReadRate = 0;
+static double gClientReadBurst = 0;
+
+static ClientBudget*
+find_client_budget(HostedIed* ied, ClientConnection connection)
+{
+    ClientBudget* budgets = gClientBudgets[ied - gIeds];
+
+    for (int i = 0; i < CLIENT_BUDGET_SLOTS; i++) {
+        if (budgets[i].connection == connection)
+            return &budgets[i];
+    }
+
+    return NULL;
+}
+
+/* Refills the bucket for the time since the last access and takes one token */
+static bool
+client_budget_take(ClientBudget* budget)
+{
+    uint64_t nowNs = monotonic_ns();
+
+    budget->tokens += (double) (nowNs - budget->lastNs) * gClientReadRate / 1e9;
+    budget->lastNs = nowNs;
+
+    if (budget->tokens > gClientReadBurst)
+        budget->tokens = gClientReadBurst;
+
+    if (budget->tokens < 1)
+        return false;
+
+    budget->tokens -= 1;
+    return true;
+}
+
+static MmsDataAccessError
+read_access_handler(LogicalDevice* ld, LogicalNode* ln, DataObject* dataObject, FunctionalConstraint fc,
+        ClientConnection connection, void* parameter)
+{
+    HostedIed* ied = (HostedIed*) parameter;
+
+    (void) ld;
+    (void) ln;
+    (void) dataObject;
+    (void) fc;
+
+    if (gClientReadRate > 0) {
+        ClientBudget* budget = find_client_budget(ied, connection);
+
+        if (budget && !client_budget_take(budget)) {
+            metrics_add(&tMetrics->readsLimited, 1);
+            return DATA_ACCESS_ERROR_TEMPORARILY_UNAVAILABLE;
+        }
+    }
+
+    metrics_add(&tMetrics->reads, 1);
+
+    return DATA_ACCESS_ERROR_SUCCESS;
+}
+
+static void
+client_connection_handler(IedServer server, ClientConnection connection, bool connected, void* parameter)
+{
+    HostedIed* ied = (HostedIed*) parameter;
+
+    connection_indication_handler(server, connection, connected, parameter);
+
+    if (gClientReadRate <= 0)
+        return;
+
+    // More connections than slots stay unlimited
+    ClientBudget* budget = find_client_budget(ied, connected ? NULL : connection);
+
+    if (budget == NULL)
+        return;
+
+    budget->connection = connected ? connection : NULL;
+    budget->tokens = gClientReadBurst;
+    budget->lastNs = monotonic_ns();
+}
+
+static bool
+client_reads_setup(void)
+{
+    const char* rate = getenv("IEC_CLIENT_READ_RATE");
+    const char* burst = getenv("IEC_CLIENT_READ_BURST");
+
+    gClientReadRate = rate ? atof(rate) : 0;
+    gClientReadBurst = burst ? atof(burst) : 0;
+
+    if (gClientReadBurst < 1)
+        gClientReadBurst = (gClientReadRate > 1) ? gClientReadRate : 1;
+
+    for (int i = 0; i < gIedCount; i++) {
+        IedServer_setReadAccessHandler(gIeds[i].server, read_access_handler, &gIeds[i]);
+        IedServer_setConnectionIndicationHandler(gIeds[i].server, client_connection_handler, &gIeds[i]);
+    }
+
+    if (gClientReadRate > 0)
+        printf("Client reads limited to %.0f object accesses/s per connection (burst %.0f)\n", gClientReadRate, gClientReadBurst);
+
+    return true;
+}
+
+// --- Bridge Staging ---
+
+static void
+commit_staged_updates(void)
+{
+    if (gStagedCount == 0)
+        return;
+
+    uint64_t batchTimeMs = Hal_getTimeInMs();
+
+    mark_state_changed();
+
+    if (gWorkerCount > 0)
+        dispatch_staged_updates(batchTimeMs, gBatchArrivalNs);
+    else
+        apply_staged_batch(-1, gStaged, 0, (unsigned) gStagedCount, UINT32_MAX, batchTimeMs, gBatchArrivalNs);
+
+    if (gStreamMode) {
+        for (int i = 0; i < gStagedCount; i++)
+            gStagedSlots[gStaged[i].binding - gAttrBindings] = 0;
+    }
+
+    gStagedCount = 0;
+}
+
+/*
+ * In streaming mode a second update of the same attribute in one batch
+ * replaces the first (last value wins). The shared value table marks its
+ * own updates current again after staging them.
+ */
+static BridgeValue*
+stage_update(const AttributeBinding* binding, uint64_t timestampMs)
+{
+    uint16_t* slot = gStreamMode ? &gStagedSlots[binding - gAttrBindings] : NULL;
+
+    shm_value_overwritten(binding);
+
+    if (slot && *slot) {
+        StagedUpdate* staged = &gStaged[*slot - 1];
+        staged->timestampMs = timestampMs;
+        return &staged->value;
+    }
+
+    if (gStagedCount == BRIDGE_BATCH_CAPACITY) {
+        if (gInTransaction) {
+            bridge_log_error("BRIDGE_ERR: Batch exceeds %d updates, committing early", BRIDGE_BATCH_CAPACITY);
+        }
+        commit_staged_updates();
+    }
+
+    if (gStagedCount == 0)
+        gBatchArrivalNs = gInputArrivalNs;
+
+    StagedUpdate* staged = &gStaged[gStagedCount++];
+    staged->binding = binding;
+    staged->timestampMs = timestampMs;
+
+    if (slot)
+        *slot = (uint16_t) gStagedCount;
+
+    return &staged->value;
+}
+
+static void
+handle_bridge_update(const char* ref, const char* valStr)
+{
+    AttributeBinding* binding = index_lookup(ref, strlen(ref));
+
+    if (!binding) {
+        metrics_add(&gBridgeMetrics.lookupMisses, 1);
+
+        if (running) {
+            bridge_log_error("BRIDGE_ERR: Node not found or not attribute: %s", ref);
+        }
+        return;
+    }
+
+    if (binding->type == BRIDGE_TYPE_NONE) {
+        bridge_log_error("BRIDGE_ERR: Unsupported attribute type: %s", ref);
+        return;
+    }
+
+    BridgeValue value;
+
+    if (!parse_text_value(binding, valStr, &value)) {
+        bridge_log_error("BRIDGE_ERR: Invalid value for %s: %s", ref, valStr);
+        return;
+    }
+
+    *stage_update(binding, 0) = value;
+
+    if (running) {
+        bridge_log_ack("BRIDGE_OK: Updated %s = %s", ref, valStr);
+    }
+}
+
+/* Stages the values parsed into gDataSetValues; BRIDGE_TYPE_NONE leaves a member unchanged */
+static int
+stage_data_set(const DataSetBinding* ds, uint64_t timestampMs)
+{
+    int staged = 0;
+
+    // Keep the vector in one batch, so it is applied under one lock and reported together
+    if (!gInTransaction && (gStagedCount + ds->memberCount > BRIDGE_BATCH_CAPACITY))
+        commit_staged_updates();
+
+    for (int i = 0; i < ds->memberCount; i++) {
+        if (gDataSetValues[i].type == BRIDGE_TYPE_NONE)
+            continue;
+
+        *stage_update(ds->members[i], timestampMs) = gDataSetValues[i];
+        staged++;
+    }
+
+    return staged;
+}
+
+/* "DATASET <ref>=v1;v2;...": one value per member in data set order, empty ones are skipped */
+static void
+handle_data_set_update(char* ref, char* values)
+{
+    DataSetBinding* ds = find_data_set_binding(ref);
+
+    if (!ds) {
+        metrics_add(&gBridgeMetrics.lookupMisses, 1);
+        bridge_log_error("BRIDGE_ERR: Data set not found: %s", ref);
+        return;
+    }
+
+    char* field = values;
+    int count = 0;
+
+    while (true) {
+        char* end = strchr(field, ';');
+
+        if (end)
+            *end = 0;
+
+        if (count == ds->memberCount) {
+            bridge_log_error("BRIDGE_ERR: Data set %s has %d members, got more values", ref, ds->memberCount);
+            return;
+        }
+
+        const AttributeBinding* member = ds->members[count];
+        BridgeValue* value = &gDataSetValues[count++];
+
+        value->type = BRIDGE_TYPE_NONE;
+
+        if (*field && ((member == NULL) || (member->type == BRIDGE_TYPE_NONE))) {
+            bridge_log_error("BRIDGE_ERR: Member %d of %s has no writable value", count - 1, ref);
+            return;
+        }
+
+        if (*field && !parse_text_value(member, field, value)) {
+            bridge_log_error("BRIDGE_ERR: Invalid value for %s: %s", member->reference, field);
+            return;
+        }
+
+        if (end == NULL)
+            break;
+
+        field = end + 1;
+    }
+
+    if (count != ds->memberCount) {
+        bridge_log_error("BRIDGE_ERR: Data set %s has %d members, got %d values", ref, ds->memberCount, count);
+        return;
+    }
+
+    int staged = stage_data_set(ds, 0);
+
+    if (running) {
+        bridge_log_ack("BRIDGE_OK: Updated %s (%d of %d members)", ref, staged, ds->memberCount);
+    }
+}
+
+static void
+publish_handle_table(void)
+{
+    char chunk[16 * 1024];
+    size_t used = 0;
+
+    printf("BRIDGE_TABLE %d\n", gAttrBindingCount);
+
+    for (int i = 0; i < gAttrBindingCount; i++) {
+        if (used + 300 > sizeof(chunk)) {
+            fwrite(chunk, 1, used, stdout);
+            used = 0;
+        }
+
+        used += snprintf(chunk + used, sizeof(chunk) - used, "BRIDGE_HANDLE %d %d %s\n",
+                i, (int) gAttrBindings[i].type, gAttrBindings[i].reference);
+    }
+
+    fwrite(chunk, 1, used, stdout);
+
+    // Member handles in data set order, -1 where a member has no writable value
+    for (int i = 0; i < gDataSetBindingCount; i++) {
+        DataSetBinding* ds = &gDataSetBindings[i];
+
+        printf("BRIDGE_DATASET %d %s ", i, ds->reference);
+
+        for (int m = 0; m < ds->memberCount; m++)
+            printf("%s%d", m ? "," : "", ds->members[m] ? (int) (ds->members[m] - gAttrBindings) : -1);
+
+        putchar('\n');
+    }
+
+    printf("BRIDGE_PROTO binary\n");
+    fflush(stdout);
+}
+
+static void
+handle_bridge_line(char* line)
+{
+    line[strcspn(line, "\r")] = 0;
+
+    if (strlen(line) == 0)
+        return;
+
+    if (strcmp(line, "BEGIN") == 0) {
+        gInTransaction = true;
+        return;
+    }
+
+    if (strcmp(line, "COMMIT") == 0) {
+        gInTransaction = false;
+        commit_staged_updates();
+        return;
+    }
+
+    if (strcmp(line, "STATS") == 0) {
+        bridge_log_request_metrics();
+        return;
+    }
+
+    if (strcmp(line, "CREDIT") == 0) {
+        gCreditEnabled = true;
+        gCreditAdvertised = UINT64_MAX;
+        return;
+    }
+
+    if (strcmp(line, "PROTO binary") == 0) {
+        commit_staged_updates();
+        publish_handle_table();
+        gBridgeProtocol = BRIDGE_PROTO_BINARY;
+        return;
+    }
+
+    if (strncmp(line, "DATASET ", 8) == 0) {
+        char* eq = strchr(line + 8, '=');
+
+        if (eq) {
+            *eq = 0;
+            handle_data_set_update(line + 8, eq + 1);
+        }
+        return;
+    }
+
+    // Message format: "REF=VALUE"
+    char* eq = strchr(line, '=');
+    if (eq) {
+        *eq = 0;
+        handle_bridge_update(line, eq + 1);
+    }
+}
+
+static size_t
+bridge_value_size(BridgeValueType type)
+{
+    switch (type) {
+    case BRIDGE_TYPE_BOOLEAN:
+    case BRIDGE_TYPE_DBPOS:
+        return 1;
+    case BRIDGE_TYPE_INT32:
+    case BRIDGE_TYPE_UINT32:
+    case BRIDGE_TYPE_FLOAT:
+    case BRIDGE_TYPE_BITSTRING:
+        return 4;
+    case BRIDGE_TYPE_INT64:
+    case BRIDGE_TYPE_UTCTIME:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/* Fills value->v (or value->str) from a frame's little-endian value of valueLen bytes */
+static void
+decode_bridge_value(BridgeValue* value, const uint8_t* payload, size_t valueLen)
+{
+    switch (value->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        value->v.boolean = (payload[0] != 0);
+        break;
+    case BRIDGE_TYPE_INT32:
+        value->v.int32 = (int32_t) read_u32le(payload);
+        break;
+    case BRIDGE_TYPE_UINT32:
+    case BRIDGE_TYPE_BITSTRING:
+        value->v.uint32 = read_u32le(payload);
+        break;
+    case BRIDGE_TYPE_DBPOS:
+        value->v.uint32 = payload[0];
+        break;
+    case BRIDGE_TYPE_FLOAT: {
+        uint32_t raw = read_u32le(payload);
+        memcpy(&value->v.float32, &raw, sizeof(raw));
+        break;
+    }
+    case BRIDGE_TYPE_INT64:
+        value->v.int64 = (int64_t) read_u64le(payload);
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        value->v.timeMs = read_u64le(payload);
+        break;
+    case BRIDGE_TYPE_STRING:
+        if (valueLen >= sizeof(value->str))
+            valueLen = sizeof(value->str) - 1;
+        memcpy(value->str, payload, valueLen);
+        value->str[valueLen] = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+ * BRIDGE_OP_DATASET payload: u16 data set | u8 flags | [u64 t ms] | per
+ * member u8 type | value, where type 0 skips the member and a string is
+ * u8 length | bytes. The whole frame is checked before anything is staged.
+ */
+static void
+handle_data_set_frame(const uint8_t* frame, size_t len)
+{
+    if (len < 4) {
+        bridge_log_error("BRIDGE_ERR: Malformed data set frame (%zu bytes)", len);
+        return;
+    }
+
+    unsigned index = (unsigned) frame[1] | ((unsigned) frame[2] << 8);
+    uint8_t flags = frame[3];
+    size_t pos = (flags & BRIDGE_FLAG_TIMESTAMP) ? 12 : 4;
+
+    if (index >= (unsigned) gDataSetBindingCount) {
+        metrics_add(&gBridgeMetrics.lookupMisses, 1);
+        bridge_log_error("BRIDGE_ERR: Unknown data set %u", index);
+        return;
+    }
+
+    DataSetBinding* ds = &gDataSetBindings[index];
+    uint64_t timestampMs = ((pos == 12) && (len >= 12)) ? read_u64le(frame + 4) : 0;
+
+    for (int i = 0; i < ds->memberCount; i++) {
+        BridgeValue* value = &gDataSetValues[i];
+        const AttributeBinding* member = ds->members[i];
+
+        if (pos >= len) {
+            bridge_log_error("BRIDGE_ERR: Data set frame for %s ends at member %d", ds->reference, i);
+            return;
+        }
+
+        value->type = (BridgeValueType) frame[pos++];
+
+        if (value->type == BRIDGE_TYPE_NONE)
+            continue;
+
+        size_t valueLen = bridge_value_size(value->type);
+
+        if (value->type == BRIDGE_TYPE_STRING)
+            valueLen = (pos < len) ? frame[pos++] : len;
+        else if (valueLen == 0) {
+            bridge_log_error("BRIDGE_ERR: Unsupported value type %d in %s", (int) value->type, ds->reference);
+            return;
+        }
+
+        if (pos + valueLen > len) {
+            bridge_log_error("BRIDGE_ERR: Data set frame for %s ends at member %d", ds->reference, i);
+            return;
+        }
+
+        decode_bridge_value(value, frame + pos, valueLen);
+        pos += valueLen;
+
+        if ((member == NULL) || !coerce_bridge_value(value, member->type) || !bridge_value_in_range(member, value)) {
+            bridge_log_error("BRIDGE_ERR: Type %d does not match member %d of %s", (int) value->type, i, ds->reference);
+            return;
+        }
+    }
+
+    if (pos != len) {
+        bridge_log_error("BRIDGE_ERR: Data set frame for %s has %zu trailing bytes", ds->reference, len - pos);
+        return;
+    }
+
+    int staged = stage_data_set(ds, timestampMs);
+
+    for (int i = 0; i < staged; i++)
+        log_counter_increment(&gLogCounters.updates);
+}
+
+static void
+handle_bridge_frame(const uint8_t* frame, size_t len)
+{
+    if ((len == 1) && (frame[0] == BRIDGE_OP_BEGIN)) {
+        gInTransaction = true;
+        return;
+    }
+
+    if ((len == 1) && (frame[0] == BRIDGE_OP_COMMIT)) {
+        gInTransaction = false;
+        commit_staged_updates();
+        return;
+    }
+
+    if ((len == 1) && (frame[0] == BRIDGE_OP_STATS)) {
+        bridge_log_request_metrics();
+        return;
+    }
+
+    if ((len >= 1) && (frame[0] == BRIDGE_OP_DATASET)) {
+        handle_data_set_frame(frame, len);
+        return;
+    }
+
+    if ((len >= 2) && (frame[0] == BRIDGE_OP_SV_SAMPLES)) {
+        size_t sampleLen = SV_CHANNELS * 4;
+
+        if ((frame[1] >= gSvStreamCount) || ((len - 2) % sampleLen != 0)) {
+            bridge_log_error("BRIDGE_ERR: Malformed SV frame for stream %u (%zu bytes)", frame[1], len);
+            return;
+        }
+
+        sv_enqueue(frame[1], frame + 2, (len - 2) / sampleLen);
+        return;
+    }
+
+    if ((len < 1) || (frame[0] != BRIDGE_OP_UPDATE) || (len < 7)) {
+        bridge_log_error("BRIDGE_ERR: Malformed frame (%zu bytes)", len);
+        return;
+    }
+
+    uint32_t handle = read_u32le(frame + 1);
+    BridgeValue value;
+    value.type = (BridgeValueType) frame[5];
+    uint8_t flags = frame[6];
+    const uint8_t* payload = frame + 7;
+    size_t payloadLen = len - 7;
+    size_t timeLen = (flags & BRIDGE_FLAG_TIMESTAMP) ? 8 : 0;
+
+    if (handle >= (uint32_t) gAttrBindingCount) {
+        metrics_add(&gBridgeMetrics.lookupMisses, 1);
+        bridge_log_error("BRIDGE_ERR: Unknown handle %u", handle);
+        return;
+    }
+
+    if ((value.type != BRIDGE_TYPE_STRING) && (bridge_value_size(value.type) == 0)) {
+        bridge_log_error("BRIDGE_ERR: Unsupported value type %d for %s", (int) value.type, gAttrBindings[handle].reference);
+        return;
+    }
+
+    size_t valueLen = (value.type == BRIDGE_TYPE_STRING) ? payloadLen - timeLen : bridge_value_size(value.type);
+
+    if ((payloadLen < timeLen) || (valueLen + timeLen != payloadLen)) {
+        bridge_log_error("BRIDGE_ERR: Malformed value for %s", gAttrBindings[handle].reference);
+        return;
+    }
+
+    decode_bridge_value(&value, payload, valueLen);
+
+    uint64_t timestampMs = timeLen ? read_u64le(payload + payloadLen - timeLen) : 0;
+
+    if (!coerce_bridge_value(&value, gAttrBindings[handle].type) || !bridge_value_in_range(&gAttrBindings[handle], &value)) {
+        bridge_log_error("BRIDGE_ERR: Type %d does not match %s", (int) value.type, gAttrBindings[handle].reference);
+        return;
+    }
+
+    *stage_update(&gAttrBindings[handle], timestampMs) = value;
+
+    // Binary updates are counted but never acknowledged line by line
+    log_counter_increment(&gLogCounters.updates);
+}
+
+/* Processes all complete lines/frames in buf and returns the number of bytes consumed */
+static size_t
+bridge_consume(uint8_t* buf, size_t len)
+{
+    size_t pos = 0;
+    uint64_t records = 0;
+
+    while (pos < len) {
+        if (gBridgeProtocol == BRIDGE_PROTO_TEXT) {
+            uint8_t* nl = (uint8_t*) memchr(buf + pos, '\n', len - pos);
+
+            if (nl == NULL)
+                break;
+
+            *nl = 0;
+            handle_bridge_line((char*) (buf + pos));
+            pos = (size_t) (nl - buf) + 1;
+            records++;
+        }
+        else {
+            if (len - pos < 2)
+                break;
+
+            size_t frameLen = (size_t) buf[pos] | ((size_t) buf[pos + 1] << 8);
+
+            if (len - pos - 2 < frameLen)
+                break;
+
+            handle_bridge_frame(buf + pos + 2, frameLen);
+            pos += 2 + frameLen;
+            records++;
+        }
+    }
+
+    metrics_add(&gBridgeMetrics.lines, records);
+
+    return pos;
+}
+
+static uint8_t gInputBuffer[BRIDGE_INPUT_BUFFER_SIZE];
+static size_t gInputFill = 0;
+
+/* Reads everything available on the non-blocking stdin; returns false on EOF */
+static bool
+bridge_read_input(void)
+{
+    while (true) {
+        ssize_t n = read(STDIN_FILENO, gInputBuffer + gInputFill, sizeof(gInputBuffer) - gInputFill);
+
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                break;
+        }
+
+        if (n <= 0) {
+            commit_staged_updates();
+            return false;
+        }
+
+        gInputFill += (size_t) n;
+        gInputArrivalNs = monotonic_ns();
+
+        size_t consumed = bridge_consume(gInputBuffer, gInputFill);
+
+        if ((consumed == 0) && (gInputFill == sizeof(gInputBuffer))) {
+            bridge_log_error("BRIDGE_ERR: Input record exceeds %zu bytes, discarded", gInputFill);
+            gInputConsumed += gInputFill;
+            gInputFill = 0;
+            continue;
+        }
+
+        memmove(gInputBuffer, gInputBuffer + consumed, gInputFill - consumed);
+        gInputFill -= consumed;
+        gInputConsumed += consumed;
+    }
+
+    if (!gInTransaction)
+        commit_staged_updates();
+
+    // Advertised once per burst, after the values reached the model
+    if (gCreditEnabled && (gCreditAdvertised != gInputConsumed)) {
+        gCreditAdvertised = gInputConsumed;
+        bridge_log_credit(gInputConsumed, BRIDGE_CREDIT_WINDOW);
+    }
+
+    return true;
+}
+
+// --- Shared Value Table ---
+
+/*
+ * With IEC_BRIDGE_SHM=<name> the backend also creates a POSIX shared
+ * memory object (/dev/shm/<name>) holding one slot per bridge handle, so a
+ * producer that maps it can write high-rate analog values as plain memory
+ * updates instead of crossing the pipe. The main loop scans it every IEC_BRIDGE_SHM_TICK_MS
+ * (default 10) and stages what changed as one batch, like a read burst.
+ *
+ *   header (64 bytes): "DUBGGSHM" | u32 version | u32 slots | u32 group size
+ *       | u32 slots per group | u32 dirty offset | u32 group offset | u32 tick
+ *   dirty map: one byte per group, padded to 64 bytes
+ *   groups (one cache line, handles 4g..4g+3): u32 seq[4] | u8 type[4]
+ *       | 12 reserved | u64 value[4]
+ *
+ * The type bytes are set by the backend and each value is little-endian in
+ * its slot's type, in the low bytes (see bridge_value_size()); string
+ * attributes are not served. A writer makes the slot's seq odd, writes the
+ * value, makes seq even again and then sets the group's dirty byte to 1.
+ * Byte and word stores suffice, so writers without atomic read-modify-write
+ * can take part; there must be one writer per slot. The relay cannot map
+ * the table from Node and falls back to four positional file writes per
+ * value, so it only uses the table when asked to (RELAY_IEC_SHM=1).
+ * Values written here reach the model on the next tick, outside any
+ * BEGIN/COMMIT batch or data set.
+ *
+ * A tick skips clean parts of the dirty map a vector at a time and then
+ * compares each dirty group's seq and value lanes against the last staged
+ * ones in a few vector operations (AVX2, SSE2 or NEON, whichever the build
+ * targets; IEC_BACKEND_MARCH=native lets the compiler use AVX2). Only slots
+ * whose seq moved are staged. A rewrite of the value the table last staged
+ * is dropped as long as no other source (pipe, DATASET, scenario, GOOSE)
+ * has written the attribute since; the first write of a slot always goes
+ * through. Values are decoded as the binding's type, and a slot whose type
+ * byte disagrees is refused. Deadbands still apply in apply_bridge_value(),
+ * on the thread that owns the IED. A group caught in the middle of a write
+ * stays dirty for the next tick.
+ */
+
+#define SHM_MAGIC "DUBGGSHM"
+#define SHM_VERSION 2
+#define SHM_GROUP_SLOTS 4
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t groupSize;
+    uint32_t groupSlots;
+    uint32_t dirtyOffset;
+    uint32_t groupOffset;
+    uint32_t tickMs;
+    uint8_t reserved[28];
+} ShmHeader;
+
+typedef struct {
+    _Alignas(64) _Atomic uint32_t seq[SHM_GROUP_SLOTS];
+    uint8_t type[SHM_GROUP_SLOTS];
+    uint8_t reserved[12];
+    uint64_t value[SHM_GROUP_SLOTS];
+} ShmGroup;
+
+/* What a tick last staged for a group, laid out like the lanes it is compared with */
+typedef struct {
+    _Alignas(64) uint64_t value[SHM_GROUP_SLOTS];
+    uint32_t seq[SHM_GROUP_SLOTS];
+} ShmShadow;
+
+static char gShmName[64];
+static uint8_t* gShmBase = NULL;
+static size_t gShmSize = 0;
+static _Atomic uint8_t* gShmDirty = NULL;
+static ShmGroup* gShmGroups = NULL;
+static ShmShadow* gShmShadow = NULL;
+static uint32_t gShmGroupCount = 0;
+static uint32_t gShmDirtySize = 0;
+static int gShmTimerFd = -1;
+
+static bool
+shm_setup(void)
+{
+    const char* name = getenv("IEC_BRIDGE_SHM");
+
+    if ((name == NULL) || (*name == 0))
+        return true;
+
+    snprintf(gShmName, sizeof(gShmName), "%s%s", (name[0] == '/') ? "" : "/", name);
+
+    int tickMs = atoi(getenv("IEC_BRIDGE_SHM_TICK_MS") ? getenv("IEC_BRIDGE_SHM_TICK_MS") : "10");
+
+    if (tickMs <= 0)
+        tickMs = 10;
+
+    gShmGroupCount = ((uint32_t) gAttrBindingCount + SHM_GROUP_SLOTS - 1) / SHM_GROUP_SLOTS;
+    gShmDirtySize = (gShmGroupCount + 63) & ~63u;
+
+    uint32_t dirtyOffset = sizeof(ShmHeader);
+    uint32_t groupOffset = dirtyOffset + gShmDirtySize;
+
+    gShmSize = groupOffset + (size_t) gShmGroupCount * sizeof(ShmGroup);
+
+    int fd = shm_open(gShmName, O_CREAT | O_RDWR | O_TRUNC, 0600);
+
+    if ((fd == -1) || (ftruncate(fd, (off_t) gShmSize) == -1)) {
+        fprintf(stderr, "Failed to create shared value table %s: %s\n", gShmName, strerror(errno));
+        if (fd != -1) {
+            close(fd);
+            shm_unlink(gShmName);
+        }
+        return false;
+    }
+
+    gShmBase = (uint8_t*) mmap(NULL, gShmSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    gShmShadow = (ShmShadow*) aligned_alloc(64, (gShmGroupCount > 0 ? gShmGroupCount : 1) * sizeof(ShmShadow));
+    gShmCurrent = (_Atomic uint8_t*) calloc(gAttrBindingCount > 0 ? gAttrBindingCount : 1, sizeof(*gShmCurrent));
+    gShmTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if ((gShmBase == MAP_FAILED) || (gShmShadow == NULL) || (gShmCurrent == NULL) || (gShmTimerFd == -1)) {
+        fprintf(stderr, "Failed to map shared value table %s\n", gShmName);
+        if (gShmBase == MAP_FAILED) {
+            gShmBase = NULL;
+            shm_unlink(gShmName);
+        }
+        return false;
+    }
+
+    memset(gShmShadow, 0, (gShmGroupCount > 0 ? gShmGroupCount : 1) * sizeof(ShmShadow));
+
+    struct itimerspec tick;
+    memset(&tick, 0, sizeof(tick));
+    tick.it_interval.tv_sec = tickMs / 1000;
+    tick.it_interval.tv_nsec = (long) (tickMs % 1000) * 1000000L;
+    tick.it_value = tick.it_interval;
+    timerfd_settime(gShmTimerFd, 0, &tick, NULL);
+
+    ShmHeader* header = (ShmHeader*) gShmBase;
+
+    gShmDirty = (_Atomic uint8_t*) (gShmBase + dirtyOffset);
+    gShmGroups = (ShmGroup*) (gShmBase + groupOffset);
+
+    for (int i = 0; i < gAttrBindingCount; i++) {
+        BridgeValueType type = gAttrBindings[i].type;
+
+        gShmGroups[i / SHM_GROUP_SLOTS].type[i % SHM_GROUP_SLOTS] = (type == BRIDGE_TYPE_STRING) ? BRIDGE_TYPE_NONE : (uint8_t) type;
+    }
+
+    header->version = SHM_VERSION;
+    header->slotCount = (uint32_t) gAttrBindingCount;
+    header->groupSize = sizeof(ShmGroup);
+    header->groupSlots = SHM_GROUP_SLOTS;
+    header->dirtyOffset = dirtyOffset;
+    header->groupOffset = groupOffset;
+    header->tickMs = (uint32_t) tickMs;
+
+    // Writers check the magic last, once the layout is in place
+    atomic_thread_fence(memory_order_release);
+    memcpy(header->magic, SHM_MAGIC, sizeof(header->magic));
+
+    printf("BRIDGE_SHM /dev/shm%s %d %d\n", gShmName, gAttrBindingCount, tickMs);
+
+    return true;
+}
+
+static void
+shm_destroy(void)
+{
+    if (gShmTimerFd != -1)
+        close(gShmTimerFd);
+
+    if (gShmBase) {
+        munmap(gShmBase, gShmSize);
+        shm_unlink(gShmName);
+    }
+
+    free(gShmShadow);
+    free((void*) gShmCurrent);
+    gShmBase = NULL;
+    gShmShadow = NULL;
+    gShmCurrent = NULL;
+    gShmTimerFd = -1;
+}
+
+/*
+ * Compares the lanes of one group with its shadow. Sets bit i of *moved if
+ * slot i's seq differs from the staged one, of *stable if the seq did not
+ * change while the values were read, and of *same if the value equals the
+ * staged one. seq and value receive the lanes that were read.
+ */
+static inline void
+shm_compare_group(const ShmGroup* group, const ShmShadow* shadow, uint32_t* seq, uint64_t* value,
+        unsigned* moved, unsigned* stable, unsigned* same)
+{
+#if defined(__SSE2__)
+    __m128i seqs = _mm_load_si128((const __m128i*) (const void*) group->seq);
+
+    // x86 keeps loads in order; the fences stop the compiler from moving the value loads across the seq loads
+    atomic_thread_fence(memory_order_acquire);
+
+    __m128i lo = _mm_load_si128((const __m128i*) (const void*) &group->value[0]);
+    __m128i hi = _mm_load_si128((const __m128i*) (const void*) &group->value[2]);
+
+    atomic_thread_fence(memory_order_acquire);
+
+    __m128i again = _mm_load_si128((const __m128i*) (const void*) group->seq);
+
+    *moved = ~(unsigned) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(seqs, _mm_load_si128((const __m128i*) shadow->seq)))) & 0xf;
+    *stable = (unsigned) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(seqs, again)));
+#if defined(__AVX2__)
+    __m256i values = _mm256_set_m128i(hi, lo);
+
+    *same = (unsigned) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(values, _mm256_load_si256((const __m256i*) shadow->value))));
+#else
+    // No 64-bit compare before SSE4.1: both 32-bit halves must match
+    __m128i eqLo = _mm_cmpeq_epi32(lo, _mm_load_si128((const __m128i*) &shadow->value[0]));
+    __m128i eqHi = _mm_cmpeq_epi32(hi, _mm_load_si128((const __m128i*) &shadow->value[2]));
+
+    eqLo = _mm_and_si128(eqLo, _mm_shuffle_epi32(eqLo, _MM_SHUFFLE(2, 3, 0, 1)));
+    eqHi = _mm_and_si128(eqHi, _mm_shuffle_epi32(eqHi, _MM_SHUFFLE(2, 3, 0, 1)));
+    *same = (unsigned) _mm_movemask_pd(_mm_castsi128_pd(eqLo)) | ((unsigned) _mm_movemask_pd(_mm_castsi128_pd(eqHi)) << 2);
+#endif
+    _mm_storeu_si128((__m128i*) seq, seqs);
+    _mm_storeu_si128((__m128i*) &value[0], lo);
+    _mm_storeu_si128((__m128i*) &value[2], hi);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    static const uint32_t laneBits32[4] = { 1, 2, 4, 8 };
+    static const uint64_t laneBits64[2] = { 1, 2 };
+    uint32x4_t seqs = vld1q_u32((const uint32_t*) (const void*) group->seq);
+
+    // Without it the value loads may be satisfied before the seq loads, and a torn slot would look stable
+    atomic_thread_fence(memory_order_acquire);
+
+    uint64x2_t lo = vld1q_u64(&group->value[0]);
+    uint64x2_t hi = vld1q_u64(&group->value[2]);
+
+    atomic_thread_fence(memory_order_acquire);
+
+    uint32x4_t again = vld1q_u32((const uint32_t*) (const void*) group->seq);
+    uint32x4_t bits32 = vld1q_u32(laneBits32);
+    uint64x2_t bits64 = vld1q_u64(laneBits64);
+
+    *moved = ~vaddvq_u32(vandq_u32(vceqq_u32(seqs, vld1q_u32(shadow->seq)), bits32)) & 0xf;
+    *stable = vaddvq_u32(vandq_u32(vceqq_u32(seqs, again), bits32));
+    *same = (unsigned) (vaddvq_u64(vandq_u64(vceqq_u64(lo, vld1q_u64(&shadow->value[0])), bits64)) |
+            (vaddvq_u64(vandq_u64(vceqq_u64(hi, vld1q_u64(&shadow->value[2])), bits64)) << 2));
+    vst1q_u32(seq, seqs);
+    vst1q_u64(&value[0], lo);
+    vst1q_u64(&value[2], hi);
+#else
+    for (int i = 0; i < SHM_GROUP_SLOTS; i++)
+        seq[i] = atomic_load_explicit(&group->seq[i], memory_order_acquire);
+
+    memcpy(value, (const void*) group->value, sizeof(group->value));
+    atomic_thread_fence(memory_order_acquire);
+
+    *moved = *stable = *same = 0;
+
+    for (int i = 0; i < SHM_GROUP_SLOTS; i++) {
+        *moved |= (unsigned) (seq[i] != shadow->seq[i]) << i;
+        *stable |= (unsigned) (atomic_load_explicit(&group->seq[i], memory_order_relaxed) == seq[i]) << i;
+        *same |= (unsigned) (value[i] == shadow->value[i]) << i;
+    }
+#endif
+}
+
+/* Bit i set for each non-zero dirty byte at `offset`..`offset` + 31 */
+static inline uint32_t
+shm_dirty_mask(uint32_t offset)
+{
+    const uint8_t* bytes = (const uint8_t*) (const void*) (gShmDirty + offset);
+
+#if defined(__AVX2__)
+    __m256i dirty = _mm256_load_si256((const __m256i*) bytes);
+
+    if (_mm256_testz_si256(dirty, dirty))
+        return 0;
+
+    return ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(dirty, _mm256_setzero_si256()));
+#elif defined(__SSE2__)
+    __m128i lo = _mm_load_si128((const __m128i*) bytes);
+    __m128i hi = _mm_load_si128((const __m128i*) (bytes + 16));
+    uint32_t zero = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(lo, _mm_setzero_si128())) |
+            ((uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(hi, _mm_setzero_si128())) << 16);
+
+    return ~zero;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    uint8x16_t lo = vld1q_u8(bytes);
+    uint8x16_t hi = vld1q_u8(bytes + 16);
+
+    if (vmaxvq_u8(vorrq_u8(lo, hi)) == 0)
+        return 0;
+
+    uint32_t mask = 0;
+
+    for (int i = 0; i < 32; i++)
+        mask |= (uint32_t) (bytes[i] != 0) << i;
+
+    return mask;
+#else
+    uint64_t words[4];
+    uint32_t mask = 0;
+
+    memcpy(words, bytes, sizeof(words));
+
+    if ((words[0] | words[1] | words[2] | words[3]) == 0)
+        return 0;
+
+    for (int i = 0; i < 32; i++)
+        mask |= (uint32_t) (bytes[i] != 0) << i;
+
+    return mask;
+#endif
+}
+
+/* Stages the slots of a dirty group that changed; returns false if a write was in progress */
+static bool
+shm_scan_group(uint32_t group)
+{
+    ShmShadow* shadow = &gShmShadow[group];
+    uint32_t seq[SHM_GROUP_SLOTS];
+    uint64_t value[SHM_GROUP_SLOTS];
+    unsigned moved, stable, same;
+
+    shm_compare_group(&gShmGroups[group], shadow, seq, value, &moved, &stable, &same);
+
+    if (moved == 0)
+        return true;
+
+    bool complete = true;
+
+    for (unsigned lanes = moved; lanes; lanes &= lanes - 1) {
+        int lane = __builtin_ctz(lanes);
+        uint32_t index = group * SHM_GROUP_SLOTS + (uint32_t) lane;
+
+        if ((seq[lane] & 1) || !(stable & (1u << lane))) {
+            complete = false;
+            continue;
+        }
+
+        shadow->seq[lane] = seq[lane];
+
+        if (index >= (uint32_t) gAttrBindingCount)
+            continue;
+
+        // A rewrite of the same value is only skipped while no other source has written the attribute since
+        if ((same & (1u << lane)) && atomic_load_explicit(&gShmCurrent[index], memory_order_relaxed))
+            continue;
+
+        shadow->value[lane] = value[lane];
+
+        const AttributeBinding* binding = &gAttrBindings[index];
+        BridgeValue update;
+
+        // The type byte is writable by any writer that maps the table, so it only has to agree with the binding
+        update.type = binding->type;
+
+        if (bridge_value_size(update.type) == 0)
+            continue;
+
+        if (gShmGroups[group].type[lane] != (uint8_t) update.type) {
+            bridge_log_error("BRIDGE_ERR: Shared value type %u does not match %s", gShmGroups[group].type[lane], binding->reference);
+            continue;
+        }
+
+        decode_bridge_value(&update, (const uint8_t*) &value[lane], bridge_value_size(update.type));
+
+        if (!bridge_value_in_range(binding, &update)) {
+            bridge_log_error("BRIDGE_ERR: Shared value out of range for %s", binding->reference);
+            continue;
+        }
+
+        *stage_update(binding, 0) = update;
+        atomic_store_explicit(&gShmCurrent[index], 1, memory_order_relaxed);
+        log_counter_increment(&gLogCounters.updates);
+    }
+
+    return complete;
+}
+
+/* Timer tick of the main loop: stages every changed slot and commits them as one batch */
+static void
+shm_scan(void)
+{
+    uint64_t expirations;
+
+    if (read(gShmTimerFd, &expirations, sizeof(expirations)) != sizeof(expirations))
+        return;
+
+    uint64_t startNs = monotonic_ns();
+
+    gInputArrivalNs = startNs;
+
+    // The dirty map is padded to 64 bytes, so every 32-byte block lies inside it
+    for (uint32_t offset = 0; offset < gShmDirtySize; offset += 32) {
+        for (uint32_t mask = shm_dirty_mask(offset); mask; mask &= mask - 1) {
+            uint32_t group = offset + (uint32_t) __builtin_ctz(mask);
+
+            if ((group >= gShmGroupCount) || (atomic_exchange_explicit(&gShmDirty[group], 0, memory_order_acquire) == 0))
+                continue;
+
+            if (!shm_scan_group(group))
+                atomic_store_explicit(&gShmDirty[group], 1, memory_order_relaxed);
+        }
+    }
+
+    metrics_record(&tMetrics->shmScanNs, monotonic_ns() - startNs);
+
+    if (!gInTransaction)
+        commit_staged_updates();
+}
+
+// --- State Snapshot ---
+
+/*
+ * With IEC_BRIDGE_SNAPSHOT=<file> the backend keeps the values of all
+ * bridge attributes in a file, rewritten every IEC_BRIDGE_SNAPSHOT_MS
+ * (default 1000) while updates arrive and once more on exit. At startup an
+ * existing snapshot is written into the models in one pass before any MMS
+ * port opens, so clients of a restarted backend never see the SCD defaults
+ * and the relay has nothing to replay line by line.
+ *
+ *   header (24 bytes): "DUBGGSNP" | u32 version | u32 entries
+ *       | u32 handle table hash | u32 reserved
+ *   entry: u32 handle | u8 type | u16 reference length | reference | value
+ *
+ * Values are little-endian as in BRIDGE_OP_UPDATE frames, strings as u8
+ * length | bytes. When the handle table hash matches, entries are applied
+ * by handle; otherwise (another SCD or model config) by reference, and
+ * entries whose attribute is gone or changed type are skipped.
+ *
+ * The serving loop only encodes the values into the snapshot buffer, one
+ * IED lock at a time. A writer thread then writes the temp file, fsyncs it
+ * and renames it over the snapshot, so a crash or power loss while writing
+ * leaves the previous one. A tick that finds the writer still busy is
+ * skipped; the next one picks up the changes.
+ */
+
+#define SNAPSHOT_MAGIC "DUBGGSNP"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_HEADER_SIZE 24
+#define SNAPSHOT_ENTRY_OVERHEAD 7
+
+static const char* gSnapshotPath = NULL;
+static char* gSnapshotTempPath = NULL;
+static uint8_t* gSnapshotBuffer = NULL;
+static size_t gSnapshotCapacity = 0;
+static uint32_t gSnapshotTableHash = 0;
+static int gSnapshotTimerFd = -1;
+static Thread gSnapshotThread = NULL;
+static sem_t gSnapshotWake;
+static atomic_bool gSnapshotBusy;  /* buffer handed to the writer thread */
+static atomic_int gSnapshotError;  /* errno of the last failed write, reported by the serving loop */
+static atomic_int gSnapshotRunning;
+static size_t gSnapshotSize = 0;
+
+static void
+write_u32le(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t) value;
+    p[1] = (uint8_t) (value >> 8);
+    p[2] = (uint8_t) (value >> 16);
+    p[3] = (uint8_t) (value >> 24);
+}
+
+static void
+write_u64le(uint8_t* p, uint64_t value)
+{
+    write_u32le(p, (uint32_t) value);
+    write_u32le(p + 4, (uint32_t) (value >> 32));
+}
+
+/* Appends the attribute's current value in its bridge encoding, called with the data model locked */
+static uint8_t*
+snapshot_encode_value(uint8_t* out, const AttributeBinding* binding)
+{
+    MmsValue* value = binding->attr->mmsValue;
+
+    switch (binding->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        *out++ = MmsValue_getBoolean(value) ? 1 : 0;
+        break;
+    case BRIDGE_TYPE_INT32:
+        write_u32le(out, (uint32_t) MmsValue_toInt32(value));
+        out += 4;
+        break;
+    case BRIDGE_TYPE_UINT32:
+        write_u32le(out, MmsValue_toUint32(value));
+        out += 4;
+        break;
+    case BRIDGE_TYPE_BITSTRING:
+        write_u32le(out, MmsValue_getBitStringAsInteger(value));
+        out += 4;
+        break;
+    case BRIDGE_TYPE_FLOAT: {
+        float real = MmsValue_toFloat(value);
+        uint32_t raw;
+
+        memcpy(&raw, &real, sizeof(raw));
+        write_u32le(out, raw);
+        out += 4;
+        break;
+    }
+    case BRIDGE_TYPE_INT64:
+        write_u64le(out, (uint64_t) MmsValue_toInt64(value));
+        out += 8;
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        write_u64le(out, MmsValue_getUtcTimeInMs(value));
+        out += 8;
+        break;
+    case BRIDGE_TYPE_STRING: {
+        const char* text = MmsValue_toString(value);
+        size_t len = text ? strlen(text) : 0;
+
+        if (len > 255)
+            len = 255;
+
+        *out++ = (uint8_t) len;
+        memcpy(out, text, len);
+        out += len;
+        break;
+    }
+    case BRIDGE_TYPE_DBPOS:
+        *out++ = (uint8_t) Dbpos_fromMmsValue(value);
+        break;
+    default:
+        break;
+    }
+
+    return out;
+}
+
+/* Writes a restored value without report processing; the servers are not running yet */
+static void
+snapshot_store_value(AttributeBinding* binding, const BridgeValue* value)
+{
+    MmsValue* mmsValue = binding->attr->mmsValue;
+
+    switch (binding->type) {
+    case BRIDGE_TYPE_BOOLEAN:
+        MmsValue_setBoolean(mmsValue, value->v.boolean);
+        break;
+    case BRIDGE_TYPE_INT32:
+        MmsValue_setInt32(mmsValue, value->v.int32);
+        break;
+    case BRIDGE_TYPE_UINT32:
+        MmsValue_setUint32(mmsValue, value->v.uint32);
+        break;
+    case BRIDGE_TYPE_BITSTRING:
+        MmsValue_setBitStringFromInteger(mmsValue, value->v.uint32);
+        break;
+    case BRIDGE_TYPE_FLOAT:
+        MmsValue_setFloat(mmsValue, value->v.float32);
+        break;
+    case BRIDGE_TYPE_INT64:
+        MmsValue_setInt64(mmsValue, value->v.int64);
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        MmsValue_setUtcTimeMs(mmsValue, value->v.timeMs);
+        break;
+    case BRIDGE_TYPE_STRING:
+        MmsValue_setVisibleString(mmsValue, value->str);
+        break;
+    case BRIDGE_TYPE_DBPOS:
+        Dbpos_toMmsValue(mmsValue, (Dbpos) value->v.uint32);
+        break;
+    default:
+        return;
+    }
+
+    // The restored magnitude is what clients have seen, so deadbands measure from it
+    if (binding->deadband) {
+        binding->deadband->reported = (binding->type == BRIDGE_TYPE_FLOAT) ? value->v.float32 : value->v.int32;
+        binding->deadband->hasReported = true;
+    }
+}
+
+/* Encodes all bridge values into the snapshot buffer; runs on the serving loop */
+static void
+snapshot_encode(void)
+{
+    uint8_t* out = gSnapshotBuffer + SNAPSHOT_HEADER_SIZE;
+    uint32_t entries = 0;
+
+    // Cleared first, so writes that race with the encoding mark the next snapshot
+    atomic_store_explicit(&gStateChanged, false, memory_order_relaxed);
+
+    // One lock per IED; the bindings of an IED need not be contiguous
+    for (int n = 0; n < gIedCount; n++) {
+        IedServer_lockDataModel(gIeds[n].server);
+
+        for (int i = 0; i < gAttrBindingCount; i++) {
+            const AttributeBinding* binding = &gAttrBindings[i];
+            size_t refLen = strlen(binding->reference);
+
+            if ((binding->ied != &gIeds[n]) || ((binding->type != BRIDGE_TYPE_STRING) && (bridge_value_size(binding->type) == 0)))
+                continue;
+
+            write_u32le(out, (uint32_t) i);
+            out[4] = (uint8_t) binding->type;
+            out[5] = (uint8_t) refLen;
+            out[6] = (uint8_t) (refLen >> 8);
+            memcpy(out + SNAPSHOT_ENTRY_OVERHEAD, binding->reference, refLen);
+            out = snapshot_encode_value(out + SNAPSHOT_ENTRY_OVERHEAD + refLen, binding);
+            entries++;
+        }
+
+        IedServer_unlockDataModel(gIeds[n].server);
+    }
+
+    memcpy(gSnapshotBuffer, SNAPSHOT_MAGIC, 8);
+    write_u32le(gSnapshotBuffer + 8, SNAPSHOT_VERSION);
+    write_u32le(gSnapshotBuffer + 12, entries);
+    write_u32le(gSnapshotBuffer + 16, gSnapshotTableHash);
+    write_u32le(gSnapshotBuffer + 20, 0);
+
+    gSnapshotSize = (size_t) (out - gSnapshotBuffer);
+}
+
+/* Replaces the snapshot file with the encoded buffer; returns 0 or the errno of the failed step */
+static int
+snapshot_write_file(void)
+{
+    errno = 0;
+
+    int fd = open(gSnapshotTempPath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    bool written = (fd != -1) && (write(fd, gSnapshotBuffer, gSnapshotSize) == (ssize_t) gSnapshotSize) && (fsync(fd) == 0);
+    int error = written ? 0 : (errno ? errno : EIO);
+
+    if (fd != -1)
+        close(fd);
+
+    if (written && (rename(gSnapshotTempPath, gSnapshotPath) == -1)) {
+        written = false;
+        error = errno;
+    }
+
+    if (!written)
+        unlink(gSnapshotTempPath);
+
+    return error;
+}
+
+static void*
+snapshot_writer_thread(void* arg)
+{
+    (void) arg;
+
+    for (;;) {
+        sem_wait(&gSnapshotWake);
+
+        if (!atomic_load_explicit(&gSnapshotBusy, memory_order_acquire)) {
+            if (!atomic_load_explicit(&gSnapshotRunning, memory_order_relaxed))
+                break;
+            continue;
+        }
+
+        int error = snapshot_write_file();
+
+        if (error) {
+            atomic_store_explicit(&gSnapshotError, error, memory_order_relaxed);
+            mark_state_changed();
+        }
+
+        atomic_store_explicit(&gSnapshotBusy, false, memory_order_release);
+    }
+
+    return NULL;
+}
+
+static void
+snapshot_report_error(void)
+{
+    int error = atomic_exchange_explicit(&gSnapshotError, 0, memory_order_relaxed);
+
+    if (error)
+        bridge_log_error("BRIDGE_ERR: Failed to write state snapshot %s: %s", gSnapshotPath, strerror(error));
+}
+
+static void
+snapshot_restore(void)
+{
+    int fd = open(gSnapshotPath, O_RDONLY | O_CLOEXEC);
+    struct stat info;
+
+    if (fd == -1)
+        return;
+
+    uint64_t startNs = monotonic_ns();
+    uint8_t* data = NULL;
+    size_t size = 0;
+
+    if ((fstat(fd, &info) == 0) && (info.st_size >= SNAPSHOT_HEADER_SIZE)) {
+        size = (size_t) info.st_size;
+        data = (uint8_t*) malloc(size);
+
+        if (data && (read(fd, data, size) != (ssize_t) size)) {
+            free(data);
+            data = NULL;
+        }
+    }
+
+    close(fd);
+
+    if ((data == NULL) || (memcmp(data, SNAPSHOT_MAGIC, 8) != 0) || (read_u32le(data + 8) != SNAPSHOT_VERSION)) {
+        fprintf(stderr, "Ignoring state snapshot %s: not a version %d snapshot\n", gSnapshotPath, SNAPSHOT_VERSION);
+        free(data);
+        return;
+    }
+
+    uint32_t entries = read_u32le(data + 12);
+    bool sameTable = (read_u32le(data + 16) == gSnapshotTableHash);
+    size_t pos = SNAPSHOT_HEADER_SIZE;
+    int restored = 0, skipped = 0;
+
+    for (uint32_t e = 0; e < entries; e++) {
+        if (size - pos < SNAPSHOT_ENTRY_OVERHEAD)
+            break;
+
+        uint32_t handle = read_u32le(data + pos);
+        BridgeValue value;
+        value.type = (BridgeValueType) data[pos + 4];
+        size_t refLen = (size_t) data[pos + 5] | ((size_t) data[pos + 6] << 8);
+        const char* ref = (const char*) (data + pos + SNAPSHOT_ENTRY_OVERHEAD);
+
+        pos += SNAPSHOT_ENTRY_OVERHEAD + refLen;
+
+        size_t valueLen = bridge_value_size(value.type);
+
+        if ((pos < size) && (value.type == BRIDGE_TYPE_STRING))
+            valueLen = data[pos++];
+
+        if ((pos > size) || (size - pos < valueLen) || ((valueLen == 0) && (value.type != BRIDGE_TYPE_STRING)))
+            break;
+
+        AttributeBinding* binding = (sameTable && (handle < (uint32_t) gAttrBindingCount)) ? &gAttrBindings[handle]
+                : index_lookup(ref, refLen);
+
+        if (binding && (binding->type == value.type)) {
+            decode_bridge_value(&value, data + pos, valueLen);
+            snapshot_store_value(binding, &value);
+            restored++;
+        }
+        else {
+            skipped++;
+        }
+
+        pos += valueLen;
+    }
+
+    if (restored + skipped < (int) entries)
+        fprintf(stderr, "State snapshot %s is truncated after %d of %u entries\n", gSnapshotPath, restored + skipped, entries);
+
+    printf("Restored %d bridge values from %s in %.1f ms (%d skipped)\n", restored, gSnapshotPath,
+            (double) (monotonic_ns() - startNs) / 1e6, skipped);
+
+    free(data);
+}
+
+/* Allocates the snapshot buffer and restores the last snapshot; must run before the servers start */
+static bool
+snapshot_setup(void)
+{
+    const char* path = getenv("IEC_BRIDGE_SNAPSHOT");
+
+    if ((path == NULL) || (*path == 0))
+        return true;
+
+    int intervalMs = atoi(getenv("IEC_BRIDGE_SNAPSHOT_MS") ? getenv("IEC_BRIDGE_SNAPSHOT_MS") : "1000");
+
+    if (intervalMs <= 0)
+        intervalMs = 1000;
+
+    gSnapshotPath = path;
+    gSnapshotCapacity = SNAPSHOT_HEADER_SIZE;
+    gSnapshotTableHash = 2166136261u;
+
+    for (int i = 0; i < gAttrBindingCount; i++) {
+        const AttributeBinding* binding = &gAttrBindings[i];
+        size_t refLen = strlen(binding->reference);
+        uint8_t type = (uint8_t) binding->type;
+
+        gSnapshotCapacity += SNAPSHOT_ENTRY_OVERHEAD + refLen + ((binding->type == BRIDGE_TYPE_STRING) ? 256 : 8);
+        gSnapshotTableHash = (index_hash(binding->reference, refLen) ^ gSnapshotTableHash) * 16777619u;
+        gSnapshotTableHash = (gSnapshotTableHash ^ type) * 16777619u;
+    }
+
+    gSnapshotBuffer = (uint8_t*) malloc(gSnapshotCapacity);
+    gSnapshotTempPath = (char*) malloc(strlen(path) + 5);
+    gSnapshotTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if ((gSnapshotBuffer == NULL) || (gSnapshotTempPath == NULL) || (gSnapshotTimerFd == -1)) {
+        fprintf(stderr, "Failed to set up state snapshot %s\n", path);
+        return false;
+    }
+
+    sprintf(gSnapshotTempPath, "%s.tmp", path);
+    sem_init(&gSnapshotWake, 0, 0);
+
+    struct itimerspec period;
+    memset(&period, 0, sizeof(period));
+    period.it_interval.tv_sec = intervalMs / 1000;
+    period.it_interval.tv_nsec = (long) (intervalMs % 1000) * 1000000L;
+    period.it_value = period.it_interval;
+    timerfd_settime(gSnapshotTimerFd, 0, &period, NULL);
+
+    snapshot_restore();
+
+    printf("State snapshot %s every %d ms while values change\n", path, intervalMs);
+
+    return true;
+}
+
+static void
+snapshot_start(void)
+{
+    if (gSnapshotBuffer == NULL)
+        return;
+
+    atomic_store(&gSnapshotRunning, 1);
+
+    gSnapshotThread = Thread_create(snapshot_writer_thread, NULL, false);
+    Thread_start(gSnapshotThread);
+}
+
+static void
+snapshot_tick(void)
+{
+    uint64_t expirations;
+
+    if (read(gSnapshotTimerFd, &expirations, sizeof(expirations)) != sizeof(expirations))
+        return;
+
+    snapshot_report_error();
+
+    if (!atomic_load_explicit(&gStateChanged, memory_order_relaxed) ||
+            atomic_load_explicit(&gSnapshotBusy, memory_order_acquire))
+        return;
+
+    snapshot_encode();
+    atomic_store_explicit(&gSnapshotBusy, true, memory_order_release);
+    sem_post(&gSnapshotWake);
+}
+
+/* Waits for the writer and writes the final snapshot, while the servers still exist */
+static void
+snapshot_destroy(void)
+{
+    if (gSnapshotThread) {
+        atomic_store(&gSnapshotRunning, 0);
+        sem_post(&gSnapshotWake);
+        Thread_destroy(gSnapshotThread);
+        gSnapshotThread = NULL;
+    }
+
+    if (gSnapshotBuffer) {
+        snapshot_report_error();
+
+        if (atomic_load_explicit(&gStateChanged, memory_order_relaxed)) {
+            snapshot_encode();
+
+            int error = snapshot_write_file();
+
+            if (error)
+                bridge_log_error("BRIDGE_ERR: Failed to write state snapshot %s: %s", gSnapshotPath, strerror(error));
+        }
+
+        sem_destroy(&gSnapshotWake);
+    }
+
+    if (gSnapshotTimerFd != -1)
+        close(gSnapshotTimerFd);
+
+    free(gSnapshotBuffer);
+    free(gSnapshotTempPath);
+    gSnapshotBuffer = NULL;
+    gSnapshotTempPath = NULL;
+    gSnapshotTimerFd = -1;
+}
+
+// --- Scenario Player ---
+
+/*
+ * IEC_SCENARIO=<file> makes the backend play a scenario on its own, with no
+ * relay or UI involved, for repeatable timing tests of the server itself:
+ *
+ *   # comment
+ *   <ms> <ref>=<value>                 attribute update, as on the bridge
+ *   <ms> DATASET <ref>=<v1>;<v2>;...   data set update, see Data Set Index
+ *   <ms> EXPECT <control ref> <window ms>
+ *
+ * Times are milliseconds (fractions allowed) from the start of a pass, so a
+ * trace recorded with RELAY_IEC_TRACE_FILE plays as is. The file is compiled
+ * at startup: references are resolved and values parsed once, events sorted
+ * by time; unknown references are skipped and counted, malformed lines stop
+ * the backend. Playback starts IEC_SCENARIO_DELAY_MS (default 1000) after
+ * the servers and repeats IEC_SCENARIO_PASSES (default 1) times.
+ *
+ * A timerfd of the main loop is armed to the absolute time of the next event,
+ * and everything due is staged and committed as one batch through the same
+ * path as bridge input, with 't' set to the scheduled time rather than the
+ * time of application. Lateness runs from the scheduled time to the commit
+ * of the batch. An EXPECT line waits for an MMS client to operate the
+ * control (the DO reference of a BRIDGE_CONTROL line) within the window and
+ * times the first operate; a control has one expectation at a time. After
+ * each pass the backend prints, cumulated over the passes so far,
+ *
+ *   SCENARIO pass=<n> passes=<n> events=<n> late_p50_us=<n> late_p99_us=<n>
+ *       late_max_us=<n> expected=<n> met=<n> missed=<n> control_p50_us=<n>
+ *       control_p99_us=<n> control_max_us=<n>
+ *
+ * on one line, and a SCENARIO_MISS line for every expectation that timed out.
+ */
+
+#define SCENARIO_MAX_EXPECTATIONS 64
+
+typedef enum {
+    SCENARIO_UPDATE,
+    SCENARIO_DATASET,
+    SCENARIO_EXPECT
+} ScenarioEventType;
+
+/* A parsed value in its bridge frame encoding, 16 bytes instead of a BridgeValue */
 typedef struct {
-    DataObject* controlDo;
-    DataAttribute* stValAttr;
-    DataAttribute* tAttr;
-    char reference[256];
-} ControlBinding;
+    uint8_t type;   /* BRIDGE_TYPE_NONE skips a data set member */
+    uint8_t len;    /* strings: length in gScenarioStrings */
+    uint32_t str;
+    uint8_t raw[8];
+} ScenarioValue;
+
+typedef struct {
+    uint64_t atNs;   /* from the start of a pass */
+    uint32_t line;
+    ScenarioEventType type;
+    union {
+        AttributeBinding* binding;
+        DataSetBinding* dataSet;
+        ControlBinding* control;
+    } target;
+    uint32_t value;  /* first ScenarioValue, or the window in ms of an expectation */
+} ScenarioEvent;
+
+typedef struct {
+    ControlBinding* control;
+    uint64_t sinceNs;
+    uint64_t deadlineNs;
+    uint32_t line;
+} ScenarioExpectation;
+
+static ScenarioEvent* gScenarioEvents = NULL;
+static int gScenarioEventCount = 0;
+static int gScenarioEventCapacity = 0;
+static ScenarioValue* gScenarioValues = NULL;
+static int gScenarioValueCount = 0;
+static int gScenarioValueCapacity = 0;
+static char* gScenarioStrings = NULL;
+static size_t gScenarioStringBytes = 0;
+static size_t gScenarioStringCapacity = 0;
+static ScenarioExpectation gScenarioExpectations[SCENARIO_MAX_EXPECTATIONS];
+static int gScenarioExpectationCount = 0;
+static int gScenarioNext = 0;
+static int gScenarioPass = 0;
+static int gScenarioPasses = 1;
+static uint64_t gScenarioStartNs = 0;
+static uint64_t gScenarioStartMs = 0;  /* wall clock at the start of the pass, for 't' */
+static uint64_t gScenarioExpected = 0;
+static uint64_t gScenarioMet = 0;
+static uint64_t gScenarioMissed = 0;
+static int gScenarioTimerFd = -1;
+
+static bool
+scenario_grow(void** array, int* capacity, int needed, size_t size)
+{
+    if (needed <= *capacity)
+        return true;
+
+    int grown = (*capacity > 0) ? *capacity * 2 : 1024;
+
+    while (grown < needed)
+        grown *= 2;
+
+    void* resized = realloc(*array, (size_t) grown * size);
+
+    if (resized == NULL)
+        return false;
+
+    *array = resized;
+    *capacity = grown;
+    return true;
+}
+
+static bool
+scenario_store_value(const BridgeValue* value, ScenarioValue* out)
+{
+    memset(out, 0, sizeof(*out));
+    out->type = (uint8_t) value->type;
+
+    switch (value->type) {
+    case BRIDGE_TYPE_NONE:
+        break;
+    case BRIDGE_TYPE_BOOLEAN:
+        out->raw[0] = value->v.boolean ? 1 : 0;
+        break;
+    case BRIDGE_TYPE_DBPOS:
+        out->raw[0] = (uint8_t) value->v.uint32;
+        break;
+    case BRIDGE_TYPE_INT32:
+        write_u32le(out->raw, (uint32_t) value->v.int32);
+        break;
+    case BRIDGE_TYPE_UINT32:
+    case BRIDGE_TYPE_BITSTRING:
+        write_u32le(out->raw, value->v.uint32);
+        break;
+    case BRIDGE_TYPE_FLOAT: {
+        uint32_t raw;
+
+        memcpy(&raw, &value->v.float32, sizeof(raw));
+        write_u32le(out->raw, raw);
+        break;
+    }
+    case BRIDGE_TYPE_INT64:
+        write_u64le(out->raw, (uint64_t) value->v.int64);
+        break;
+    case BRIDGE_TYPE_UTCTIME:
+        write_u64le(out->raw, value->v.timeMs);
+        break;
+    case BRIDGE_TYPE_STRING: {
+        size_t len = strlen(value->str);
+
+        if (len > 255)
+            len = 255;
+
+        if (gScenarioStringBytes + len > gScenarioStringCapacity) {
+            size_t grown = (gScenarioStringCapacity > 0) ? gScenarioStringCapacity * 2 : 4096;
+            char* resized = (char*) realloc(gScenarioStrings, grown);
+
+            if (resized == NULL)
+                return false;
+
+            gScenarioStrings = resized;
+            gScenarioStringCapacity = grown;
+        }
+
+        memcpy(gScenarioStrings + gScenarioStringBytes, value->str, len);
+        out->str = (uint32_t) gScenarioStringBytes;
+        out->len = (uint8_t) len;
+        gScenarioStringBytes += len;
+        break;
+    }
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+static void
+scenario_load_value(const ScenarioValue* stored, BridgeValue* value)
+{
+    value->type = (BridgeValueType) stored->type;
+
+    if (value->type == BRIDGE_TYPE_STRING)
+        decode_bridge_value(value, (const uint8_t*) gScenarioStrings + stored->str, stored->len);
+    else if (value->type != BRIDGE_TYPE_NONE)
+        decode_bridge_value(value, stored->raw, bridge_value_size(value->type));
+}
+
+static ControlBinding*
+scenario_find_control(const char* ref)
+{
+    for (int i = 0; i < gBindingCount; i++) {
+        if (strcmp(gBindings[i].reference, ref) == 0)
+            return &gBindings[i];
+    }
+
+    return NULL;
+}
+
+/* "<v1>;<v2>;..." in member order, empty values skip the member */
+static bool
+scenario_parse_data_set(DataSetBinding* ds, char* values, int firstValue)
+{
+    char* field = values;
+
+    for (int m = 0; m < ds->memberCount; m++) {
+        char* end = strchr(field, ';');
+        BridgeValue value;
+
+        if ((end == NULL) != (m == ds->memberCount - 1))
+            return false;
+
+        if (end)
+            *end = 0;
+
+        value.type = BRIDGE_TYPE_NONE;
+
+        if (*field && ((ds->members[m] == NULL) || !parse_text_value(ds->members[m], field, &value)))
+            return false;
+
+        if (!scenario_store_value(&value, &gScenarioValues[firstValue + m]))
+            return false;
+
+        if (end == NULL)
+            break;
+
+        field = end + 1;
+    }
+
+    return true;
+}
+
+/* Compiles one line into an event; returns false for a malformed line, *resolved tells skipped ones */
+static bool
+scenario_parse_line(char* line, uint32_t lineNo, bool* resolved)
+{
+    char* rest;
+    double atMs = strtod(line, &rest);
+
+    *resolved = false;
+
+    if ((rest == line) || (atMs < 0) || !isspace((unsigned char) *rest))
+        return false;
+
+    while (isspace((unsigned char) *rest))
+        rest++;
+
+    if (!scenario_grow((void**) &gScenarioEvents, &gScenarioEventCapacity, gScenarioEventCount + 1, sizeof(ScenarioEvent)))
+        return false;
+
+    ScenarioEvent* event = &gScenarioEvents[gScenarioEventCount];
+
+    event->atNs = (uint64_t) (atMs * 1e6);
+    event->line = lineNo;
+
+    if (strncmp(rest, "EXPECT ", 7) == 0) {
+        char ref[512];
+        unsigned windowMs;
+
+        if (sscanf(rest + 7, "%511s %u", ref, &windowMs) != 2)
+            return false;
+
+        event->type = SCENARIO_EXPECT;
+        event->target.control = scenario_find_control(ref);
+        event->value = windowMs;
+        *resolved = (event->target.control != NULL);
+    }
+    else if (strncmp(rest, "DATASET ", 8) == 0) {
+        char* eq = strchr(rest + 8, '=');
+
+        if (eq == NULL)
+            return false;
+
+        *eq = 0;
+        event->type = SCENARIO_DATASET;
+        event->target.dataSet = find_data_set_binding(rest + 8);
+
+        if (event->target.dataSet == NULL)
+            return true;
+
+        int memberCount = event->target.dataSet->memberCount;
+
+        if (!scenario_grow((void**) &gScenarioValues, &gScenarioValueCapacity, gScenarioValueCount + memberCount,
+                sizeof(ScenarioValue)) || !scenario_parse_data_set(event->target.dataSet, eq + 1, gScenarioValueCount))
+            return false;
+
+        event->value = (uint32_t) gScenarioValueCount;
+        gScenarioValueCount += memberCount;
+        *resolved = true;
+    }
+    else {
+        char* eq = strchr(rest, '=');
+        BridgeValue value;
+
+        if (eq == NULL)
+            return false;
+
+        *eq = 0;
+        event->type = SCENARIO_UPDATE;
+        event->target.binding = index_lookup(rest, strlen(rest));
+
+        if ((event->target.binding == NULL) || (event->target.binding->type == BRIDGE_TYPE_NONE))
+            return true;
+
+        if (!scenario_grow((void**) &gScenarioValues, &gScenarioValueCapacity, gScenarioValueCount + 1, sizeof(ScenarioValue)) ||
+                !parse_text_value(event->target.binding, eq + 1, &value) ||
+                !scenario_store_value(&value, &gScenarioValues[gScenarioValueCount]))
+            return false;
+
+        event->value = (uint32_t) gScenarioValueCount++;
+        *resolved = true;
+    }
+
+    if (*resolved)
+        gScenarioEventCount++;
+
+    return true;
+}
+
+static int
+compare_scenario_events(const void* a, const void* b)
+{
+    const ScenarioEvent* x = (const ScenarioEvent*) a;
+    const ScenarioEvent* y = (const ScenarioEvent*) b;
+
+    if (x->atNs != y->atNs)
+        return (x->atNs > y->atNs) ? 1 : -1;
+
+    return (x->line > y->line) - (x->line < y->line);
+}
+
+static void
+scenario_destroy(void)
+{
+    if (gScenarioTimerFd != -1)
+        close(gScenarioTimerFd);
+
+    free(gScenarioEvents);
+    free(gScenarioValues);
+    free(gScenarioStrings);
+    gScenarioEvents = NULL;
+    gScenarioValues = NULL;
+    gScenarioStrings = NULL;
+    gScenarioEventCount = 0;
+    gScenarioTimerFd = -1;
+}
+
+static bool
+scenario_setup(void)
+{
+    const char* file = getenv("IEC_SCENARIO");
+
+    if ((file == NULL) || (*file == 0))
+        return true;
+
+    FILE* in = fopen(file, "r");
+
+    if (in == NULL) {
+        fprintf(stderr, "Failed to open scenario %s: %s\n", file, strerror(errno));
+        return false;
+    }
+
+    uint64_t startNs = monotonic_ns();
+    char* line = NULL;
+    size_t lineSize = 0;
+    uint32_t lineNo = 0;
+    int skipped = 0;
+    bool ok = true;
+
+    while (ok && (getline(&line, &lineSize, in) != -1)) {
+        bool resolved;
+
+        lineNo++;
+        line[strcspn(line, "\r\n")] = 0;
+
+        if ((line[0] == 0) || (line[0] == '#'))
+            continue;
+
+        ok = scenario_parse_line(line, lineNo, &resolved);
+
+        if (!ok)
+            fprintf(stderr, "%s:%u: malformed scenario line\n", file, lineNo);
+        else if (!resolved)
+            skipped++;
+    }
+
+    free(line);
+    fclose(in);
+
+    gScenarioTimerFd = ok ? timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC) : -1;
+
+    if (!ok || (gScenarioTimerFd == -1)) {
+        scenario_destroy();
+        return false;
+    }
+
+    qsort(gScenarioEvents, (size_t) gScenarioEventCount, sizeof(ScenarioEvent), compare_scenario_events);
+
+    const char* passes = getenv("IEC_SCENARIO_PASSES");
+
+    gScenarioPasses = passes ? atoi(passes) : 1;
+
+    if (gScenarioPasses < 1)
+        gScenarioPasses = 1;
+
+    printf("Scenario %s: %d events over %.1f s compiled in %.1f ms (%d lines with unknown references skipped)\n", file,
+            gScenarioEventCount, gScenarioEventCount ? (double) gScenarioEvents[gScenarioEventCount - 1].atNs / 1e9 : 0.0,
+            (double) (monotonic_ns() - startNs) / 1e6, skipped);
+
+    return true;
+}
+
+/* Arms the timer for the next event or expectation deadline, whichever comes first */
+static void
+scenario_arm(void)
+{
+    uint64_t nextNs = UINT64_MAX;
+    struct itimerspec next;
+
+    if (gScenarioNext < gScenarioEventCount)
+        nextNs = gScenarioStartNs + gScenarioEvents[gScenarioNext].atNs;
+
+    for (int i = 0; i < gScenarioExpectationCount; i++) {
+        if (gScenarioExpectations[i].deadlineNs < nextNs)
+            nextNs = gScenarioExpectations[i].deadlineNs;
+    }
+
+    memset(&next, 0, sizeof(next));
+
+    // Zero disarms, so an instant already past is bumped to 1 ns
+    if (nextNs != UINT64_MAX) {
+        next.it_value.tv_sec = (time_t) (nextNs / 1000000000ull);
+        next.it_value.tv_nsec = (long) (nextNs % 1000000000ull);
+
+        if ((next.it_value.tv_sec == 0) && (next.it_value.tv_nsec == 0))
+            next.it_value.tv_nsec = 1;
+    }
+
+    timerfd_settime(gScenarioTimerFd, TFD_TIMER_ABSTIME, &next, NULL);
+}
+
+static void
+scenario_start(void)
+{
+    if (gScenarioTimerFd == -1)
+        return;
+
+    const char* delay = getenv("IEC_SCENARIO_DELAY_MS");
+    int delayMs = delay ? atoi(delay) : 1000;
+
+    if (delayMs < 0)
+        delayMs = 0;
+
+    gScenarioStartNs = monotonic_ns() + (uint64_t) delayMs * 1000000ull;
+    gScenarioStartMs = Hal_getTimeInMs() + (uint64_t) delayMs;
+    scenario_arm();
+}
+
+static void
+scenario_expect(const ScenarioEvent* event, uint64_t sinceNs)
+{
+    ControlBinding* control = event->target.control;
+
+    gScenarioExpected++;
+
+    if ((gScenarioExpectationCount == SCENARIO_MAX_EXPECTATIONS) || atomic_load(&control->expectedSinceNs)) {
+        gScenarioMissed++;
+        bridge_log_status("SCENARIO_MISS line=%u %s already expected or too many expectations", event->line, control->reference);
+        return;
+    }
+
+    ScenarioExpectation* expectation = &gScenarioExpectations[gScenarioExpectationCount++];
+
+    expectation->control = control;
+    expectation->sinceNs = sinceNs;
+    expectation->deadlineNs = sinceNs + (uint64_t) event->value * 1000000ull;
+    expectation->line = event->line;
+
+    atomic_store(&control->operatedNs, 0);
+    atomic_store_explicit(&control->expectedSinceNs, sinceNs, memory_order_release);
+}
+
+static void
+scenario_check_expectations(uint64_t nowNs)
+{
+    int kept = 0;
 
-static ControlBinding* gBindings = NULL;
-static int gBindingCount = 0;
+    for (int i = 0; i < gScenarioExpectationCount; i++) {
+        ScenarioExpectation* expectation = &gScenarioExpectations[i];
+        uint64_t operatedNs = atomic_load(&expectation->control->operatedNs);
 
-static CheckHandlerResult
-perform_check_handler(ControlAction action, void* parameter, MmsValue* ctlVal, bool test, bool interlockCheck)
+        if ((operatedNs != 0) && (operatedNs <= expectation->deadlineNs)) {
+            gScenarioMet++;
+            metrics_record(&tMetrics->scenarioControlNs, operatedNs - expectation->sinceNs);
+        }
+        else if (nowNs >= expectation->deadlineNs) {
+            gScenarioMissed++;
+            bridge_log_status("SCENARIO_MISS line=%u %s not operated within %llu ms", expectation->line, expectation->control->reference,
+                    (unsigned long long) ((expectation->deadlineNs - expectation->sinceNs) / 1000000ull));
+        }
+        else {
+            gScenarioExpectations[kept++] = *expectation;
+            continue;
+        }
+
+        atomic_store(&expectation->control->expectedSinceNs, 0);
+    }
+
+    gScenarioExpectationCount = kept;
+}
+
+static void
+scenario_report_pass(void)
 {
-    (void) action;
-    (void) parameter;
-    (void) ctlVal;
-    (void) test;
-    (void) interlockCheck;
-    return CONTROL_ACCEPTED;
+    uint64_t late[METRICS_HIST_BUCKETS], control[METRICS_HIST_BUCKETS];
+    uint64_t lateCount, lateMax, controlCount, controlMax;
+
+    metrics_merge(offsetof(MetricsShard, scenarioLateNs), late, &lateCount, &lateMax);
+    metrics_merge(offsetof(MetricsShard, scenarioControlNs), control, &controlCount, &controlMax);
+
+    bridge_log_status("SCENARIO pass=%d passes=%d events=%llu late_p50_us=%llu late_p99_us=%llu late_max_us=%llu expected=%llu "
+            "met=%llu missed=%llu control_p50_us=%llu control_p99_us=%llu control_max_us=%llu",
+            gScenarioPass + 1, gScenarioPasses, (unsigned long long) lateCount,
+            (unsigned long long) metrics_percentile_us(late, lateCount, lateMax, 50),
+            (unsigned long long) metrics_percentile_us(late, lateCount, lateMax, 99), (unsigned long long) (lateMax / 1000),
+            (unsigned long long) gScenarioExpected, (unsigned long long) gScenarioMet, (unsigned long long) gScenarioMissed,
+            (unsigned long long) metrics_percentile_us(control, controlCount, controlMax, 50),
+            (unsigned long long) metrics_percentile_us(control, controlCount, controlMax, 99),
+            (unsigned long long) (controlMax / 1000));
 }
 
-static ControlHandlerResult
-generic_control_handler(ControlAction action, void* parameter, MmsValue* ctlVal, bool test)
+static void
+scenario_tick(void)
 {
-    ControlBinding* binding = (ControlBinding*) parameter;
+    uint64_t expirations;
 
-    if (binding == NULL)
-        return CONTROL_RESULT_FAILED;
+    if (read(gScenarioTimerFd, &expirations, sizeof(expirations)) != sizeof(expirations))
+        return;
 
-    if (test)
-        return CONTROL_RESULT_OK;
+    uint64_t nowNs = monotonic_ns();
+    int first = gScenarioNext;
 
-    if (ControlAction_isSelect(action))
-        return CONTROL_RESULT_OK;
+    gInputArrivalNs = nowNs;
 
-    if (binding->stValAttr)
-        IedServer_updateAttributeValue(gIedServer, binding->stValAttr, ctlVal);
+    while ((gScenarioNext < gScenarioEventCount) && (gScenarioStartNs + gScenarioEvents[gScenarioNext].atNs <= nowNs)) {
+        const ScenarioEvent* event = &gScenarioEvents[gScenarioNext++];
+        uint64_t timestampMs = gScenarioStartMs + event->atNs / 1000000ull;
 
-    if (binding->tAttr)
-        IedServer_updateUTCTimeAttributeValue(gIedServer, binding->tAttr, Hal_getTimeInMs());
+        switch (event->type) {
+        case SCENARIO_UPDATE:
+            scenario_load_value(&gScenarioValues[event->value], stage_update(event->target.binding, timestampMs));
+            break;
+        case SCENARIO_DATASET:
+            for (int m = 0; m < event->target.dataSet->memberCount; m++)
+                scenario_load_value(&gScenarioValues[event->value + m], &gDataSetValues[m]);
+            stage_data_set(event->target.dataSet, timestampMs);
+            break;
+        case SCENARIO_EXPECT:
+            scenario_expect(event, gScenarioStartNs + event->atNs);
+            break;
+        }
+    }
 
-    printf("CONTROL_UPDATE %s\n", binding->reference);
-    fflush(stdout);
+    // Inside a BEGIN/COMMIT of the relay the events join its batch
+    if (!gInTransaction)
+        commit_staged_updates();
 
-    return CONTROL_RESULT_OK;
+    uint64_t doneNs = monotonic_ns();
+
+    for (int i = first; i < gScenarioNext; i++) {
+        if (gScenarioEvents[i].type != SCENARIO_EXPECT)
+            metrics_record(&tMetrics->scenarioLateNs, doneNs - (gScenarioStartNs + gScenarioEvents[i].atNs));
+    }
+
+    scenario_check_expectations(doneNs);
+
+    if ((gScenarioNext == gScenarioEventCount) && (gScenarioExpectationCount == 0) && (gScenarioPass < gScenarioPasses)) {
+        scenario_report_pass();
+
+        if (++gScenarioPass < gScenarioPasses) {
+            gScenarioNext = 0;
+            gScenarioStartNs = doneNs;
+            gScenarioStartMs = Hal_getTimeInMs();
+        }
+    }
+
+    if (gScenarioPass < gScenarioPasses)
+        scenario_arm();
 }
 
-static void
-register_control_binding(ModelNode* node)
+// --- Main Loop ---
+
+/*
+ * MMS connections of every hosted IED and the stdin bridge are serviced by
+ * one thread, with libiec61850 in threadless mode. The stack keeps its
+ * sockets private, so the loop cannot add them to the epoll set. Instead it
+ * alternates a bounded IedServer_waitReady() with a non-blocking epoll check
+ * of stdin, a signalfd and the timers. So that the wait does not hold back
+ * whatever arrives meanwhile, a wake thread watches the epoll set itself
+ * and, while the main thread is inside IedServer_waitReady(), sends it
+ * BRIDGE_WAKE_SIGNAL: its empty handler makes the stack's poll() return
+ * EINTR, and the loop services the input right away. The signal is repeated
+ * every BRIDGE_WAKE_RETRY_US until the wait has ended, in case it landed
+ * just before the stack entered poll(). When workers serve the IEDs the
+ * loop only dispatches and blocks in epoll until input, a tick or a signal
+ * arrives.
+ */
+
+#define BRIDGE_WAKE_SIGNAL SIGUSR1
+#define BRIDGE_WAKE_RETRY_US 50
+
+static pthread_t gMainThread;
+static pthread_t gWakeThread;
+static int gWakeEpollFd = -1;
+static int gWakeStopFd = -1;
+static atomic_bool gMmsWaiting = false;
+
+static int
+open_signal_fd(void)
 {
-    ModelNode* oper = ModelNode_getChildWithFc(node, "Oper", IEC61850_FC_CO);
-    ModelNode* stVal = ModelNode_getChildWithFc(node, "stVal", IEC61850_FC_ST);
-    ModelNode* t = ModelNode_getChildWithFc(node, "t", IEC61850_FC_ST);
+    sigset_t mask;
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
 
-    if (oper == NULL)
-        oper = ModelNode_getChild(node, "Oper");
+    // Blocked before any thread is created so every thread inherits the mask
+    if (sigprocmask(SIG_BLOCK, &mask, NULL) == -1)
+        return -1;
 
-    if (stVal == NULL)
-        stVal = ModelNode_getChild(node, "stVal");
+    return signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+}
 
-    if (t == NULL)
-        t = ModelNode_getChild(node, "t");
+static int
+open_event_loop(int signalFd)
+{
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
 
-    if ((oper == NULL) || (stVal == NULL))
-        return;
+    if (epollFd == -1)
+        return -1;
 
-    gBindings = (ControlBinding*) realloc(gBindings, sizeof(ControlBinding) * (gBindingCount + 1));
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
 
-    if (gBindings == NULL) {
-        gBindingCount = 0;
-        return;
+    event.data.fd = signalFd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, signalFd, &event) == -1) {
+        close(epollFd);
+        return -1;
     }
 
-    ControlBinding* binding = &gBindings[gBindingCount++];
-    binding->controlDo = (DataObject*) node;
-    binding->stValAttr = (DataAttribute*) stVal;
-    binding->tAttr = (DataAttribute*) t;
+    int flags = fcntl(STDIN_FILENO, F_GETFL);
+
+    event.data.fd = STDIN_FILENO;
+    if ((flags == -1) || (fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK) == -1) ||
+            (epoll_ctl(epollFd, EPOLL_CTL_ADD, STDIN_FILENO, &event) == -1))
+        fprintf(stderr, "Bridge input unavailable, serving MMS only\n");
 
-    char* ref = ModelNode_getObjectReference(node, NULL);
-    if (ref) {
-        strncpy(binding->reference, ref, sizeof(binding->reference) - 1);
-        binding->reference[sizeof(binding->reference) - 1] = '\0';
-        free(ref);
+    event.data.fd = gShmTimerFd;
+    if ((gShmTimerFd != -1) && (epoll_ctl(epollFd, EPOLL_CTL_ADD, gShmTimerFd, &event) == -1)) {
+        close(epollFd);
+        return -1;
     }
-    else {
-        strncpy(binding->reference, ModelNode_getName(node), sizeof(binding->reference) - 1);
-        binding->reference[sizeof(binding->reference) - 1] = '\0';
+
+    event.data.fd = gSnapshotTimerFd;
+    if ((gSnapshotTimerFd != -1) && (epoll_ctl(epollFd, EPOLL_CTL_ADD, gSnapshotTimerFd, &event) == -1)) {
+        close(epollFd);
+        return -1;
     }
 
-    IedServer_setPerformCheckHandler(gIedServer, binding->controlDo, perform_check_handler, binding);
-    IedServer_setControlHandler(gIedServer, binding->controlDo, generic_control_handler, binding);
+    event.data.fd = gScenarioTimerFd;
+    if ((gScenarioTimerFd != -1) && (epoll_ctl(epollFd, EPOLL_CTL_ADD, gScenarioTimerFd, &event) == -1)) {
+        close(epollFd);
+        return -1;
+    }
 
-    printf("Registered control handler for %s\n", binding->reference);
+    return epollFd;
 }
 
 static void
-traverse_and_register(ModelNode* node)
+wake_signal_handler(int signal)
 {
-    if (node == NULL)
-        return;
+    (void) signal;
+}
+
+static void*
+wake_thread(void* parameter)
+{
+    struct epoll_event event;
 
-    if (ModelNode_getType(node) == DataObjectModelType)
-        register_control_binding(node);
+    (void) parameter;
 
-    ModelNode* child = node->firstChild;
-    while (child) {
-        traverse_and_register(child);
-        child = child->sibling;
+    for (;;) {
+        if (epoll_wait(gWakeEpollFd, &event, 1, -1) != 1)
+            continue;
+
+        if (event.data.fd == gWakeStopFd)
+            return NULL;
+
+        while (atomic_load(&gMmsWaiting)) {
+            struct timespec retry = { 0, BRIDGE_WAKE_RETRY_US * 1000 };
+
+            pthread_kill(gMainThread, BRIDGE_WAKE_SIGNAL);
+            nanosleep(&retry, NULL);
+        }
     }
 }
 
+/* Only the threadless loop waits in the stack; with workers the main loop blocks in epoll */
 static void
-register_all_control_handlers(IedModel* model)
+start_wake_thread(int epollFd)
 {
-    int ldCount = IedModel_getLogicalDeviceCount(model);
+    struct sigaction action;
+    struct epoll_event event;
 
-    for (int i = 0; i < ldCount; i++) {
-        ModelNode* ld = (ModelNode*) IedModel_getDeviceByIndex(model, i);
-        traverse_and_register(ld);
+    if (gWorkerCount > 0)
+        return;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = wake_signal_handler;
+    action.sa_flags = SA_RESTART; /* poll() is never restarted, blocking stdio calls are */
+    sigemptyset(&action.sa_mask);
+
+    gMainThread = pthread_self();
+    gWakeEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    gWakeStopFd = eventfd(0, EFD_CLOEXEC);
+
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = gWakeStopFd;
+
+    bool ok = (gWakeEpollFd != -1) && (gWakeStopFd != -1) && (sigaction(BRIDGE_WAKE_SIGNAL, &action, NULL) == 0) &&
+            (epoll_ctl(gWakeEpollFd, EPOLL_CTL_ADD, gWakeStopFd, &event) == 0);
+
+    // Armed one shot at a time, right before each wait
+    event.events = 0;
+    event.data.fd = epollFd;
+    ok = ok && (epoll_ctl(gWakeEpollFd, EPOLL_CTL_ADD, epollFd, &event) == 0) &&
+            (pthread_create(&gWakeThread, NULL, wake_thread, NULL) == 0);
+
+    if (!ok) {
+        fprintf(stderr, "Failed to start the wake thread, input waits for the MMS wait slice\n");
+
+        if (gWakeStopFd != -1)
+            close(gWakeStopFd);
+        if (gWakeEpollFd != -1)
+            close(gWakeEpollFd);
+
+        gWakeStopFd = -1;
+        gWakeEpollFd = -1;
     }
+}
+
+static void
+stop_wake_thread(void)
+{
+    uint64_t one = 1;
 
-    printf("Registered %d controllable data object handlers\n", gBindingCount);
+    if (gWakeEpollFd == -1)
+        return;
+
+    if (write(gWakeStopFd, &one, sizeof(one)) == sizeof(one))
+        pthread_join(gWakeThread, NULL);
+
+    close(gWakeStopFd);
+    close(gWakeEpollFd);
+    gWakeStopFd = -1;
+    gWakeEpollFd = -1;
 }
 
-// --- Bridge Logic ---
+/* IedServer_waitReady() that returns early once anything in the epoll set is ready */
+static int
+wait_mms_ready(IedServer server, int epollFd, unsigned int waitMs)
+{
+    if ((waitMs == 0) || (gWakeEpollFd == -1))
+        return IedServer_waitReady(server, waitMs);
+
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLONESHOT;
+    event.data.fd = epollFd;
+
+    atomic_store(&gMmsWaiting, true);
+    epoll_ctl(gWakeEpollFd, EPOLL_CTL_MOD, epollFd, &event);
+
+    int ready = IedServer_waitReady(server, waitMs);
+
+    atomic_store(&gMmsWaiting, false);
+
+    return ready;
+}
 
 static void
-handle_bridge_update(const char* ref, const char* valStr)
+run_event_loop(int epollFd, int signalFd)
+{
+    struct epoll_event events[4];
+
+    while (running) {
+        int count = epoll_wait(epollFd, events, 4, (gWorkerCount > 0) ? -1 : 0);
+
+        for (int i = 0; i < count; i++) {
+            if (events[i].data.fd == signalFd) {
+                struct signalfd_siginfo info;
+
+                while (read(signalFd, &info, sizeof(info)) == sizeof(info))
+                    running = 0;
+            }
+            else if (events[i].data.fd == STDIN_FILENO) {
+                // The backend keeps serving MMS after the relay closes its end
+                if (!bridge_read_input())
+                    epoll_ctl(epollFd, EPOLL_CTL_DEL, STDIN_FILENO, NULL);
+            }
+            else if (events[i].data.fd == gShmTimerFd) {
+                shm_scan();
+            }
+            else if (events[i].data.fd == gSnapshotTimerFd) {
+                snapshot_tick();
+            }
+            else if (events[i].data.fd == gScenarioTimerFd) {
+                scenario_tick();
+            }
+        }
+
+        if (!running || (gWorkerCount > 0))
+            continue;
+
+        // Only the last server waits, and only if none of the others had input
+        bool busy = false;
+
+        for (int i = 0; i < gIedCount; i++) {
+            IedServer server = gIeds[i].server;
+            unsigned int waitMs = (!busy && (i == gIedCount - 1)) ? BRIDGE_MMS_WAIT_MS : 0;
+
+            if (wait_mms_ready(server, epollFd, waitMs) > 0) {
+                IedServer_processIncomingData(server);
+                busy = true;
+            }
+
+            IedServer_performPeriodicTasks(server);
+        }
+    }
+}
+
+// --- Report Buffers ---
+
+/*
+ * libiec61850 gives every RCB a fixed report buffer when the IedServer is
+ * created and never grows it: a BRCB keeps reports for a disconnected
+ * client in it, a URCB holds the reports it has built until they are sent.
+ * The library takes one size for all BRCBs and one for all URCBs of a
+ * server, so each is sized for the most demanding RCB of its kind:
+ *
+ *   entry    = ~64 bytes header + per member (BER value + reason) for the
+ *              whole data set, the worst case when every member changes;
+ *              strings count with the maximum length of their declared
+ *              type (VisString255 etc.), not the length they start with
+ *   reports  = min(update rate, 1000 / bufTime) + 1000 / intgPd per second
+ *   capacity = entry * reports * window
+ *
+ * The window is IEC_REPORT_OUTAGE_S (default 10 s) for BRCBs, the outage a
+ * client may sit out without losing reports, and one second for URCBs.
+ * IEC_REPORT_UPDATE_RATE (default 10) is the expected number of data set
+ * changes per second. Overflows and purges show up in the metrics. Since
+ * the size is per server, RCBs with small data sets get the room of the
+ * largest one; libiec61850 offers no per-RCB size.
+ */
+
+#define REPORT_ENTRY_OVERHEAD 64
+#define REPORT_BUFFER_MIN (64 * 1024) /* libiec61850's own default, never undercut */
+#define REPORT_BUFFER_MAX (64 * 1024 * 1024)
+
+/* Longest BER encoding of a string attribute of declared type `type`, 0 for other types */
+static int
+declared_string_size(DataAttributeType type)
 {
-    if (!gIedServer) return;
+    int length;
 
-    DataAttribute* attr = (DataAttribute*) IedModel_getModelNodeByObjectReference(&iedModel, ref);
-    if (!attr) {
-        // Try appending .stVal if not present, common abbreviation
-        char buf[256];
-        snprintf(buf, sizeof(buf), "%s.stVal", ref);
-        attr = (DataAttribute*) IedModel_getModelNodeByObjectReference(&iedModel, buf);
+    switch (type) {
+    case IEC61850_VISIBLE_STRING_32:
+        length = 32;
+        break;
+    case IEC61850_VISIBLE_STRING_64:
+    case IEC61850_OCTET_STRING_64:
+        length = 64;
+        break;
+    case IEC61850_VISIBLE_STRING_65:
+        length = 65;
+        break;
+    case IEC61850_VISIBLE_STRING_129:
+        length = 129;
+        break;
+    case IEC61850_VISIBLE_STRING_255:
+        length = 255;
+        break;
+    case IEC61850_UNICODE_STRING_255:
+        length = 255 * 4; /* UTF-8 */
+        break;
+    default:
+        return 0;
     }
 
-    if (!attr || ModelNode_getType((ModelNode*)attr) != DataAttributeModelType) {
-        if (running) {
-            printf("BRIDGE_ERR: Node not found or not attribute: %s\n", ref);
-            fflush(stdout);
+    // Tag and a definite length of one to three octets
+    return 1 + ((length < 128) ? 1 : (length < 256) ? 2 : 3) + length;
+}
+
+/* BER size of the members of `node` with constraint `fc`, as a data set entry sends them at most */
+static int
+encoded_member_size(ModelNode* node, FunctionalConstraint fc)
+{
+    if (node->modelType == DataAttributeModelType) {
+        DataAttribute* da = (DataAttribute*) node;
+
+        if ((fc != IEC61850_FC_NONE) && (da->fc != fc))
+            return 0;
+
+        if (da->mmsValue) {
+            int size = MmsValue_encodeMmsData(da->mmsValue, NULL, 0, false);
+            int declared = declared_string_size(da->type);
+
+            return (declared > size) ? declared : size;
         }
-        return;
     }
 
-    MmsValue* newVal = NULL;
-    // Type type = ModelNode_getType((ModelNode*)attr);
-    // basic Type (MmsType) check requires accessing mmsValue type
-    // We infer from MmsValue of the attribute if possible, or just try Types
-    
-    // For simplicity, we assume common types:
-    // BOOLEAN, INT32, FLOAT32
-    // We can check the node type directly if needed, but libiec61850 abstraction 
-    // usually requires getting the specific BasicType from the MmsValue container or DataAttribute spec via 
-    // DataAttribute_getType((DataAttribute*) node) -> but that returns complex MmsType enum
-    
-    // Let's rely on string parsing heuristics or check current value type
-    // MmsValue* current = IedServer_getAttributeValue(gIedServer, attr); // Not public API easily
-    // We will try to parse based on input format
-    
-    if (strcasecmp(valStr, "true") == 0 || strcasecmp(valStr, "false") == 0) {
-        newVal = MmsValue_newBoolean(strcasecmp(valStr, "true") == 0);
+    int size = 0;
+
+    for (ModelNode* child = node->firstChild; child; child = child->sibling)
+        size += encoded_member_size(child, fc);
+
+    // Structure tag and a length of up to three octets
+    return (size > 0) ? size + 4 : 0;
+}
+
+static int
+data_set_entry_size(IedModel* model, DataSetEntry* entry)
+{
+    FunctionalConstraint fc;
+    ModelNode* node = resolve_data_set_entry(model, entry, &fc);
+
+    return node ? encoded_member_size(node, fc) : 0;
+}
+
+static DataSet*
+find_rcb_data_set(IedModel* model, ReportControlBlock* rcb)
+{
+    LogicalNode* ln = rcb->parent;
+    LogicalDevice* ld = (LogicalDevice*) ln->parent;
+
+    if (rcb->dataSetName == NULL)
+        return NULL;
+
+    for (DataSet* ds = model->dataSets; ds; ds = ds->sibling) {
+        size_t lnLen = strlen(ln->name);
+
+        if ((strcmp(ds->logicalDeviceName, ld->name) == 0) && (strncmp(ds->name, ln->name, lnLen) == 0) &&
+                (ds->name[lnLen] == '$') && (strcmp(ds->name + lnLen + 1, rcb->dataSetName) == 0))
+            return ds;
+    }
+
+    return NULL;
+}
+
+static double
+env_positive(const char* name, double fallback)
+{
+    const char* text = getenv(name);
+    double value = text ? atof(text) : 0;
+
+    return (value > 0) ? value : fallback;
+}
+
+static int
+report_buffer_size(IedModel* model, bool buffered, double updateRate, double windowSeconds)
+{
+    double needed = 0;
+
+    for (ReportControlBlock* rcb = model->rcbs; rcb; rcb = rcb->sibling) {
+        DataSet* ds = (rcb->buffered == buffered) ? find_rcb_data_set(model, rcb) : NULL;
+
+        if (ds == NULL)
+            continue;
+
+        int entrySize = REPORT_ENTRY_OVERHEAD + (ds->elementCount + 7) / 8;
+
+        for (DataSetEntry* entry = ds->fcdas; entry; entry = entry->sibling)
+            entrySize += data_set_entry_size(model, entry) + 1;
+
+        double reportsPerSecond = updateRate;
+
+        if ((rcb->bufferTime > 0) && (1000.0 / rcb->bufferTime < reportsPerSecond))
+            reportsPerSecond = 1000.0 / rcb->bufferTime;
+
+        if (rcb->intPeriod > 0)
+            reportsPerSecond += 1000.0 / rcb->intPeriod;
+
+        // Room for at least a few complete entries whatever the rate
+        double capacity = entrySize * ((reportsPerSecond * windowSeconds > 4) ? reportsPerSecond * windowSeconds : 4);
+
+        if (capacity > needed)
+            needed = capacity;
     }
-    else if (strchr(valStr, '.')) {
-        newVal = MmsValue_newFloat(strtof(valStr, NULL));
+
+    if (needed == 0)
+        return 0;
+
+    if (needed < REPORT_BUFFER_MIN)
+        return REPORT_BUFFER_MIN;
+
+    return (needed > REPORT_BUFFER_MAX) ? REPORT_BUFFER_MAX : (int) needed;
+}
+
+/* Server configuration with report buffers sized for `model`; destroyed by the caller */
+static IedServerConfig
+create_server_config(IedModel* model)
+{
+    double updateRate = env_positive("IEC_REPORT_UPDATE_RATE", 10);
+    double outageSeconds = env_positive("IEC_REPORT_OUTAGE_S", 10);
+    int brcbSize = report_buffer_size(model, true, updateRate, outageSeconds);
+    int urcbSize = report_buffer_size(model, false, updateRate, 1);
+    IedServerConfig config = IedServerConfig_create();
+
+    if (brcbSize > 0)
+        IedServerConfig_setReportBufferSize(config, brcbSize);
+
+    if (urcbSize > 0)
+        IedServerConfig_setReportBufferSizeForURCBs(config, urcbSize);
+
+    printf("Report buffers for %s: BRCB %d bytes (%.0f s outage), URCB %d bytes, at %.0f changes/s\n", model->name,
+            brcbSize, outageSeconds, urcbSize, updateRate);
+
+    return config;
+}
+
+// --------------------
+
+/*
+ * Hosted IEDs are given as "model.cfg[@[ip:]port]" specs, as arguments
+ * after the port or comma-separated in IEC_MODEL_CONFIG. IEDs without a
+ * port take consecutive ports from the base port. Without any spec the
+ * compiled-in model is served on the base port.
+ */
+
+static bool
+add_hosted_ied(char* spec, int defaultPort)
+{
+    if (gIedCount == BRIDGE_MAX_IEDS) {
+        fprintf(stderr, "At most %d IEDs can be hosted\n", BRIDGE_MAX_IEDS);
+        return false;
     }
-    else {
-        newVal = MmsValue_newIntegerFromInt32(atoi(valStr));
-    }
-
-    if (newVal) {
-        IedServer_updateAttributeValue(gIedServer, attr, newVal);
-        
-        // Also update timestamp 't' if it exists in the same DO
-        ModelNode* parent = ModelNode_getParent((ModelNode*)attr);
-        if (parent) {
-            ModelNode* tNode = ModelNode_getChild(parent, "t");
-            if (tNode) {
-                IedServer_updateUTCTimeAttributeValue(gIedServer, (DataAttribute*)tNode, Hal_getTimeInMs());
-            }
+
+    HostedIed* ied = &gIeds[gIedCount];
+    char* at = strrchr(spec, '@');
+
+    memset(ied, 0, sizeof(*ied));
+    ied->port = defaultPort;
+
+    if (at) {
+        *at = 0;
+        char* portText = strrchr(at + 1, ':');
+
+        if (portText) {
+            *portText = 0;
+            ied->ipAddress = at + 1;
+            portText++;
         }
-        
-        MmsValue_delete(newVal);
-        if (running) {
-            printf("BRIDGE_OK: Updated %s = %s\n", ref, valStr);
-            fflush(stdout);
+        else {
+            portText = at + 1;
+        }
+
+        ied->port = atoi(portText);
+    }
+
+    ied->modelFile = spec;
+    ied->model = ConfigFileParser_createModelFromConfigFileEx(spec);
+
+    if (ied->model == NULL) {
+        fprintf(stderr, "Failed to load model config %s\n", spec);
+        return false;
+    }
+
+    for (int i = 0; i < gIedCount; i++) {
+        if (strcmp(gIeds[i].model->name, ied->model->name) == 0) {
+            fprintf(stderr, "IED %s is configured twice (%s, %s)\n", ied->model->name, gIeds[i].modelFile, spec);
+            IedModel_destroy(ied->model);
+            return false;
         }
     }
+
+    printf("Loaded model %s from %s\n", ied->model->name, spec);
+
+    gIedCount++;
+
+    return true;
 }
 
-static void*
-stdin_reader_thread(void* arg)
+static bool
+load_hosted_ieds(int argc, char** argv, int basePort)
 {
-    (void) arg;
-    char line[1024];
-    while (running && fgets(line, sizeof(line), stdin)) {
-        // Trim newline
-        line[strcspn(line, "\r\n")] = 0;
-        
-        if (strlen(line) == 0) continue;
+    for (int i = 2; i < argc; i++) {
+        if (!add_hosted_ied(argv[i], basePort + gIedCount))
+            return false;
+    }
 
-        // Message format: "REF=VALUE"
-        char* eq = strchr(line, '=');
-        if (eq) {
-            *eq = 0;
-            const char* ref = line;
-            const char* val = eq + 1;
-            handle_bridge_update(ref, val);
+    const char* list = getenv("IEC_MODEL_CONFIG");
+
+    if ((argc <= 2) && list && *list) {
+        // Specs must outlive the servers, so the copy is never freed
+        char* specs = strdup(list);
+        char* save = NULL;
+
+        for (char* spec = strtok_r(specs, ",", &save); spec; spec = strtok_r(NULL, ",", &save)) {
+            if (!add_hosted_ied(spec, basePort + gIedCount))
+                return false;
         }
     }
-    return NULL;
+
+    if (gIedCount == 0) {
+        gIeds[0].model = &iedModel;
+        gIeds[0].port = basePort;
+        gIedCount = 1;
+    }
+
+    for (int i = 0; i < gIedCount; i++) {
+        IedServerConfig config = create_server_config(gIeds[i].model);
+
+        gIeds[i].server = IedServer_createWithConfig(gIeds[i].model, NULL, config);
+        IedServerConfig_destroy(config);
+
+        if (gIeds[i].server == NULL) {
+            fprintf(stderr, "Failed to create IEC 61850 server for %s\n", gIeds[i].model->name);
+            return false;
+        }
+    }
+
+    return true;
 }
 
-// --------------------
+static int
+goose_control_block_count(IedModel* model)
+{
+    int count = 0;
+
+    for (GSEControlBlock* gcb = model->gseCBs; gcb; gcb = gcb->sibling)
+        count++;
+
+    return count;
+}
+
+static bool
+start_hosted_ieds(void)
+{
+    const char* gooseInterface = getenv("IEC_GOOSE_INTERFACE");
+
+    if (gooseInterface && (*gooseInterface == 0))
+        gooseInterface = NULL;
 
+    for (int i = 0; i < gIedCount; i++) {
+        HostedIed* ied = &gIeds[i];
+
+        if (ied->ipAddress)
+            IedServer_setLocalIpAddress(ied->server, ied->ipAddress);
+
+        if (gooseInterface)
+            IedServer_setGooseInterfaceId(ied->server, gooseInterface);
+
+        IedServer_startThreadless(ied->server, ied->port);
+
+        if (!IedServer_isRunning(ied->server)) {
+            fprintf(stderr, "Failed to start IEC 61850 server for %s on %s:%d\n", ied->model->name,
+                    ied->ipAddress ? ied->ipAddress : "*", ied->port);
+            return false;
+        }
+
+        if (gIedCount > 1)
+            printf("Hosting IED %s on %s:%d\n", ied->model->name, ied->ipAddress ? ied->ipAddress : "*", ied->port);
+
+        if (gooseInterface) {
+            IedServer_enableGoosePublishing(ied->server);
+            printf("GOOSE publishing %d control block(s) of %s on %s\n", goose_control_block_count(ied->model),
+                    ied->model->name, gooseInterface);
+        }
+    }
+
+    return true;
+}
+
+/* Only models loaded from a config file are owned by the backend */
 static void
-sigint_handler(int signalId)
+destroy_hosted_ieds(void)
 {
-    (void) signalId;
-    running = 0;
+    for (int i = 0; i < gIedCount; i++) {
+        HostedIed* ied = &gIeds[i];
+
+        if (ied->server) {
+            if (IedServer_isRunning(ied->server))
+                IedServer_stopThreadless(ied->server);
+
+            IedServer_destroy(ied->server);
+        }
+
+        if (ied->model && (ied->model != &iedModel))
+            IedModel_destroy(ied->model);
+    }
+
+    gIedCount = 0;
 }
 
 int
@@ -245,43 +6411,79 @@ main(int argc, char** argv)
     if (argc > 1)
         tcpPort = atoi(argv[1]);
 
-    signal(SIGINT, sigint_handler);
+    int signalFd = open_signal_fd();
 
-    IedServer iedServer = IedServer_create(&iedModel);
-    gIedServer = iedServer;
+    if (signalFd == -1) {
+        fprintf(stderr, "Failed to set up signal handling\n");
+        return 1;
+    }
 
-    if (iedServer == NULL) {
-        fprintf(stderr, "Failed to create IEC 61850 server\n");
+    if (!load_hosted_ieds(argc, argv, tcpPort) || !register_all_control_handlers() || !build_reference_index() ||
+            !build_data_set_index() || !create_workers() || !metrics_setup() || !client_reads_setup() || !shm_setup() ||
+            !snapshot_setup() || !scenario_setup() || !sv_setup() || !goose_setup()) {
+        destroy_hosted_ieds();
         return 1;
     }
 
-    register_all_control_handlers(&iedModel);
+    int epollFd = open_event_loop(signalFd);
 
-    // Start STDIN Interface Thread
-    Thread thread = Thread_create(stdin_reader_thread, NULL, false);
-    Thread_start(thread);
+    if (epollFd == -1) {
+        fprintf(stderr, "Failed to create event loop\n");
+        destroy_hosted_ieds();
+        return 1;
+    }
 
-    IedServer_start(iedServer, tcpPort);
+    bridge_log_start();
 
-    if (!IedServer_isRunning(iedServer)) {
-        fprintf(stderr, "Failed to start IEC 61850 server on port %d\n", tcpPort);
-        IedServer_destroy(iedServer);
+    if (!start_hosted_ieds()) {
+        bridge_log_stop();
+        free(gWorkers);
+        destroy_hosted_ieds();
+        close(epollFd);
+        close(signalFd);
         return 2;
     }
 
-    printf("IEC 61850 server started on port %d\n", tcpPort);
+    start_workers();
+    sv_start();
+    goose_start();
+    snapshot_start();
+
+    printf("BRIDGE_CAPS text binary batch metrics dataset credit%s%s\n", (gSvStreamCount > 0) ? " sv" : "", gShmBase ? " shm" : "");
+    printf("IEC 61850 server started on port %d\n", gIeds[0].port);
     fflush(stdout);
 
-    while (running) {
-        Thread_sleep(100);
-    }
+    scenario_start();
+    start_wake_thread(epollFd);
+
+    run_event_loop(epollFd, signalFd);
+
+    stop_wake_thread();
+
+    commit_staged_updates();
+    stop_workers();
+    sv_stop();
+    goose_stop();
+    snapshot_destroy();
 
-    IedServer_stop(iedServer);
-    IedServer_destroy(iedServer);
-    Thread_destroy(thread);
+    bridge_log_stop();
+    destroy_hosted_ieds();
 
-    if (gBindings)
-        free(gBindings);
+    close(epollFd);
+    close(signalFd);
+
+    free(gBindings);
+    free(gControlRefs);
+
+    free(gWorkers);
+    sv_destroy_streams();
+    goose_destroy_subscriptions();
+    metrics_destroy();
+    shm_destroy();
+    scenario_destroy();
+
+    free_data_set_index();
+    free_reference_index();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,376 @@
+/*
+ * Unit checks for the bridge decoding of dubgg_libiec_server.
+ *
+ *   dubgg_libiec_test
+ *
+ * Compiles the backend in (its main() renamed) and runs the text value
+ * parsers and the binary value decoding against fixed inputs, with no
+ * server or MMS client involved. The byte layouts and quality bits are the
+ * ones tests/iec-bridge.test.ts expects from the relay's encoder, so the
+ * two sides of the wire are held to the same values. The scan of the
+ * shared value table runs against a table in plain memory. Prints one line
+ * per failed check and a summary; exits non-zero if any check failed.
+ */
+
+#define main dubgg_server_main
+#include "dubgg_libiec_server.c"
+#undef main
+
+#include <locale.h>
+
+static int gChecks = 0;
+static int gFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        gChecks++; \
+        if (!(cond)) { \
+            gFailures++; \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+static bool
+real_is(const char* text, double expected)
+{
+    double value;
+
+    return parse_real_text(text, &value) && (value == expected);
+}
+
+static bool
+integer_is(const char* text, int64_t expected)
+{
+    int64_t value;
+
+    return parse_integer_text(text, &value) && (value == expected);
+}
+
+static bool
+quality_is(const char* text, uint32_t expected)
+{
+    uint32_t value;
+
+    return parse_quality_text(text, &value) && (value == expected);
+}
+
+static bool
+utc_is(const char* text, uint64_t expected)
+{
+    uint64_t value;
+
+    return parse_utc_text(text, &value) && (value == expected);
+}
+
+static void
+check_real_parser(void)
+{
+    double value;
+
+    CHECK(real_is("0", 0.0));
+    CHECK(real_is("1.5", 1.5));
+    CHECK(real_is("-230.25", -230.25));
+    CHECK(real_is("+.5", 0.5));
+    CHECK(real_is("5.", 5.0));
+    CHECK(real_is("1e3", 1000.0));
+    CHECK(real_is("2.5E-2", 0.025));
+    CHECK(real_is("000000000000000000000000001", 1.0));
+    CHECK(parse_real_text("12345678901234567890123", &value) && (fabs(value - 1.2345678901234568e22) < 1e7));
+    CHECK(parse_real_text("1e400", &value) && isinf(value));
+    CHECK(parse_real_text("1e-400", &value) && (value == 0.0));
+
+    CHECK(!parse_real_text("", &value));
+    CHECK(!parse_real_text("-", &value));
+    CHECK(!parse_real_text(".", &value));
+    CHECK(!parse_real_text("1,5", &value));
+    CHECK(!parse_real_text("1.5x", &value));
+    CHECK(!parse_real_text(" 1.5", &value));
+    CHECK(!parse_real_text("1e", &value));
+    CHECK(!parse_real_text("nan", &value));
+    CHECK(!parse_real_text("inf", &value));
+
+    // A decimal comma locale must not change anything
+    if (setlocale(LC_NUMERIC, "de_DE.UTF-8") || setlocale(LC_NUMERIC, "de_DE")) {
+        CHECK(real_is("1.5", 1.5));
+        CHECK(!parse_real_text("1,5", &value));
+        setlocale(LC_NUMERIC, "C");
+    }
+}
+
+static void
+check_integer_parser(void)
+{
+    int64_t value;
+    uint32_t bits;
+
+    CHECK(integer_is("0", 0));
+    CHECK(integer_is("-0", 0));
+    CHECK(integer_is("+42", 42));
+    CHECK(integer_is("9223372036854775807", INT64_MAX));
+    CHECK(integer_is("-9223372036854775808", INT64_MIN));
+
+    CHECK(!parse_integer_text("9223372036854775808", &value));
+    CHECK(!parse_integer_text("-9223372036854775809", &value));
+    CHECK(!parse_integer_text("18446744073709551616", &value));
+    CHECK(!parse_integer_text("99999999999999999999999", &value));
+    CHECK(!parse_integer_text("", &value));
+    CHECK(!parse_integer_text("+", &value));
+    CHECK(!parse_integer_text("1.0", &value));
+    CHECK(!parse_integer_text("12 ", &value));
+    CHECK(!parse_integer_text("0x10", &value));
+
+    CHECK(parse_bits_text("0x0040", &bits) && (bits == 0x40));
+    CHECK(parse_bits_text("0XfFfF", &bits) && (bits == 0xffff));
+    CHECK(parse_bits_text("4294967295", &bits) && (bits == UINT32_MAX));
+    CHECK(!parse_bits_text("4294967296", &bits));
+    CHECK(!parse_bits_text("0x100000000", &bits));
+    CHECK(!parse_bits_text("0x", &bits));
+    CHECK(!parse_bits_text("0x12g", &bits));
+    CHECK(!parse_bits_text("-1", &bits));
+}
+
+static void
+check_quality_parser(void)
+{
+    uint32_t bits;
+
+    // Same table as QUALITY_BITS in scripts/lib/iec-bridge.cjs
+    CHECK(quality_is("good", 0x0));
+    CHECK(quality_is("invalid", 0x2));
+    CHECK(quality_is("questionable", 0x3));
+    CHECK(quality_is("overflow", 0x4));
+    CHECK(quality_is("outofrange", 0x8));
+    CHECK(quality_is("badreference", 0x10));
+    CHECK(quality_is("oscillatory", 0x20));
+    CHECK(quality_is("failure", 0x40));
+    CHECK(quality_is("olddata", 0x80));
+    CHECK(quality_is("inconsistent", 0x100));
+    CHECK(quality_is("inaccurate", 0x200));
+    CHECK(quality_is("substituted", 0x400));
+    CHECK(quality_is("test", 0x800));
+    CHECK(quality_is("blocked", 0x1000));
+    CHECK(quality_is("derived", 0x2000));
+
+    CHECK(quality_is("Invalid|TEST", 0x802));
+    CHECK(quality_is("questionable|olddata", 0x83));
+    CHECK(quality_is("0x0802", 0x802));
+    CHECK(quality_is("2050", 0x802));
+
+    CHECK(!parse_quality_text("bogus", &bits));
+    CHECK(!parse_quality_text("invalid|bogus", &bits));
+    CHECK(!parse_quality_text("inval", &bits));
+    CHECK(!parse_quality_text("invalidx", &bits));
+    CHECK(!parse_quality_text("invalid,test", &bits));
+    CHECK(!parse_quality_text("", &bits));
+    CHECK(!parse_quality_text("invalid|", &bits));
+}
+
+static void
+check_dbpos_and_utc_parsers(void)
+{
+    uint32_t state;
+    uint64_t ms;
+
+    CHECK(parse_dbpos_text("intermediate", &state) && (state == 0));
+    CHECK(parse_dbpos_text("OFF", &state) && (state == 1));
+    CHECK(parse_dbpos_text("on", &state) && (state == 2));
+    CHECK(parse_dbpos_text("3", &state) && (state == 3));
+    CHECK(!parse_dbpos_text("4", &state));
+    CHECK(!parse_dbpos_text("-1", &state));
+    CHECK(!parse_dbpos_text("open", &state));
+
+    CHECK(utc_is("0", 0));
+    CHECK(utc_is("1714566600250", 1714566600250ull));
+    CHECK(utc_is("1970-01-01T00:00:00Z", 0));
+    CHECK(utc_is("2024-05-01T12:30:00.250Z", 1714566600250ull));
+    CHECK(utc_is("2024-05-01 12:30:00.25", 1714566600250ull));
+    CHECK(utc_is("2024-02-29T23:59:59.999Z", 1709251199999ull));
+    CHECK(utc_is("2000-03-01T00:00:00", 951868800000ull));
+
+    CHECK(!parse_utc_text("-5", &ms));
+    CHECK(!parse_utc_text("2024-13-01T00:00:00Z", &ms));
+    CHECK(!parse_utc_text("2024-05-00T00:00:00Z", &ms));
+    CHECK(!parse_utc_text("2024-05-01T24:00:00Z", &ms));
+    CHECK(!parse_utc_text("2024-05-01", &ms));
+    CHECK(!parse_utc_text("2024-5-01T00:00:00Z", &ms));
+    CHECK(!parse_utc_text("2024-05-01T00:00:00+02:00", &ms));
+    CHECK(!parse_utc_text("2024-05-01T00:00:00Zjunk", &ms));
+}
+
+static void
+check_text_values(void)
+{
+    DataAttribute quality = { .type = IEC61850_QUALITY };
+    DataAttribute int8 = { .type = IEC61850_INT8 };
+    DataAttribute int16u = { .type = IEC61850_INT16U };
+    AttributeBinding binding = { .attr = &quality, .type = BRIDGE_TYPE_BITSTRING };
+    BridgeValue value;
+
+    CHECK(parse_text_value(&binding, "invalid|test", &value) && (value.type == BRIDGE_TYPE_BITSTRING) && (value.v.uint32 == 0x802));
+    CHECK(!parse_text_value(&binding, "bogus", &value));
+
+    binding.attr = &int8;
+    binding.type = BRIDGE_TYPE_INT32;
+    CHECK(parse_text_value(&binding, "-128", &value) && (value.v.int32 == -128));
+    CHECK(!parse_text_value(&binding, "128", &value));
+    CHECK(!parse_text_value(&binding, "2147483648", &value));
+    CHECK(parse_text_value(&binding, "true", &value) && (value.type == BRIDGE_TYPE_INT32) && (value.v.int32 == 1));
+
+    binding.attr = &int16u;
+    binding.type = BRIDGE_TYPE_UINT32;
+    CHECK(parse_text_value(&binding, "65535", &value) && (value.v.uint32 == 65535));
+    CHECK(!parse_text_value(&binding, "65536", &value));
+    CHECK(!parse_text_value(&binding, "-1", &value));
+
+    binding.type = BRIDGE_TYPE_FLOAT;
+    CHECK(parse_text_value(&binding, "230.1", &value) && (value.v.float32 == 230.1f));
+    CHECK(parse_text_value(&binding, "FALSE", &value) && (value.type == BRIDGE_TYPE_FLOAT) && (value.v.float32 == 0.0f));
+    CHECK(!parse_text_value(&binding, "230,1", &value));
+
+    binding.type = BRIDGE_TYPE_STRING;
+    CHECK(parse_text_value(&binding, "true", &value) && (value.type == BRIDGE_TYPE_STRING) && (strcmp(value.str, "true") == 0));
+}
+
+/* Value bytes as encodeValue() in scripts/lib/iec-bridge.cjs writes them */
+static void
+check_binary_values(void)
+{
+    static const uint8_t float15[] = { 0x00, 0x00, 0xc0, 0x3f };
+    static const uint8_t int32m42[] = { 0xd6, 0xff, 0xff, 0xff };
+    static const uint8_t uint32max[] = { 0xff, 0xff, 0xff, 0xff };
+    static const uint8_t int64min[] = { 0, 0, 0, 0, 0, 0, 0, 0x80 };
+    static const uint8_t utc[] = { 0x3a, 0x16, 0x22, 0x34, 0x8f, 0x01, 0, 0 };
+    static const uint8_t text[] = { 'W', 0xc3, 0xa4, 'r', 'm', 'e' };
+    BridgeValue value;
+
+    CHECK(bridge_value_size(BRIDGE_TYPE_BOOLEAN) == 1);
+    CHECK(bridge_value_size(BRIDGE_TYPE_DBPOS) == 1);
+    CHECK(bridge_value_size(BRIDGE_TYPE_INT32) == 4);
+    CHECK(bridge_value_size(BRIDGE_TYPE_UINT32) == 4);
+    CHECK(bridge_value_size(BRIDGE_TYPE_FLOAT) == 4);
+    CHECK(bridge_value_size(BRIDGE_TYPE_BITSTRING) == 4);
+    CHECK(bridge_value_size(BRIDGE_TYPE_INT64) == 8);
+    CHECK(bridge_value_size(BRIDGE_TYPE_UTCTIME) == 8);
+    CHECK(bridge_value_size(BRIDGE_TYPE_STRING) == 0);
+    CHECK(bridge_value_size(BRIDGE_TYPE_NONE) == 0);
+
+    value.type = BRIDGE_TYPE_FLOAT;
+    decode_bridge_value(&value, float15, sizeof(float15));
+    CHECK(value.v.float32 == 1.5f);
+
+    value.type = BRIDGE_TYPE_INT32;
+    decode_bridge_value(&value, int32m42, sizeof(int32m42));
+    CHECK(value.v.int32 == -42);
+
+    value.type = BRIDGE_TYPE_UINT32;
+    decode_bridge_value(&value, uint32max, sizeof(uint32max));
+    CHECK(value.v.uint32 == UINT32_MAX);
+
+    value.type = BRIDGE_TYPE_INT64;
+    decode_bridge_value(&value, int64min, sizeof(int64min));
+    CHECK(value.v.int64 == INT64_MIN);
+
+    value.type = BRIDGE_TYPE_UTCTIME;
+    decode_bridge_value(&value, utc, sizeof(utc));
+    CHECK(value.v.timeMs == 1714566600250ull);
+
+    value.type = BRIDGE_TYPE_STRING;
+    decode_bridge_value(&value, text, sizeof(text));
+    CHECK(strcmp(value.str, "W\xc3\xa4rme") == 0);
+
+    value.type = BRIDGE_TYPE_DBPOS;
+    decode_bridge_value(&value, (const uint8_t*) "\x02", 1);
+    CHECK(value.v.uint32 == 2);
+}
+
+/* One slot write the way a table writer does it: seq odd, value, seq even, dirty */
+static void
+shm_write_float(ShmGroup* group, float value)
+{
+    uint32_t raw;
+
+    memcpy(&raw, &value, sizeof(raw));
+    atomic_fetch_add(&group->seq[0], 1);
+    group->value[0] = raw;
+    atomic_fetch_add(&group->seq[0], 1);
+}
+
+/* Runs one scan of group 0 and returns how many updates it staged, leaving them uncommitted */
+static int
+shm_scan_staged(float* value)
+{
+    gStagedCount = 0;
+    CHECK(shm_scan_group(0));
+
+    int staged = gStagedCount;
+
+    if (staged > 0)
+        *value = gStaged[0].value.v.float32;
+
+    gStagedCount = 0;
+
+    return staged;
+}
+
+static void
+check_shared_values(void)
+{
+    static ShmGroup group;
+    static ShmShadow shadow;
+    static _Atomic uint8_t current[1];
+    DataAttribute mag = { .type = IEC61850_FLOAT32 };
+    AttributeBinding binding = { .attr = &mag, .reference = "LD0/MMXU1.TotW.mag.f", .type = BRIDGE_TYPE_FLOAT };
+    float value = -1.0f;
+
+    gAttrBindings = &binding;
+    gAttrBindingCount = 1;
+    gShmGroups = &group;
+    gShmShadow = &shadow;
+    gShmCurrent = current;
+    gShmGroupCount = 1;
+    group.type[0] = BRIDGE_TYPE_FLOAT;
+
+    // The shadow starts at zero, but a first write of 0.0 still has to reach the model
+    shm_write_float(&group, 0.0f);
+    CHECK((shm_scan_staged(&value) == 1) && (value == 0.0f));
+
+    shm_write_float(&group, 3.0f);
+    CHECK((shm_scan_staged(&value) == 1) && (value == 3.0f));
+    shm_write_float(&group, 3.0f);
+    CHECK(shm_scan_staged(&value) == 0);
+
+    // A pipe update in between means the model no longer holds 3.0
+    stage_update(&binding, 0)->v.float32 = 7.0f;
+    gStagedCount = 0;
+    shm_write_float(&group, 3.0f);
+    CHECK((shm_scan_staged(&value) == 1) && (value == 3.0f));
+
+    // Values decode as the binding's type; a slot whose type byte was changed is refused
+    group.type[0] = BRIDGE_TYPE_INT64;
+    shm_write_float(&group, 5.0f);
+    CHECK(shm_scan_staged(&value) == 0);
+    group.type[0] = BRIDGE_TYPE_FLOAT;
+
+    gAttrBindings = NULL;
+    gAttrBindingCount = 0;
+    gShmGroups = NULL;
+    gShmShadow = NULL;
+    gShmCurrent = NULL;
+    gShmGroupCount = 0;
+}
+
+int
+main(void)
+{
+    check_real_parser();
+    check_integer_parser();
+    check_quality_parser();
+    check_dbpos_and_utc_parsers();
+    check_text_values();
+    check_binary_values();
+    check_shared_values();
+
+    printf("dubgg_libiec_test: %d checks, %d failed\n", gChecks, gFailures);
+
+    return (gFailures == 0) ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+// Builds the backend's GOOSE subscription table from the SCD.
+//
+// For every ExtRef of the subscribing IEDs that names a GOOSE source, the
+// publishing GoCB is resolved (srcCBName, or the LLN0 GoCB whose data set
+// carries the FCDA), along with the position of the FCDA in its data set
+// and the attribute the value lands in. The target is the ExtRef's intAddr,
+// read as "<DO>;/<cdc>/<DA>" (SIPROTEC 5) or as a DO.DA path inside the LN
+// that holds the Inputs. Only DA-level FCDAs are mapped. LGOS nodes whose
+// GoCBRef.setSrcRef names a subscribed GoCB supervise it through St.stVal.
+//
+// Output, one block per publishing GoCB:
+//
+//   GOCB <gocbRef> <appId hex> <data set ref> <confRev> <dst MAC>
+//   MAP <data set index> <target ref>
+//   LGOS <St.stVal ref>
+//
+// Usage: node scripts/goose-subscriptions.cjs <scd> <out> [ied,ied,...]
+// Without IED names the first IED of the SCD subscribes.
+
+const fs = require('fs');
+
+const IED_ELEMENT = /<IED\s[^>]*\bname="([^"]+)"[^>]*>[\s\S]*?<\/IED>/g;
+const LDEVICE_ELEMENT = /<LDevice\s[^>]*\binst="([^"]+)"[^>]*>([\s\S]*?)<\/LDevice>/g;
+const LN_ELEMENT = /<(LN0|LN)\s([^>]*?)(?:\/>|>([\s\S]*?)<\/\1>)/g;
+const EXTREF_ELEMENT = /<ExtRef\s([^>]*?)\/?>/g;
+const FCDA_ELEMENT = /<FCDA\s([^>]*?)\/?>/g;
+
+function attribute(attributes, name) {
+  const match = new RegExp(`\\b${name}="([^"]*)"`).exec(attributes);
+  return match ? match[1] : '';
+}
+
+function lnName(tag, attributes, instName) {
+  if (tag === 'LN0') return 'LLN0';
+  return attribute(attributes, 'prefix') + attribute(attributes, 'lnClass') + attribute(attributes, instName);
+}
+
+function readIeds(scd) {
+  const ieds = new Map();
+
+  for (const iedMatch of scd.matchAll(IED_ELEMENT)) {
+    const devices = new Map();
+    for (const ldMatch of iedMatch[0].matchAll(LDEVICE_ELEMENT)) {
+      const nodes = [...ldMatch[2].matchAll(LN_ELEMENT)].map((match) => ({
+        tag: match[1], attributes: match[2], body: match[3] || '', name: lnName(match[1], match[2], 'inst')
+      }));
+      devices.set(ldMatch[1], nodes);
+    }
+    ieds.set(iedMatch[1], devices);
+  }
+
+  return ieds;
+}
+
+function readGseAddresses(scd) {
+  const addresses = new Map(); // "IED/LD/cbName" -> { appId, mac }
+
+  for (const ap of scd.matchAll(/<ConnectedAP\s([^>]*)>([\s\S]*?)<\/ConnectedAP>/g)) {
+    const ied = attribute(ap[1], 'iedName');
+    for (const gse of ap[2].matchAll(/<GSE\s([^>]*)>([\s\S]*?)<\/GSE>/g)) {
+      const param = (type) => {
+        const match = new RegExp(`<P\\s[^>]*\\btype="${type}"[^>]*>([^<]*)<\\/P>`).exec(gse[2]);
+        return match ? match[1].trim() : '';
+      };
+      addresses.set(`${ied}/${attribute(gse[1], 'ldInst')}/${attribute(gse[1], 'cbName')}`, {
+        appId: param('APPID') || '0000',
+        mac: param('MAC-Address') || '-'
+      });
+    }
+  }
+
+  return addresses;
+}
+
+// All GOOSE control blocks of an IED with their data set members
+function controlBlocks(devices) {
+  const blocks = [];
+
+  for (const [ldInst, nodes] of devices) {
+    const ln0 = nodes.find((node) => node.tag === 'LN0');
+    if (!ln0) continue;
+
+    const dataSets = new Map();
+    for (const ds of ln0.body.matchAll(/<DataSet\s([^>]*)>([\s\S]*?)<\/DataSet>/g)) {
+      dataSets.set(attribute(ds[1], 'name'), [...ds[2].matchAll(FCDA_ELEMENT)].map((fcda) => fcda[1]));
+    }
+
+    for (const gcb of ln0.body.matchAll(/<GSEControl\s([^>]*?)\/?>/g)) {
+      if ((attribute(gcb[1], 'type') || 'GOOSE') !== 'GOOSE') continue;
+      const dataSet = attribute(gcb[1], 'datSet');
+      blocks.push({
+        ldInst,
+        name: attribute(gcb[1], 'name'),
+        dataSet,
+        confRev: attribute(gcb[1], 'confRev') || '0',
+        members: dataSets.get(dataSet) || []
+      });
+    }
+  }
+
+  return blocks;
+}
+
+function memberIndex(members, extRef) {
+  return members.findIndex((fcda) =>
+    attribute(fcda, 'ldInst') === attribute(extRef, 'ldInst') &&
+    attribute(fcda, 'prefix') === attribute(extRef, 'prefix') &&
+    attribute(fcda, 'lnClass') === attribute(extRef, 'lnClass') &&
+    attribute(fcda, 'lnInst') === attribute(extRef, 'lnInst') &&
+    attribute(fcda, 'doName') === attribute(extRef, 'doName') &&
+    attribute(fcda, 'daName') !== '' &&
+    attribute(fcda, 'daName') === attribute(extRef, 'daName'));
+}
+
+function targetPath(intAddr) {
+  const siprotec = /^([A-Za-z]\w*);\/(?:[^/]+\/)*([A-Za-z]\w*)$/.exec(intAddr);
+  if (siprotec) return `${siprotec[1]}.${siprotec[2]}`;
+  if (/^[A-Za-z]\w*(\.[A-Za-z]\w*)+$/.test(intAddr)) return intAddr;
+  return null;
+}
+
+function build(scd, subscriberNames) {
+  const ieds = readIeds(scd);
+  const addresses = readGseAddresses(scd);
+  const subscriptions = new Map(); // gocbRef -> { header, maps, lgos }
+  const blockCache = new Map();
+  const stats = { mapped: 0, skipped: 0 };
+
+  const blocksOf = (ied) => {
+    if (!blockCache.has(ied)) blockCache.set(ied, ieds.has(ied) ? controlBlocks(ieds.get(ied)) : []);
+    return blockCache.get(ied);
+  };
+
+  const subscriptionFor = (publisher, block) => {
+    const ref = `${publisher}${block.ldInst}/LLN0$GO$${block.name}`;
+    if (!subscriptions.has(ref)) {
+      const address = addresses.get(`${publisher}/${block.ldInst}/${block.name}`) || { appId: '0000', mac: '-' };
+      subscriptions.set(ref, {
+        header: `GOCB ${ref} ${address.appId} ${publisher}${block.ldInst}/LLN0$${block.dataSet} ${block.confRev} ${address.mac}`,
+        maps: [],
+        lgos: []
+      });
+    }
+    return subscriptions.get(ref);
+  };
+
+  for (const subscriber of subscriberNames) {
+    const devices = ieds.get(subscriber);
+    if (!devices) throw new Error(`IED ${subscriber} not found in the SCD`);
+
+    for (const [ldInst, nodes] of devices) {
+      for (const node of nodes) {
+        for (const extRef of node.body.matchAll(EXTREF_ELEMENT)) {
+          const attrs = extRef[1];
+          const publisher = attribute(attrs, 'iedName');
+          const serviceType = attribute(attrs, 'serviceType');
+          if (!publisher || (serviceType && serviceType !== 'GOOSE')) continue;
+
+          const path = targetPath(attribute(attrs, 'intAddr'));
+          const srcLd = attribute(attrs, 'srcLDInst') || attribute(attrs, 'ldInst');
+          const srcCb = attribute(attrs, 'srcCBName');
+          const candidates = blocksOf(publisher).filter((block) => srcCb ? (block.name === srcCb && block.ldInst === srcLd) : true);
+          const block = candidates.find((candidate) => memberIndex(candidate.members, attrs) >= 0);
+
+          if (!path || !block) {
+            stats.skipped++;
+            continue;
+          }
+
+          subscriptionFor(publisher, block).maps.push(`MAP ${memberIndex(block.members, attrs)} ${subscriber}${ldInst}/${node.name}.${path}`);
+          stats.mapped++;
+        }
+      }
+    }
+
+    // LGOS supervision: GoCBRef.setSrcRef is "<IED><LD>/LLN0.<cbName>"
+    for (const [ldInst, nodes] of devices) {
+      for (const node of nodes) {
+        if (attribute(node.attributes, 'lnClass') !== 'LGOS') continue;
+        const srcRef = /<DOI\s[^>]*\bname="GoCBRef"[\s\S]*?<DAI\s[^>]*\bname="setSrcRef"[\s\S]*?<Val>([^<]+)<\/Val>/.exec(node.body);
+        if (!srcRef) continue;
+
+        const ref = srcRef[1].trim().replace(/\/LLN0\.(\w+)$/, '/LLN0$GO$$$1');
+        if (subscriptions.has(ref)) subscriptions.get(ref).lgos.push(`LGOS ${subscriber}${ldInst}/${node.name}.St.stVal`);
+      }
+    }
+  }
+
+  const lines = ['# generated by scripts/goose-subscriptions.cjs'];
+  for (const subscription of subscriptions.values()) {
+    if (!subscription.maps.length && !subscription.lgos.length) continue;
+    lines.push(subscription.header, ...subscription.maps, ...subscription.lgos);
+  }
+
+  return { output: lines.join('\n') + '\n', blocks: subscriptions.size, stats };
+}
+
+function main() {
+  const [scdFile, outFile, iedList] = process.argv.slice(2);
+  if (!scdFile || !outFile) {
+    console.error('usage: node scripts/goose-subscriptions.cjs <scd> <out> [ied,ied,...]');
+    process.exit(1);
+  }
+
+  const scd = fs.readFileSync(scdFile, 'utf8');
+  let subscribers = iedList ? iedList.split(',').filter(Boolean) : [];
+  if (!subscribers.length) {
+    const first = /<IED\s[^>]*\bname="([^"]+)"/.exec(scd);
+    if (!first) throw new Error('no IED in the SCD');
+    subscribers = [first[1]];
+  }
+
+  const { output, blocks, stats } = build(scd, subscribers);
+
+  fs.writeFileSync(outFile, output);
+  console.log(`[goose-subscriptions] ${outFile}: ${blocks} GoCBs, ${stats.mapped} values mapped, ${stats.skipped} ExtRefs skipped`);
+}
+
+main();
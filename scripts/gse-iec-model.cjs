@@ -0,0 +1,143 @@
+// Defines the GOOSE control blocks genmodel declares but leaves out.
+//
+// genmodel only emits a GSEControlBlock when it finds the GSE address on
+// the access point it builds the model for. Devices such as the SIPROTEC 5
+// units in DUBGG.scd serve MMS on one access point and publish GOOSE on
+// another, so ied_model.c ends up with "extern GSEControlBlock ..." and
+// no definition. This writes those definitions from the SCD GSEControl
+// elements of the LD's LLN0 (by position, as genmodel numbers them), with
+// the address, MinTime and MaxTime of the matching GSE element on any
+// ConnectedAP of the IED. The blocks are chained in declaration order,
+// like genmodel does, so the model's gseCBs list reaches all of them.
+//
+// Usage: node scripts/gse-iec-model.cjs <scd> <ied_model.c> <out.c>
+
+const fs = require('fs');
+
+const EXTERN_GSE = /^extern GSEControlBlock (iedModel_(\w+)_LLN0_gse(\d+));$/gm;
+const DEFINED_GSE = /^GSEControlBlock (iedModel_\w+) =/gm;
+const MODEL_NAME = /^IedModel iedModel = \{\s*"([^"]+)"/m;
+
+function attribute(attributes, name) {
+  const match = new RegExp(`\\b${name}="([^"]*)"`).exec(attributes);
+  return match ? match[1] : undefined;
+}
+
+function escapeRegExp(text) {
+  return text.replace(/[.*+?^${}()|[\]\\]/g, '\\$&');
+}
+
+function controlBlocks(scd, ied, ldInst) {
+  const iedMatch = new RegExp(`<IED\\s[^>]*\\bname="${escapeRegExp(ied)}"[^>]*>[\\s\\S]*?<\\/IED>`).exec(scd);
+  if (!iedMatch) throw new Error(`IED ${ied} not found in the SCD`);
+
+  const ldMatch = new RegExp(`<LDevice\\s[^>]*\\binst="${escapeRegExp(ldInst)}"[^>]*>([\\s\\S]*?)<\\/LDevice>`).exec(iedMatch[0]);
+  const ln0 = ldMatch && /<LN0\b[\s\S]*?<\/LN0>/.exec(ldMatch[1]);
+  if (!ln0) return [];
+
+  return [...ln0[0].matchAll(/<GSEControl\s([^>]*?)\/?>/g)]
+    .map((match) => match[1])
+    .filter((attributes) => (attribute(attributes, 'type') || 'GOOSE') === 'GOOSE');
+}
+
+function gseAddress(scd, ied, ldInst, cbName) {
+  const apPattern = new RegExp(`<ConnectedAP\\s[^>]*\\biedName="${escapeRegExp(ied)}"[^>]*>[\\s\\S]*?<\\/ConnectedAP>`, 'g');
+
+  for (const ap of scd.matchAll(apPattern)) {
+    for (const gse of ap[0].matchAll(/<GSE\s([^>]*)>([\s\S]*?)<\/GSE>/g)) {
+      if (attribute(gse[1], 'ldInst') !== ldInst || attribute(gse[1], 'cbName') !== cbName) continue;
+
+      const param = (type) => {
+        const match = new RegExp(`<P\\s[^>]*\\btype="${type}"[^>]*>([^<]*)<\\/P>`).exec(gse[2]);
+        return match ? match[1].trim() : '';
+      };
+      const time = (element) => {
+        const match = new RegExp(`<${element}\\b[^>]*>\\s*(\\d+)\\s*<`).exec(gse[2]);
+        return match ? Number(match[1]) : -1;
+      };
+
+      return {
+        vlanPriority: Number(param('VLAN-PRIORITY') || 4),
+        vlanId: parseInt(param('VLAN-ID') || '0', 16),
+        appId: parseInt(param('APPID') || '0', 16),
+        mac: param('MAC-Address').split(/[-:]/).map((byte) => parseInt(byte, 16)),
+        minTime: time('MinTime'),
+        maxTime: time('MaxTime')
+      };
+    }
+  }
+
+  return null;
+}
+
+function cString(text) {
+  return text === undefined ? 'NULL' : JSON.stringify(text);
+}
+
+function generate(scd, model) {
+  const nameMatch = MODEL_NAME.exec(model);
+  if (!nameMatch) throw new Error('IedModel definition not found');
+  const ied = nameMatch[1];
+
+  const defined = new Set([...model.matchAll(DEFINED_GSE)].map((match) => match[1]));
+  const declared = [...model.matchAll(EXTERN_GSE)];
+  const definitions = [];
+  let withoutAddress = 0;
+
+  declared.forEach(([, symbol, ldInst, index], position) => {
+    if (defined.has(symbol)) return;
+
+    const attributes = controlBlocks(scd, ied, ldInst)[Number(index)];
+    if (!attributes) throw new Error(`no GSEControl #${index} in ${ied}/${ldInst}/LLN0 for ${symbol}`);
+
+    const name = attribute(attributes, 'name');
+    const address = gseAddress(scd, ied, ldInst, name);
+    const sibling = position + 1 < declared.length ? `&${declared[position + 1][1]}` : 'NULL';
+    let addressRef = 'NULL';
+
+    if (address && address.mac.length === 6) {
+      addressRef = `&${symbol}_address`;
+      definitions.push(`static PhyComAddress ${symbol}_address = {
+  ${address.vlanPriority},
+  ${address.vlanId},
+  ${address.appId},
+  {${address.mac.map((byte) => '0x' + byte.toString(16)).join(', ')}}
+};
+`);
+    } else {
+      withoutAddress++;
+    }
+
+    definitions.push(`GSEControlBlock ${symbol} = {&iedModel_${ldInst}_LLN0, ${cString(name)}, ${cString(attribute(attributes, 'appID'))}, ${cString(attribute(attributes, 'datSet'))}, ${Number(attribute(attributes, 'confRev') || 0)}, ${attribute(attributes, 'fixedOffs') === 'true'}, ${addressRef}, ${address ? address.minTime : -1}, ${address ? address.maxTime : -1}, ${sibling}};
+`);
+  });
+
+  const output = `/*
+ * GOOSE control blocks of ${ied} missing from ied_model.c
+ *
+ * generated by scripts/gse-iec-model.cjs
+ */
+
+#include "ied_model.h"
+
+${declared.map(([, symbol]) => `extern GSEControlBlock ${symbol};`).join('\n')}
+
+${definitions.join('\n')}`;
+
+  return { ied, output, count: declared.length - defined.size, withoutAddress };
+}
+
+function main() {
+  const [scdFile, modelFile, outFile] = process.argv.slice(2);
+  if (!scdFile || !modelFile || !outFile) {
+    console.error('usage: node scripts/gse-iec-model.cjs <scd> <ied_model.c> <out.c>');
+    process.exit(1);
+  }
+
+  const { ied, output, count, withoutAddress } = generate(fs.readFileSync(scdFile, 'utf8'), fs.readFileSync(modelFile, 'utf8'));
+
+  fs.writeFileSync(outFile, output);
+  console.log(`[gse-iec-model] ${outFile}: ${count} GOOSE control blocks of ${ied}${withoutAddress ? `, ${withoutAddress} without a GSE address` : ''}`);
+}
+
+main();
@@ -0,0 +1,322 @@
+
+/**
+ * libiec61850 backend stdin bridge codec (see scripts/dubgg_libiec_server.c)
+ */
+
+const fs = require('fs');
+
+const BRIDGE_OP_UPDATE = 0x01;
+const BRIDGE_OP_BEGIN = 0x02;
+const BRIDGE_OP_COMMIT = 0x03;
+const BRIDGE_OP_SV_SAMPLES = 0x04;
+const BRIDGE_OP_STATS = 0x05;
+const BRIDGE_OP_DATASET = 0x06;
+const BRIDGE_FLAG_TIMESTAMP = 0x01;
+// BRIDGE_BATCH_CAPACITY of the backend; a larger BEGIN/COMMIT batch is committed in parts
+const BATCH_CAPACITY = 1024;
+
+
+const BridgeType = {
+    NONE: 0,
+    BOOLEAN: 1,
+    INT32: 2,
+    UINT32: 3,
+    FLOAT: 4,
+    INT64: 5,
+    BITSTRING: 6,
+    UTCTIME: 7,
+    STRING: 8,
+    DBPOS: 9
+};
+
+const FIXED_VALUE_SIZE = {
+    [BridgeType.BOOLEAN]: 1,
+    [BridgeType.INT32]: 4,
+    [BridgeType.UINT32]: 4,
+    [BridgeType.FLOAT]: 4,
+    [BridgeType.INT64]: 8,
+    [BridgeType.BITSTRING]: 4,
+    [BridgeType.UTCTIME]: 8,
+    [BridgeType.DBPOS]: 1
+};
+
+// 9-2LE channel order: Ia, Ib, Ic, In (mA), Va, Vb, Vc, Vn (10 mV)
+const SV_CHANNELS = 8;
+const SV_SAMPLES_PER_FRAME = Math.floor((0xffff - 2) / (SV_CHANNELS * 4));
+
+const DBPOS_NAMES = { intermediate: 0, off: 1, on: 2, bad: 3 };
+
+// Same keywords the backend accepts for quality attributes in text mode
+const QUALITY_BITS = {
+    good: 0, invalid: 0x2, questionable: 0x3, overflow: 0x4, outofrange: 0x8,
+    badreference: 0x10, oscillatory: 0x20, failure: 0x40, olddata: 0x80,
+    inconsistent: 0x100, inaccurate: 0x200, substituted: 0x400, test: 0x800,
+    blocked: 0x1000, derived: 0x2000
+};
+
+function toBoolean(value) {
+    if (typeof value === 'string') {
+        const lowered = value.trim().toLowerCase();
+        if (lowered === 'true') return true;
+        if (lowered === 'false') return false;
+    }
+    return Boolean(Number(value));
+}
+
+function toNumber(value) {
+    if (typeof value === 'string') {
+        const lowered = value.trim().toLowerCase();
+        if (lowered === 'true') return 1;
+        if (lowered === 'false') return 0;
+    }
+    return Number(value);
+}
+
+function toDbpos(value) {
+    if (typeof value === 'string' && value.trim().toLowerCase() in DBPOS_NAMES) {
+        return DBPOS_NAMES[value.trim().toLowerCase()];
+    }
+    const numeric = toNumber(value);
+    return Number.isInteger(numeric) && numeric >= 0 && numeric <= 3 ? numeric : NaN;
+}
+
+function toBits(value) {
+    // As parse_quality_text in the backend: an empty value is not "good"
+    if (typeof value === 'string' && value.trim() === '') return NaN;
+    if (typeof value === 'string' && /^[a-z|]+$/i.test(value.trim())) {
+        let bits = 0;
+        for (const word of value.trim().toLowerCase().split('|')) {
+            if (!(word in QUALITY_BITS)) return NaN;
+            bits |= QUALITY_BITS[word];
+        }
+        return bits;
+    }
+    return toNumber(value);
+}
+
+function toTimeMs(value) {
+    if (typeof value === 'number') return value;
+    const numeric = Number(value);
+    if (Number.isFinite(numeric)) return numeric;
+    return Date.parse(String(value));
+}
+
+// "BRIDGE_HANDLE <handle> <type> <ref>" -> { handle, type, ref }
+function parseHandleLine(line) {
+    const match = /^BRIDGE_HANDLE (\d+) (\d+) (\S+)$/.exec(line);
+    if (!match) return null;
+    return { handle: Number(match[1]), type: Number(match[2]), ref: match[3] };
+}
+
+// "BRIDGE_DATASET <index> <ref> <handle>,<handle>,..." -> { index, ref, handles }, -1 for unwritable members
+function parseDataSetLine(line) {
+    const match = /^BRIDGE_DATASET (\d+) (\S+) (-?\d+(?:,-?\d+)*)$/.exec(line);
+    if (!match) return null;
+    return { index: Number(match[1]), ref: match[2], handles: match[3].split(',').map(Number) };
+}
+
+// The backend also accepts a DataObject reference as an alias for its stVal
+function aliasForRef(ref) {
+    return ref.endsWith('.stVal') ? ref.slice(0, -'.stVal'.length) : null;
+}
+
+// Encodes a value as `type` (strings without their length); returns null if it cannot be represented
+function encodeValue(type, value) {
+    if (type === BridgeType.STRING) {
+        return Buffer.from(String(value), 'utf8').subarray(0, 255);
+    }
+
+    const size = FIXED_VALUE_SIZE[type];
+    if (!size) return null;
+    const valueBytes = Buffer.alloc(size);
+
+    if (type === BridgeType.BOOLEAN) {
+        valueBytes.writeUInt8(toBoolean(value) ? 1 : 0, 0);
+    } else if (type === BridgeType.DBPOS) {
+        const state = toDbpos(value);
+        if (!Number.isFinite(state)) return null;
+        valueBytes.writeUInt8(state, 0);
+    } else if (type === BridgeType.INT64) {
+        let big;
+        try { big = BigInt(typeof value === 'number' ? Math.trunc(value) : String(value).trim()); } catch { return null; }
+        valueBytes.writeBigInt64LE(big, 0);
+    } else if (type === BridgeType.UTCTIME) {
+        const ms = toTimeMs(value);
+        if (!Number.isFinite(ms)) return null;
+        valueBytes.writeBigUInt64LE(BigInt(Math.trunc(ms)), 0);
+    } else {
+        const numeric = type === BridgeType.BITSTRING ? toBits(value) : toNumber(value);
+        if (!Number.isFinite(numeric)) return null;
+        if (type === BridgeType.FLOAT) valueBytes.writeFloatLE(numeric, 0);
+        else if (type === BridgeType.INT32) valueBytes.writeInt32LE(Math.trunc(numeric) | 0, 0);
+        else valueBytes.writeUInt32LE(Math.trunc(numeric) >>> 0, 0);
+    }
+
+    return valueBytes;
+}
+
+// Encodes one update frame; returns null if the value cannot be represented as `type`
+function encodeUpdate(handle, type, value, timestampMs) {
+    const valueBytes = encodeValue(type, value);
+    if (!valueBytes) return null;
+
+    const hasTime = Number.isFinite(timestampMs);
+    const frameLen = 1 + 4 + 1 + 1 + valueBytes.length + (hasTime ? 8 : 0);
+    const frame = Buffer.alloc(2 + frameLen);
+    frame.writeUInt16LE(frameLen, 0);
+    frame.writeUInt8(BRIDGE_OP_UPDATE, 2);
+    frame.writeUInt32LE(handle >>> 0, 3);
+    frame.writeUInt8(type, 7);
+    frame.writeUInt8(hasTime ? BRIDGE_FLAG_TIMESTAMP : 0, 8);
+    valueBytes.copy(frame, 9);
+    if (hasTime) frame.writeBigUInt64LE(BigInt(Math.trunc(timestampMs)), 9 + valueBytes.length);
+    return frame;
+}
+
+// One frame for a whole data set: values[i] goes to member i, null/undefined leaves it unchanged.
+// types[i] is the member's type from the handle table. Returns null on an invalid value.
+function encodeDataSet(index, types, values, timestampMs) {
+    const hasTime = Number.isFinite(timestampMs);
+    const parts = [];
+
+    for (let i = 0; i < types.length; i++) {
+        const value = values[i];
+        if (value === null || value === undefined || value === '') {
+            parts.push(Buffer.from([BridgeType.NONE]));
+            continue;
+        }
+
+        const valueBytes = types[i] ? encodeValue(types[i], value) : null;
+        if (!valueBytes) return null;
+        const header = types[i] === BridgeType.STRING ? Buffer.from([types[i], valueBytes.length]) : Buffer.from([types[i]]);
+        parts.push(header, valueBytes);
+    }
+
+    const head = Buffer.alloc(2 + 1 + 2 + 1 + (hasTime ? 8 : 0));
+    const members = Buffer.concat(parts);
+    const frameLen = head.length - 2 + members.length;
+    if (frameLen > 0xffff) return null;
+
+    head.writeUInt16LE(frameLen, 0);
+    head.writeUInt8(BRIDGE_OP_DATASET, 2);
+    head.writeUInt16LE(index, 3);
+    head.writeUInt8(hasTime ? BRIDGE_FLAG_TIMESTAMP : 0, 5);
+    if (hasTime) head.writeBigUInt64LE(BigInt(Math.trunc(timestampMs)), 6);
+    return Buffer.concat([head, members]);
+}
+
+// Text form of the same update
+function formatDataSetLine(ref, values) {
+    return `DATASET ${ref}=${values.map((value) => (value === null || value === undefined ? '' : String(value))).join(';')}\n`;
+}
+
+const BEGIN_FRAME = Buffer.from([1, 0, BRIDGE_OP_BEGIN]);
+const COMMIT_FRAME = Buffer.from([1, 0, BRIDGE_OP_COMMIT]);
+// Asks the backend for its BRIDGE_METRICS lines
+const STATS_FRAME = Buffer.from([1, 0, BRIDGE_OP_STATS]);
+
+// Wraps several update frames so the backend applies them under one model lock
+function encodeBatch(frames) {
+    if (frames.length === 1) return frames[0];
+    return Buffer.concat([BEGIN_FRAME, ...frames, COMMIT_FRAME]);
+}
+
+// samples: array of 8-channel arrays, already scaled to 9-2LE integers
+function encodeSvSamples(stream, samples) {
+    const frames = [];
+
+    for (let first = 0; first < samples.length; first += SV_SAMPLES_PER_FRAME) {
+        const chunk = samples.slice(first, first + SV_SAMPLES_PER_FRAME);
+        const frameLen = 2 + chunk.length * SV_CHANNELS * 4;
+        const frame = Buffer.alloc(2 + frameLen);
+        frame.writeUInt16LE(frameLen, 0);
+        frame.writeUInt8(BRIDGE_OP_SV_SAMPLES, 2);
+        frame.writeUInt8(stream, 3);
+
+        let offset = 4;
+        for (const sample of chunk) {
+            for (let ch = 0; ch < SV_CHANNELS; ch++, offset += 4) {
+                const value = Number(sample[ch]);
+                frame.writeInt32LE(Number.isFinite(value) ? Math.max(-0x80000000, Math.min(0x7fffffff, Math.round(value))) : 0, offset);
+            }
+        }
+        frames.push(frame);
+    }
+
+    return Buffer.concat(frames);
+}
+
+// Shared value table announced as "BRIDGE_SHM <path> <slots> <tick ms>" (see Shared Value Table in the backend).
+// Node cannot map the file, so slots are written with positional writes in the order the backend expects:
+// seq odd, value, seq even, dirty byte. That is four syscalls per value, more than a pipe frame, which is
+// why the relay only uses it on request. Returns null if the table is missing or has another layout.
+function openSharedTable(path) {
+    let fd;
+    try { fd = fs.openSync(path, 'r+'); } catch { return null; }
+
+    const header = Buffer.alloc(64);
+    fs.readSync(fd, header, 0, 64, 0);
+    if (header.toString('latin1', 0, 8) !== 'DUBGGSHM' || header.readUInt32LE(8) !== 2) {
+        fs.closeSync(fd);
+        return null;
+    }
+
+    const slotCount = header.readUInt32LE(12);
+    const groupSize = header.readUInt32LE(16);
+    const groupSlots = header.readUInt32LE(20);
+    const dirtyOffset = header.readUInt32LE(24);
+    const groupOffset = header.readUInt32LE(28);
+    const seqOffset = (handle) => groupOffset + Math.floor(handle / groupSlots) * groupSize + (handle % groupSlots) * 4;
+    const valueOffset = (handle) => groupOffset + Math.floor(handle / groupSlots) * groupSize + 32 + (handle % groupSlots) * 8;
+
+    // Carry on from the sequence numbers already in the table, e.g. after a relay restart
+    const groups = Buffer.alloc(Math.ceil(slotCount / groupSlots) * groupSize);
+    fs.readSync(fd, groups, 0, groups.length, groupOffset);
+    const seqs = new Uint32Array(slotCount);
+    for (let i = 0; i < slotCount; i++) seqs[i] = groups.readUInt32LE(seqOffset(i) - groupOffset) & ~1;
+
+    const seqBytes = Buffer.alloc(4);
+    const valueBytes = Buffer.alloc(8);
+    const DIRTY = Buffer.from([1]);
+
+    return {
+        slotCount,
+        // Writes `value` as the slot's `type`; false if it cannot be represented
+        write(handle, type, value) {
+            if (handle >= slotCount || type === BridgeType.STRING) return false;
+            const encoded = encodeValue(type, value);
+            if (!encoded) return false;
+
+            valueBytes.fill(0);
+            encoded.copy(valueBytes);
+
+            seqBytes.writeUInt32LE((seqs[handle] + 1) >>> 0);
+            fs.writeSync(fd, seqBytes, 0, 4, seqOffset(handle));
+            fs.writeSync(fd, valueBytes, 0, 8, valueOffset(handle));
+            seqs[handle] = (seqs[handle] + 2) >>> 0;
+            seqBytes.writeUInt32LE(seqs[handle]);
+            fs.writeSync(fd, seqBytes, 0, 4, seqOffset(handle));
+            fs.writeSync(fd, DIRTY, 0, 1, dirtyOffset + Math.floor(handle / groupSlots));
+            return true;
+        },
+        close() {
+            try { fs.closeSync(fd); } catch { }
+        }
+    };
+}
+
+module.exports = {
+    BridgeType,
+    QUALITY_BITS,
+    BATCH_CAPACITY,
+    parseHandleLine,
+    parseDataSetLine,
+    aliasForRef,
+    encodeUpdate,
+    encodeDataSet,
+    formatDataSetLine,
+    openSharedTable,
+    encodeBatch,
+    encodeSvSamples,
+    STATS_FRAME
+};
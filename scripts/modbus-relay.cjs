@@ -1,11 +1,13 @@
 #!/usr/bin/env node
 
+const fs = require('fs');
 const os = require('os');
 const net = require('net');
 const { spawn } = require('child_process');
 const { WebSocketServer } = require('ws');
 const modbus = require('./lib/modbus-server.cjs');
 const iec = require('./lib/iec-server.cjs');
+const iecBridge = require('./lib/iec-bridge.cjs');
 
 const WS_PORT = Number(process.env.RELAY_WS_PORT || 34001);
 const MODBUS_PORT = Number(process.env.RELAY_MODBUS_PORT || 502);
@@ -20,6 +22,15 @@ const IEC_FORCE_BACKEND_PORT = Number(process.env.RELAY_IEC_FORCE_BACKEND_PORT |
 const IEC_DEFAULT_LISTENER = process.env.RELAY_IEC_DEFAULT_LISTENER === '1';
 const CLEAR_IEC_ON_UI_DISCONNECT = process.env.RELAY_CLEAR_IEC_ON_UI_DISCONNECT !== '0';
 const ALLOW_HEADLESS_WS = process.env.RELAY_ALLOW_HEADLESS_WS === '1';
+const IEC_BRIDGE_PROTOCOL = process.env.RELAY_IEC_BRIDGE_PROTOCOL === 'text' ? 'text' : 'binary';
+// Every distinct IEC reference the simulation writes is appended here; the model prune pass reads it
+const IEC_BINDINGS_FILE = process.env.RELAY_IEC_BINDINGS_FILE || '';
+// Every IEC update is appended here as "<ms since start> <ref>=<value>"; dubgg_libiec_bench replays it
+const IEC_TRACE_FILE = process.env.RELAY_IEC_TRACE_FILE || '';
+// '1' sends lone float updates through the backend's shared value table when it announces one
+const IEC_USE_SHM = process.env.RELAY_IEC_SHM === '1';
+// Delay before a managed IEC server that exited is started again, '0' leaves it stopped
+const IEC_RESPAWN_MS = Number(process.env.RELAY_IEC_RESPAWN_MS || 2000);
 
 // Managed C-Server (Bridge)
 const IEC_SERVER_BIN = process.env.IEC_SERVER_BIN; // Path to C binary
@@ -27,7 +38,24 @@ let iecChildProcess = null;
 let iecChildStdoutBuffer = '';
 let iecChildStderrBuffer = '';
 let iecChildReady = false;
-const pendingIecUpdates = [];
+let iecChildCaps = new Set();
+let iecBridgeMode = 'text'; // text | negotiating | binary
+const iecHandleTable = new Map(); // ref -> { handle, type }
+const iecControlTable = new Map(); // control id -> ref
+const iecSvStreams = new Map(); // svID -> stream index
+const iecHandleTypes = []; // handle -> type
+const iecDataSetTable = new Map(); // data set ref -> { index, types }
+let iecSharedTable = null; // see iecBridge.openSharedTable
+let iecOutgoingFrames = [];
+let iecOutgoingScheduled = false;
+const pendingIecUpdates = new Map(); // ref -> latest value not yet sent
+const latestIecValues = new Map(); // ref -> last value routed, restored into a new backend
+let iecBytesWritten = 0;
+let iecBytesConsumed = 0; // from BRIDGE_CREDIT
+let iecCreditWindow = 0; // bytes the backend accepts in flight, 0 without credit
+const recordedIecBindings = new Set();
+let iecTraceStream = null;
+let iecTraceStart = 0;
 
 let uiSocket = null;
 let selectedAdapterIp = null;
@@ -136,6 +164,119 @@ function updateIecClientCount(bindHost, bindPort, delta) {
   }
 }
 
+function setIecChildReady() {
+  iecChildReady = true;
+  flushPendingIecUpdates();
+}
+
+function handleIecBridgeLine(trimmed) {
+  if (trimmed.startsWith('BRIDGE_HANDLE ')) {
+    const entry = iecBridge.parseHandleLine(trimmed);
+    if (entry) {
+      iecHandleTable.set(entry.ref, entry);
+      iecHandleTypes[entry.handle] = entry.type;
+      const alias = iecBridge.aliasForRef(entry.ref);
+      if (alias && !iecHandleTable.has(alias)) {
+        iecHandleTable.set(alias, entry);
+      }
+    }
+    return true;
+  }
+
+  if (trimmed.startsWith('BRIDGE_DATASET ')) {
+    const dataSet = iecBridge.parseDataSetLine(trimmed);
+    if (dataSet) {
+      iecDataSetTable.set(dataSet.ref, {
+        index: dataSet.index,
+        types: dataSet.handles.map((handle) => (handle >= 0 ? iecHandleTypes[handle] || 0 : 0))
+      });
+    }
+    return true;
+  }
+
+  if (trimmed.startsWith('BRIDGE_CONTROL ')) {
+    const match = /^BRIDGE_CONTROL (\d+) (\S+)$/.exec(trimmed);
+    if (match) iecControlTable.set(match[1], match[2]);
+    return true;
+  }
+
+  if (trimmed.startsWith('BRIDGE_SV ')) {
+    const match = /^BRIDGE_SV (\d+) (\S+) (\d+)$/.exec(trimmed);
+    if (match) iecSvStreams.set(match[2], Number(match[1]));
+    return false;
+  }
+
+  if (trimmed.startsWith('BRIDGE_SHM ')) {
+    const match = /^BRIDGE_SHM (\S+) (\d+) (\d+)$/.exec(trimmed);
+    if (match && IEC_USE_SHM) {
+      if (iecSharedTable) iecSharedTable.close();
+      iecSharedTable = iecBridge.openSharedTable(match[1]);
+      console.log(iecSharedTable
+        ? `[relay] Writing float IEC updates to shared value table ${match[1]} (${match[3]} ms tick)`
+        : `[relay] Shared value table ${match[1]} unavailable, using the pipe`);
+    }
+    return false;
+  }
+
+  if (trimmed.startsWith('BRIDGE_CAPS ')) {
+    iecChildCaps = new Set(trimmed.substring('BRIDGE_CAPS '.length).split(/\s+/));
+    if (iecChildCaps.has('credit')) writeIecChild('CREDIT\n');
+    return false;
+  }
+
+  if (trimmed.startsWith('BRIDGE_CREDIT ')) {
+    const match = /^BRIDGE_CREDIT (\d+) (\d+)$/.exec(trimmed);
+    if (match) {
+      iecBytesConsumed = Number(match[1]);
+      iecCreditWindow = Number(match[2]);
+      flushPendingIecUpdates();
+    }
+    return true;
+  }
+
+  if (trimmed.startsWith('BRIDGE_TABLE ')) {
+    iecHandleTable.clear();
+    iecHandleTypes.length = 0;
+    iecDataSetTable.clear();
+    return false;
+  }
+
+  if (trimmed === 'BRIDGE_PROTO binary') {
+    iecBridgeMode = 'binary';
+    console.log(`[relay] IEC bridge switched to binary protocol (${iecHandleTable.size} refs)`);
+    setIecChildReady();
+    return false;
+  }
+
+  return false;
+}
+
+// "CONTROL_UPDATE <id> <ctlVal> ctlNum=<n> orCat=<n> test=<0|1> orIdent=<hex>",
+// or "CONTROL_UPDATE <ref>" from older backends
+function parseIecControlLine(trimmed) {
+  const [first, rawValue, ...fields] = trimmed.substring('CONTROL_UPDATE '.length).trim().split(' ');
+  const control = { ref: iecControlTable.get(first) || first };
+  if (rawValue === undefined) return control;
+
+  if (rawValue === 'true' || rawValue === 'false') control.ctlVal = rawValue === 'true';
+  else if (rawValue !== '' && Number.isFinite(Number(rawValue))) control.ctlVal = Number(rawValue);
+  else control.ctlVal = rawValue;
+
+  for (const field of fields) {
+    const eq = field.indexOf('=');
+    if (eq < 0) continue;
+    const key = field.substring(0, eq);
+    const value = field.substring(eq + 1);
+    if (key === 'ctlNum' || key === 'orCat') control[key] = Number(value);
+    else if (key === 'test') control.test = value === '1';
+    else if (key === 'orIdent') {
+      const bytes = Buffer.from(value, 'hex');
+      control.orIdent = /^[\x20-\x7e]*$/.test(bytes.toString('latin1')) ? bytes.toString('latin1') : value;
+    }
+  }
+  return control;
+}
+
 function handleIecChildStdoutChunk(data) {
   iecChildStdoutBuffer += data.toString();
   const lines = iecChildStdoutBuffer.split(/\r?\n/);
@@ -145,20 +286,33 @@ function handleIecChildStdoutChunk(data) {
     const trimmed = line.trim();
     if (!trimmed) return;
 
+    // Handle table entries are consumed silently
+    if (handleIecBridgeLine(trimmed)) return;
+
     console.log(`[libiec] ${trimmed}`);
 
     if (trimmed.includes('IEC 61850 server started on port')) {
-      iecChildReady = true;
-      flushPendingIecUpdates();
+      if (IEC_BRIDGE_PROTOCOL === 'binary' && iecChildCaps.has('binary')) {
+        // Hold updates until the handle table has arrived and the backend expects frames
+        iecBridgeMode = 'negotiating';
+        writeIecChild('PROTO binary\n');
+      } else {
+        setIecChildReady();
+      }
     }
 
     if (trimmed.startsWith('CONTROL_UPDATE ')) {
-      const ref = trimmed.substring('CONTROL_UPDATE '.length).trim();
+      const control = parseIecControlLine(trimmed);
       sendUi({
         type: 'IEC_TRACE', direction: 'rx', source: 'External IEC Client',
         targetIp: 'IEC Server', targetPort: IEC_BACKEND_PORT,
-        info: `Control operated: ${ref}`
+        info: control.ctlVal !== undefined
+          ? `Control operated: ${control.ref} = ${control.ctlVal}${control.test ? ' (test)' : ''}`
+          : `Control operated: ${control.ref}`
       });
+      if (control.ctlVal !== undefined) {
+        sendUi({ type: 'IEC_CONTROL', ...control });
+      }
     }
     if (trimmed.startsWith('BRIDGE_OK: ')) {
       sendUi({
@@ -166,6 +320,18 @@ function handleIecChildStdoutChunk(data) {
         targetIp: 'IEC Server', targetPort: IEC_BACKEND_PORT, info: trimmed
       });
     }
+    if (trimmed.startsWith('BRIDGE_STATS ') || trimmed.startsWith('SV_STATS ') || trimmed.startsWith('BRIDGE_METRICS')) {
+      sendUi({
+        type: 'IEC_TRACE', direction: 'tx', source: 'Logic Engine',
+        targetIp: 'IEC Server', targetPort: IEC_BACKEND_PORT, info: trimmed
+      });
+    }
+    if (trimmed.startsWith('GOOSE_SUPERVISION ')) {
+      sendUi({
+        type: 'IEC_TRACE', direction: 'rx', source: 'GOOSE Subscriber',
+        targetIp: 'IEC Server', targetPort: IEC_BACKEND_PORT, info: trimmed
+      });
+    }
     if (trimmed.startsWith('BRIDGE_ERR: ')) {
       sendUi({
         type: 'IEC_TRACE', direction: 'error', source: 'Logic Engine',
@@ -187,12 +353,32 @@ function handleIecChildStderrChunk(data) {
   });
 }
 
+// Every write to the backend's stdin goes through here, so the credit window sees all of it
+function writeIecChild(data) {
+  iecBytesWritten += typeof data === 'string' ? Buffer.byteLength(data) : data.length;
+  return iecChildProcess.stdin.write(data);
+}
+
+// True while the pipe is above its high-water mark or the backend has a full window to work through
+function iecChildCongested() {
+  if (iecChildProcess.stdin.writableNeedDrain) return true;
+  return iecCreditWindow > 0 && iecBytesWritten - iecBytesConsumed >= iecCreditWindow;
+}
+
+// Held updates collapse to the latest value per reference; a reason is logged when holding starts
 function queueIecUpdate(ref, value, reason) {
-  pendingIecUpdates.push({ ref, value });
-  if (pendingIecUpdates.length > 500) {
-    pendingIecUpdates.shift();
-  }
-  console.warn(`[relay] Queued IEC update for ${ref} (${reason})`);
+  if (reason && !pendingIecUpdates.size) console.warn(`[relay] Holding IEC updates (${reason})`);
+  pendingIecUpdates.set(ref, value);
+}
+
+// A float update that is alone in its event loop turn skips the pipe; the backend picks it up on
+// its next tick. Batches and data sets stay framed so their members are applied together, and
+// nothing may be in flight on the pipe, where an older value of the same ref would land later.
+function writeIecSharedValue(ref, value) {
+  if (!iecSharedTable || iecBridgeMode !== 'binary' || iecOutgoingFrames.length || pendingIecUpdates.size > 1) return false;
+  if (iecCreditWindow > 0 && iecBytesWritten !== iecBytesConsumed) return false;
+  const entry = iecHandleTable.get(ref);
+  return Boolean(entry && entry.type === iecBridge.BridgeType.FLOAT && iecSharedTable.write(entry.handle, entry.type, value));
 }
 
 function writeIecUpdate(ref, value) {
@@ -201,46 +387,198 @@ function writeIecUpdate(ref, value) {
     return false;
   }
 
-  const line = `${ref}=${value}\n`;
-  const ok = iecChildProcess.stdin.write(line);
-  if (!ok) {
-    queueIecUpdate(ref, value, 'stdin backpressure');
-    return false;
+  if (iecBridgeMode === 'binary') {
+    const entry = iecHandleTable.get(ref);
+    const frame = entry ? iecBridge.encodeUpdate(entry.handle, entry.type, value) : null;
+    if (!frame) {
+      sendUi({
+        type: 'IEC_TRACE', direction: 'error', source: 'Logic Engine',
+        targetIp: 'IEC Server', targetPort: IEC_BACKEND_PORT,
+        info: entry ? `BRIDGE_ERR: Invalid value for ${ref}: ${value}` : `BRIDGE_ERR: Node not found or not attribute: ${ref}`
+      });
+      return true;
+    }
+    iecOutgoingFrames.push(frame);
+    scheduleIecOutgoingFrames();
+    return true;
   }
 
+  // A false return only means the pipe is above its high-water mark; the line is still queued
+  writeIecChild(`${ref}=${value}\n`);
   return true;
 }
 
+function scheduleIecOutgoingFrames() {
+  if (iecOutgoingScheduled) return;
+  iecOutgoingScheduled = true;
+  setImmediate(flushIecOutgoingFrames);
+}
+
+// Updates produced in the same event loop turn reach the backend as one batch
+function flushIecOutgoingFrames() {
+  flushPendingIecUpdates();
+  iecOutgoingScheduled = false;
+  const frames = iecOutgoingFrames;
+  iecOutgoingFrames = [];
+  if (!frames.length) return;
+  if (!iecChildProcess || !iecChildProcess.stdin || iecChildProcess.stdin.destroyed) return;
+
+  // A false return only means the pipe buffer is above its high-water mark; the batch is still queued
+  if (!iecChildCaps.has('batch')) {
+    writeIecChild(Buffer.concat(frames));
+  } else {
+    for (let start = 0; start < frames.length; start += iecBridge.BATCH_CAPACITY) {
+      writeIecChild(iecBridge.encodeBatch(frames.slice(start, start + iecBridge.BATCH_CAPACITY)));
+    }
+  }
+
+  if (pendingIecUpdates.size && !iecChildCongested()) scheduleIecOutgoingFrames();
+}
+
+// Held updates leave in batches, a snapshot of the latest values rather than the intermediates.
+// Each call sends what the credit window and the backend's batch capacity have room for; the
+// rest goes with the next credit, drain or event loop turn until the backend has caught up.
 function flushPendingIecUpdates() {
-  if (!iecChildProcess || !iecChildReady) return;
-  if (!pendingIecUpdates.length) return;
-
-  const pending = pendingIecUpdates.splice(0, pendingIecUpdates.length);
-  let flushed = 0;
-  pending.forEach(({ ref, value }) => {
-    if (writeIecUpdate(ref, value)) {
-      flushed += 1;
+  if (!iecChildProcess || !iecChildReady || !pendingIecUpdates.size) return;
+  if (!iecChildProcess.stdin || iecChildProcess.stdin.destroyed || iecChildCongested()) return;
+
+  const binary = iecBridgeMode === 'binary';
+  if (binary && pendingIecUpdates.size === 1) {
+    const [[ref, value]] = pendingIecUpdates;
+    if (writeIecSharedValue(ref, value)) {
+      pendingIecUpdates.delete(ref);
+      return;
     }
+  }
+
+  // Binary frames of this turn are not written yet but count against both limits
+  const room = iecBridge.BATCH_CAPACITY - (binary ? iecOutgoingFrames.length : 0);
+  let credit = iecCreditWindow > 0 ? iecCreditWindow - (iecBytesWritten - iecBytesConsumed) : Infinity;
+  if (binary) iecOutgoingFrames.forEach((frame) => { credit -= frame.length; });
+
+  const batched = !binary && iecChildCaps.has('batch') && pendingIecUpdates.size > 1;
+  let sent = 0;
+
+  if (batched) writeIecChild('BEGIN\n');
+  for (const [ref, value] of pendingIecUpdates) {
+    if (sent >= room || credit <= 0) break;
+    const frameCount = iecOutgoingFrames.length;
+    const written = iecBytesWritten;
+    pendingIecUpdates.delete(ref);
+    writeIecUpdate(ref, value);
+    credit -= binary ? (iecOutgoingFrames.length > frameCount ? iecOutgoingFrames[frameCount].length : 0) : iecBytesWritten - written;
+    sent++;
+  }
+  if (batched) writeIecChild('COMMIT\n');
+
+  // Binary chunks continue from flushIecOutgoingFrames; without a credit window nothing else resumes text
+  if (!binary && pendingIecUpdates.size && !iecChildCongested()) setImmediate(flushPendingIecUpdates);
+}
+
+function loadIecBindings() {
+  if (!IEC_BINDINGS_FILE) return;
+  try {
+    fs.readFileSync(IEC_BINDINGS_FILE, 'utf8').split('\n').forEach((line) => {
+      if (line.trim()) recordedIecBindings.add(line.trim());
+    });
+  } catch { }
+  console.log(`[relay] Recording IEC bindings to ${IEC_BINDINGS_FILE} (${recordedIecBindings.size} known)`);
+}
+
+function recordIecBinding(ref) {
+  if (!IEC_BINDINGS_FILE || recordedIecBindings.has(ref)) return;
+  recordedIecBindings.add(ref);
+  fs.appendFile(IEC_BINDINGS_FILE, `${ref}\n`, (err) => {
+    if (err) console.error(`[relay] Failed to record IEC binding ${ref}: ${err.message}`);
   });
+}
 
-  if (flushed > 0) {
-    console.log(`[relay] Flushed ${flushed} queued IEC update(s)`);
+function recordIecTrace(ref, value) {
+  if (!IEC_TRACE_FILE || (typeof value === 'object' && value !== null)) return;
+  if (!iecTraceStream) {
+    iecTraceStream = fs.createWriteStream(IEC_TRACE_FILE, { flags: 'w' });
+    iecTraceStream.on('error', (err) => console.error(`[relay] Failed to record IEC trace: ${err.message}`));
+    iecTraceStart = Date.now();
+    console.log(`[relay] Recording IEC update trace to ${IEC_TRACE_FILE}`);
   }
+  iecTraceStream.write(`${Date.now() - iecTraceStart} ${ref}=${value}\n`);
 }
 
 function routeIecUpdate(ref, value) {
   if (!ref || value === undefined) return;
+  recordIecBinding(ref);
+  recordIecTrace(ref, value);
+  latestIecValues.set(ref, value);
 
   if (!iecChildProcess || !iecChildReady) {
     queueIecUpdate(ref, value, iecChildProcess ? 'IEC child not ready yet' : 'IEC child not running');
     return;
   }
 
-  if (!writeIecUpdate(ref, value)) {
-    console.warn(`[relay] Failed to write IEC update for ${ref}; left queued`);
+  // Binary updates of one event loop turn, and anything behind held updates or a full window,
+  // wait in the coalescing queue and leave as one batch
+  if (iecBridgeMode === 'binary' || pendingIecUpdates.size || iecChildCongested()) {
+    queueIecUpdate(ref, value);
+    if (iecBridgeMode === 'binary') scheduleIecOutgoingFrames();
+    else flushPendingIecUpdates();
+    return;
   }
+
+  writeIecUpdate(ref, value);
 }
 
+// The backend answers on stdout with BRIDGE_METRICS lines, forwarded like BRIDGE_STATS
+function requestIecMetrics() {
+  if (!iecChildProcess || !iecChildReady || !iecChildCaps.has('metrics') || iecBridgeMode === 'negotiating') return;
+  if (!iecChildProcess.stdin || iecChildProcess.stdin.destroyed) return;
+
+  writeIecChild(iecBridgeMode === 'binary' ? iecBridge.STATS_FRAME : 'STATS\n');
+}
+
+// A whole data set in one message, applied by the backend under one lock and reported once.
+// values follow the data set's member order; null leaves a member unchanged. Not queued while
+// the backend starts, the next vector supersedes it anyway.
+function writeIecDataSet(ref, values) {
+  if (!ref || !Array.isArray(values)) return;
+  if (!iecChildProcess || !iecChildReady || !iecChildCaps.has('dataset') || iecBridgeMode === 'negotiating') return;
+  if (!iecChildProcess.stdin || iecChildProcess.stdin.destroyed) return;
+
+  if (iecBridgeMode !== 'binary') {
+    writeIecChild(iecBridge.formatDataSetLine(ref, values));
+    return;
+  }
+
+  const dataSet = iecDataSetTable.get(ref.replace(/\$/g, '.'));
+  const frame = dataSet && values.length === dataSet.types.length ? iecBridge.encodeDataSet(dataSet.index, dataSet.types, values) : null;
+  if (!frame) {
+    sendUi({
+      type: 'IEC_TRACE', direction: 'error', source: 'Logic Engine',
+      targetIp: 'IEC Server', targetPort: IEC_BACKEND_PORT,
+      info: dataSet ? `BRIDGE_ERR: Invalid values for ${ref}` : `BRIDGE_ERR: Data set not found: ${ref}`
+    });
+    return;
+  }
+
+  iecOutgoingFrames.push(frame);
+  scheduleIecOutgoingFrames();
+}
+
+// Waveform samples go straight to the backend's SV rings; they are never queued here
+function writeIecSvSamples(stream, samples) {
+  if (!Array.isArray(samples) || !samples.length) return;
+  if (!iecChildProcess || !iecChildReady || iecBridgeMode !== 'binary' || !iecChildCaps.has('sv')) return;
+
+  const index = typeof stream === 'number' ? stream : iecSvStreams.get(stream);
+  if (index === undefined) {
+    sendUi({
+      type: 'IEC_TRACE', direction: 'error', source: 'Logic Engine',
+      targetIp: 'IEC Server', targetPort: IEC_BACKEND_PORT, info: `BRIDGE_ERR: Unknown SV stream ${stream}`
+    });
+    return;
+  }
+
+  writeIecChild(iecBridge.encodeSvSamples(index, samples));
+}
 
 function startIecChildProcess() {
   if (!IEC_SERVER_BIN) return;
@@ -251,11 +589,30 @@ function startIecChildProcess() {
 
   console.log(`[relay] Spawning managed IEC server: ${IEC_SERVER_BIN}`);
   iecChildReady = false;
+  iecChildCaps = new Set();
+  iecBridgeMode = 'text';
+  iecHandleTable.clear();
+  iecHandleTypes.length = 0;
+  iecDataSetTable.clear();
+  if (iecSharedTable) iecSharedTable.close();
+  iecSharedTable = null;
+  iecControlTable.clear();
+  iecSvStreams.clear();
+  iecOutgoingFrames = [];
+  iecBytesWritten = 0;
+  iecBytesConsumed = 0;
+  iecCreditWindow = 0;
   iecChildStdoutBuffer = '';
   iecChildStderrBuffer = '';
-  iecChildProcess = spawn(IEC_SERVER_BIN, [String(IEC_BACKEND_PORT)], {
+
+  // A new backend starts from the SCD values; it catches up with one snapshot of what was sent before
+  for (const [ref, value] of latestIecValues) pendingIecUpdates.set(ref, value);
+  if (latestIecValues.size) console.log(`[relay] Restoring ${latestIecValues.size} IEC value(s) once the backend is ready`);
+
+  const child = spawn(IEC_SERVER_BIN, [String(IEC_BACKEND_PORT)], {
     stdio: ['pipe', 'pipe', 'pipe']
   });
+  iecChildProcess = child;
 
   iecChildProcess.on('error', (err) => {
     console.error(`[relay] Managed IEC server spawn error: ${err.message}`);
@@ -264,18 +621,27 @@ function startIecChildProcess() {
   iecChildProcess.stdin.on('error', (err) => {
     console.error(`[relay] IEC child stdin error: ${err.message}`);
   });
+  iecChildProcess.stdin.on('drain', flushPendingIecUpdates);
 
   iecChildProcess.stdout.on('data', handleIecChildStdoutChunk);
   iecChildProcess.stderr.on('data', handleIecChildStderrChunk);
 
   iecChildProcess.on('close', (code) => {
     console.log(`[relay] Managed IEC server exited with code ${code}`);
+    // A replaced child closing late must not take down its successor
+    if (iecChildProcess !== child) return;
     iecChildReady = false;
+    iecBridgeMode = 'text';
     iecChildProcess = null;
+    if (IEC_RESPAWN_MS > 0) {
+      console.log(`[relay] Restarting managed IEC server in ${IEC_RESPAWN_MS} ms`);
+      setTimeout(() => { if (!iecChildProcess) startIecChildProcess(); }, IEC_RESPAWN_MS);
+    }
   });
 }
 
 function startServers() {
+  loadIecBindings();
   startIecChildProcess();
   applyProtocolEndpoints('modbus', []);
   applyProtocolEndpoints('iec61850', []);
@@ -845,6 +1211,15 @@ wss.on('connection', (ws, req) => {
       case 'IEC_UPDATE':
         routeIecUpdate(msg.ref, msg.value);
         break;
+      case 'IEC_DATASET':
+        writeIecDataSet(msg.ref, msg.values);
+        break;
+      case 'IEC_SV_SAMPLES':
+        writeIecSvSamples(msg.stream, msg.samples);
+        break;
+      case 'IEC_METRICS':
+        requestIecMetrics();
+        break;
       case 'IED_MODEL':
         // Store the received IED model
         if (msg.protocol && msg.ip && msg.port && msg.model) {
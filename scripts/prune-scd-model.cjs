@@ -0,0 +1,116 @@
+// Writes a copy of an SCD file without the logical nodes the simulation
+// never touches, so genmodel/genconfig build a smaller model.
+//
+// An LN is kept if a reference in the bindings file (one IEC reference per
+// line, as recorded by the relay through RELAY_IEC_BINDINGS_FILE) points
+// into it, or if it is a member of a DataSet of a kept logical device.
+// LLN0 always stays with its LD, so data sets and control blocks keep
+// resolving; members of those data sets pull their LNs (and LDs) back in
+// until nothing changes. An LD without any kept LN is dropped entirely.
+// IEDs the bindings file does not mention are copied unchanged.
+//
+// Usage: node scripts/prune-scd-model.cjs <scd> <bindings file> <out.scd>
+
+const fs = require('fs');
+
+const IED_ELEMENT = /<IED\s[^>]*\bname="([^"]+)"[^>]*>[\s\S]*?<\/IED>/g;
+const LDEVICE_ELEMENT = /\n?[ \t]*<LDevice\s[^>]*\binst="([^"]+)"[^>]*>([\s\S]*?)<\/LDevice>/g;
+const LN_ELEMENT = /\n?[ \t]*<LN\s([^>]*?)(?:\/>|>[\s\S]*?<\/LN>)/g;
+const FCDA_ELEMENT = /<FCDA\s([^>]*?)\/?>/g;
+
+function attribute(attributes, name) {
+  const match = new RegExp(`\\b${name}="([^"]*)"`).exec(attributes);
+  return match ? match[1] : '';
+}
+
+function lnName(attributes, instName) {
+  return attribute(attributes, 'prefix') + attribute(attributes, 'lnClass') + attribute(attributes, instName);
+}
+
+function readBindings(file, iedNames) {
+  // Longest IED name first, so FCB01 is not matched inside FCB010
+  const names = [...iedNames].sort((a, b) => b.length - a.length);
+  const wanted = new Map(); // "IED/LD" -> Set of LN names
+
+  for (const line of fs.readFileSync(file, 'utf8').split('\n')) {
+    const ref = line.trim();
+    const slash = ref.indexOf('/');
+    if (!ref || ref.startsWith('#') || slash < 0) continue;
+
+    const ldName = ref.substring(0, slash);
+    const ied = names.find((name) => ldName.startsWith(name));
+    if (!ied) continue;
+
+    const key = `${ied}/${ldName.substring(ied.length)}`;
+    if (!wanted.has(key)) wanted.set(key, new Set());
+    wanted.get(key).add(ref.substring(slash + 1).split('.')[0]);
+  }
+
+  return wanted;
+}
+
+function prune(scd, bindingsFile) {
+  const ieds = [...scd.matchAll(IED_ELEMENT)].map((match) => match[1]);
+  const wanted = readBindings(bindingsFile, ieds);
+
+  if (wanted.size === 0) throw new Error(`no references in ${bindingsFile} match an IED of the SCD`);
+
+  // Follow data set members from kept LDs until the kept set is closed
+  let changed = true;
+  while (changed) {
+    changed = false;
+    for (const iedMatch of scd.matchAll(IED_ELEMENT)) {
+      const ied = iedMatch[1];
+      for (const ldMatch of iedMatch[0].matchAll(LDEVICE_ELEMENT)) {
+        if (!wanted.has(`${ied}/${ldMatch[1]}`)) continue;
+
+        for (const fcda of ldMatch[2].matchAll(FCDA_ELEMENT)) {
+          const key = `${ied}/${attribute(fcda[1], 'ldInst')}`;
+          const ln = lnName(fcda[1], 'lnInst');
+          if (!wanted.has(key)) wanted.set(key, new Set());
+          if (!wanted.get(key).has(ln)) {
+            wanted.get(key).add(ln);
+            changed = true;
+          }
+        }
+      }
+    }
+  }
+
+  const stats = { devices: 0, devicesKept: 0, nodes: 0, nodesKept: 0 };
+
+  const boundIeds = new Set([...wanted.keys()].map((key) => key.split('/')[0]));
+
+  // IEDs without any binding are left as they are
+  const output = scd.replace(IED_ELEMENT, (iedElement, ied) => !boundIeds.has(ied) ? iedElement :
+    iedElement.replace(LDEVICE_ELEMENT, (ldElement, inst) => {
+      stats.devices++;
+      const keep = wanted.get(`${ied}/${inst}`);
+      if (!keep) return '';
+
+      stats.devicesKept++;
+      return ldElement.replace(LN_ELEMENT, (lnElement, attributes) => {
+        stats.nodes++;
+        if (!keep.has(lnName(attributes, 'inst'))) return '';
+        stats.nodesKept++;
+        return lnElement;
+      });
+    }));
+
+  return { output, stats };
+}
+
+function main() {
+  const [scdFile, bindingsFile, outFile] = process.argv.slice(2);
+  if (!scdFile || !bindingsFile || !outFile) {
+    console.error('usage: node scripts/prune-scd-model.cjs <scd> <bindings file> <out.scd>');
+    process.exit(1);
+  }
+
+  const { output, stats } = prune(fs.readFileSync(scdFile, 'utf8'), bindingsFile);
+
+  fs.writeFileSync(outFile, output);
+  console.log(`[prune-scd-model] ${outFile}: kept ${stats.devicesKept}/${stats.devices} logical devices, ${stats.nodesKept}/${stats.nodes} logical nodes`);
+}
+
+main();
@@ -0,0 +1,80 @@
+// Splits genmodel output (ied_model.c) into one translation unit per
+// LogicalDevice so the model compiles in parallel.
+//
+// genmodel emits one global definition per model node, LD by LD, and
+// declares every node in ied_model.h. Each LogicalDevice and the nodes
+// below it (symbols prefixed iedModel_<LD>_) move to ied_model_ld_<LD>.c;
+// data sets, control blocks, the IedModel itself and initializeValues()
+// stay in ied_model_main.c. Nothing else changes, so the linked model is
+// identical to compiling ied_model.c as a whole.
+//
+// Usage: node scripts/split-iec-model.cjs <ied_model.c> <output dir>
+
+const fs = require('fs');
+const path = require('path');
+
+const NODE_DEFINITION = /^(LogicalDevice|LogicalNode|DataObject|DataAttribute)\s+(iedModel_\w+)\s*=/;
+const LD_DEFINITION = /^LogicalDevice\s+(iedModel_\w+)\s*=/;
+
+// Top-level chunks: a line starting in column 0 with an identifier opens a new one
+function chunks(source) {
+  const result = [];
+  let current = [];
+
+  for (const line of source.split('\n')) {
+    if (/^[A-Za-z#]/.test(line) && current.length) {
+      result.push(current.join('\n'));
+      current = [];
+    }
+    current.push(line);
+  }
+  if (current.length) result.push(current.join('\n'));
+
+  return result;
+}
+
+function split(source) {
+  const devices = [];
+  for (const line of source.split('\n')) {
+    const match = LD_DEFINITION.exec(line);
+    if (match) devices.push(match[1]);
+  }
+  if (devices.length === 0) throw new Error('no LogicalDevice definitions found');
+
+  // Longest prefix first, so iedModel_CB1_Fundamental_* is not taken for iedModel_CB1_*
+  const prefixes = [...devices].sort((a, b) => b.length - a.length);
+  const parts = new Map(devices.map((device) => [device, []]));
+  const main = [];
+
+  for (const chunk of chunks(source)) {
+    const match = NODE_DEFINITION.exec(chunk);
+    const owner = match && prefixes.find((device) => match[2] === device || match[2].startsWith(device + '_'));
+
+    if (owner) parts.get(owner).push(chunk);
+    else main.push(chunk);
+  }
+
+  return { main: main.join('\n'), parts };
+}
+
+function main() {
+  const [file, outDir] = process.argv.slice(2);
+  if (!file || !outDir) {
+    console.error('usage: node scripts/split-iec-model.cjs <ied_model.c> <output dir>');
+    process.exit(1);
+  }
+
+  const { main: mainSource, parts } = split(fs.readFileSync(file, 'utf8'));
+
+  fs.mkdirSync(outDir, { recursive: true });
+  fs.writeFileSync(path.join(outDir, 'ied_model_main.c'), mainSource);
+
+  for (const [device, definitions] of parts) {
+    const name = `ied_model_ld_${device.substring('iedModel_'.length)}.c`;
+    fs.writeFileSync(path.join(outDir, name), `#include "ied_model.h"\n\n${definitions.join('\n')}\n`);
+  }
+
+  console.log(`[split-iec-model] ${file}: ${parts.size} logical devices into ${outDir}`);
+}
+
+main();
@@ -8,6 +8,10 @@ SCD_FILE="${SCD_FILE:-$ROOT_DIR/DUBGG.scd}"
 SCD_IED_NAME="${SCD_IED_NAME:-}"
 SCD_AP_NAME="${SCD_AP_NAME:-}"
 LIBIEC_BIN="${LIBIEC_BIN:-$GEN_DIR/dubgg_server}"
+BENCH_BIN="${BENCH_BIN:-$GEN_DIR/dubgg_bench}"
+IEC_MODEL_MODE="${IEC_MODEL_MODE:-static}"
+MODEL_CONFIG="${MODEL_CONFIG:-$GEN_DIR/ied_model.cfg}"
+MODEL_PRUNE_BINDINGS="${IEC_MODEL_PRUNE:-}"
 BACKEND_PORT="${IEC_BACKEND_PORT:-8102}"
 BACKEND_HOST="${IEC_BACKEND_HOST:-127.0.0.1}"
 RELAY_AUTOCONFIG_ENDPOINT="${RELAY_AUTOCONFIG_ENDPOINT:-0}"
@@ -23,6 +27,28 @@ resolve_scd_path() {
   fi
 }
 
+# With IEC_MODEL_PRUNE=<bindings file> the model is built from a copy of
+# the SCD holding only the LNs those references (and their data sets) use.
+model_scd_path() {
+  local scd="$1"
+
+  if [[ -z "$MODEL_PRUNE_BINDINGS" ]]; then
+    echo "$scd"
+    return 0
+  fi
+
+  if [[ ! -s "$MODEL_PRUNE_BINDINGS" ]]; then
+    echo "[std-iec] prune bindings file is missing or empty: $MODEL_PRUNE_BINDINGS" >&2
+    exit 1
+  fi
+
+  local pruned="$GEN_DIR/pruned.scd"
+  if [[ ! -f "$pruned" || "$scd" -nt "$pruned" || "$MODEL_PRUNE_BINDINGS" -nt "$pruned" ]]; then
+    node "$ROOT_DIR/scripts/prune-scd-model.cjs" "$scd" "$MODEL_PRUNE_BINDINGS" "$pruned" >&2
+  fi
+  echo "$pruned"
+}
+
 build_libiec() {
   if [[ -f "$LIBIEC_ROOT/build/src/libiec61850.a" && -f "$LIBIEC_ROOT/build/hal/libhal.a" ]]; then
     return 0
@@ -41,6 +67,11 @@ build_libiec() {
 }
 
 build_scd_backend() {
+  generate_scd_model
+  compile_backend
+}
+
+generate_scd_model() {
   local resolved_scd
   resolved_scd="$(resolve_scd_path)"
 
@@ -50,6 +81,7 @@ build_scd_backend() {
   fi
 
   mkdir -p "$GEN_DIR"
+  resolved_scd="$(model_scd_path "$resolved_scd")"
 
   local scd_marker="$GEN_DIR/.active_scd"
   local previous_scd=""
@@ -79,43 +111,199 @@ build_scd_backend() {
       fi
       java -jar "$LIBIEC_ROOT/tools/model_generator/genmodel.jar" "${args[@]}"
     )
+    node "$ROOT_DIR/scripts/compact-iec-model.cjs" "$GEN_DIR/ied_model.c"
     echo "$resolved_scd" > "$scd_marker"
   fi
 
-  if [[ ! -x "$LIBIEC_BIN" || "$GEN_DIR/ied_model.c" -nt "$LIBIEC_BIN" || "$ROOT_DIR/scripts/dubgg_libiec_server.c" -nt "$LIBIEC_BIN" ]]; then
-    echo "[std-iec] compiling custom libiec backend"
-
-    cat > "$GEN_DIR/ied_model_stubs.c" <<'EOF'
-#include "iec61850_model.h"
-/* Workaround for generator output referencing missing GoCB symbol in some SCD files */
-GSEControlBlock iedModel_Application_LLN0_gse0 = {0};
-EOF
-
-    cc -O2 -Wredundant-decls -Wundef \
-      -I"$LIBIEC_ROOT/build/config" \
-      -I"$LIBIEC_ROOT/src/common/inc" \
-      -I"$LIBIEC_ROOT/src/goose" \
-      -I"$LIBIEC_ROOT/src/sampled_values" \
-      -I"$LIBIEC_ROOT/src/r_session" \
-      -I"$LIBIEC_ROOT/src/hal/inc" \
-      -I"$LIBIEC_ROOT/src/iec61850/inc" \
-      -I"$LIBIEC_ROOT/src/iec61850/inc_private" \
-      -I"$LIBIEC_ROOT/src/mms/inc" \
-      -I"$LIBIEC_ROOT/src/mms/inc_private" \
-      -I"$LIBIEC_ROOT/src/mms/iso_mms/asn1c" \
-      -I"$LIBIEC_ROOT/src/logging" \
-      -I"$LIBIEC_ROOT/hal/inc" \
-      -I"$GEN_DIR" \
+  # genmodel leaves out GoCBs whose GSE address sits on another access point
+  if [[ ! -f "$GEN_DIR/ied_model_gse.c" || "$GEN_DIR/ied_model.c" -nt "$GEN_DIR/ied_model_gse.c" ]]; then
+    node "$ROOT_DIR/scripts/gse-iec-model.cjs" "$resolved_scd" "$GEN_DIR/ied_model.c" "$GEN_DIR/ied_model_gse.c"
+  fi
+}
+
+LIBIEC_CFLAGS=(
+  -O2 -Wredundant-decls -Wundef
+  -I"$LIBIEC_ROOT/build/config"
+  -I"$LIBIEC_ROOT/src/common/inc"
+  -I"$LIBIEC_ROOT/src/goose"
+  -I"$LIBIEC_ROOT/src/sampled_values"
+  -I"$LIBIEC_ROOT/src/r_session"
+  -I"$LIBIEC_ROOT/src/hal/inc"
+  -I"$LIBIEC_ROOT/src/iec61850/inc"
+  -I"$LIBIEC_ROOT/src/iec61850/inc_private"
+  -I"$LIBIEC_ROOT/src/mms/inc"
+  -I"$LIBIEC_ROOT/src/mms/inc_private"
+  -I"$LIBIEC_ROOT/src/mms/iso_mms/asn1c"
+  -I"$LIBIEC_ROOT/src/logging"
+  -I"$LIBIEC_ROOT/hal/inc"
+  -I"$GEN_DIR"
+)
+
+# The generated model is compiled once into a static library cached under
+# the hash of its sources, so rebuilding the server only recompiles
+# dubgg_libiec_server.c. IEC_MODEL_SPLIT=1 compiles the model as one
+# translation unit per LogicalDevice, in parallel.
+compile_model() {
+  local key
+  key="$({ cat "$GEN_DIR/ied_model.c" "$GEN_DIR/ied_model.h" "$GEN_DIR/ied_model_gse.c"; echo "split=${IEC_MODEL_SPLIT:-0}"; } | sha256sum | cut -c1-16)"
+  MODEL_LIB="$GEN_DIR/model-cache/$key/libied_model.a"
+
+  if [[ -f "$MODEL_LIB" ]]; then
+    return 0
+  fi
+
+  local cache_dir="$GEN_DIR/model-cache/$key"
+  rm -rf "$cache_dir"
+  mkdir -p "$cache_dir/src"
+
+  cp "$GEN_DIR/ied_model_gse.c" "$cache_dir/src/"
+
+  if [[ "${IEC_MODEL_SPLIT:-0}" == "1" ]]; then
+    echo "[std-iec] compiling IEC model $key per logical device"
+    node "$ROOT_DIR/scripts/split-iec-model.cjs" "$GEN_DIR/ied_model.c" "$cache_dir/src"
+  else
+    echo "[std-iec] compiling IEC model $key"
+    cp "$GEN_DIR/ied_model.c" "$cache_dir/src/"
+  fi
+
+  printf '%s\n' "$cache_dir"/src/*.c \
+    | xargs -P "$(nproc)" -I{} cc "${LIBIEC_CFLAGS[@]}" -c {} -o {}.o
+  ar rcs "$MODEL_LIB.tmp" "$cache_dir"/src/*.o
+  mv "$MODEL_LIB.tmp" "$MODEL_LIB"
+  rm -rf "$cache_dir/src"
+}
+
+# IEC_BACKEND_MARCH (e.g. native) builds the backend for that CPU, so the
+# shared value table scan can use AVX2; the baseline build uses SSE2/NEON.
+compile_backend() {
+  compile_model
+
+  local march_marker="$GEN_DIR/backend-march"
+  local march_flags=()
+  [[ -n "${IEC_BACKEND_MARCH:-}" ]] && march_flags=(-march="$IEC_BACKEND_MARCH")
+
+  if [[ ! -x "$LIBIEC_BIN" || "$MODEL_LIB" -nt "$LIBIEC_BIN" || "$ROOT_DIR/scripts/dubgg_libiec_server.c" -nt "$LIBIEC_BIN" ||
+        "$(cat "$march_marker" 2>/dev/null)" != "${IEC_BACKEND_MARCH:-}" ]]; then
+    echo "[std-iec] compiling custom libiec backend${IEC_BACKEND_MARCH:+ for -march=$IEC_BACKEND_MARCH}"
+
+    cc "${LIBIEC_CFLAGS[@]}" "${march_flags[@]}" \
       "$ROOT_DIR/scripts/dubgg_libiec_server.c" \
-      "$GEN_DIR/ied_model.c" \
-      "$GEN_DIR/ied_model_stubs.c" \
+      "$MODEL_LIB" \
       "$LIBIEC_ROOT/build/src/libiec61850.a" \
       "$LIBIEC_ROOT/build/hal/libhal.a" \
       -lpthread -lm -lrt \
       -o "$LIBIEC_BIN"
+    echo "${IEC_BACKEND_MARCH:-}" > "$march_marker"
   fi
 }
 
+compile_bench() {
+  if [[ ! -x "$BENCH_BIN" || "$ROOT_DIR/scripts/dubgg_libiec_bench.c" -nt "$BENCH_BIN" ]]; then
+    echo "[std-iec] compiling libiec bridge benchmark"
+
+    cc "${LIBIEC_CFLAGS[@]}" \
+      "$ROOT_DIR/scripts/dubgg_libiec_bench.c" \
+      "$LIBIEC_ROOT/build/src/libiec61850.a" \
+      "$LIBIEC_ROOT/build/hal/libhal.a" \
+      -lpthread -lm -lrt \
+      -o "$BENCH_BIN"
+  fi
+}
+
+# Unit checks of the bridge parsers; links the backend sources, so it needs the compiled model too
+compile_test() {
+  local test_bin="$GEN_DIR/dubgg_test"
+
+  if [[ ! -x "$test_bin" || "$MODEL_LIB" -nt "$test_bin" || "$ROOT_DIR/scripts/dubgg_libiec_test.c" -nt "$test_bin" ||
+        "$ROOT_DIR/scripts/dubgg_libiec_server.c" -nt "$test_bin" ]]; then
+    echo "[std-iec] compiling libiec bridge unit checks"
+
+    cc "${LIBIEC_CFLAGS[@]}" -I"$ROOT_DIR/scripts" \
+      "$ROOT_DIR/scripts/dubgg_libiec_test.c" \
+      "$MODEL_LIB" \
+      "$LIBIEC_ROOT/build/src/libiec61850.a" \
+      "$LIBIEC_ROOT/build/hal/libhal.a" \
+      -lpthread -lm -lrt \
+      -o "$test_bin"
+  fi
+}
+
+# Config mode: the prebuilt backend loads the selected IED from a genconfig
+# model file at startup, so switching SCD/IED needs no regenerate-and-compile.
+# A comma-separated SCD_IED_NAME hosts every listed IED in the one backend,
+# each on its own port counting up from IEC_BACKEND_PORT.
+build_scd_config() {
+  local resolved_scd
+  resolved_scd="$(resolve_scd_path)"
+
+  if [[ ! -f "$resolved_scd" ]]; then
+    echo "[std-iec] SCD file not found: $resolved_scd"
+    exit 1
+  fi
+
+  mkdir -p "$GEN_DIR"
+  resolved_scd="$(model_scd_path "$resolved_scd")"
+
+  # The binary still links a compiled-in model; build it once from whatever SCD is active
+  if [[ ! -f "$GEN_DIR/ied_model.c" || ! -f "$GEN_DIR/ied_model_gse.c" ]]; then
+    SCD_IED_NAME="${SCD_IED_NAME%%,*}" generate_scd_model
+  fi
+  compile_backend
+
+  local ied_names=()
+  local cfg_files=()
+  if [[ "$SCD_IED_NAME" == *,* ]]; then
+    IFS=',' read -r -a ied_names <<< "$SCD_IED_NAME"
+    local ied
+    for ied in "${ied_names[@]}"; do
+      cfg_files+=("$GEN_DIR/ied_model.$ied.cfg")
+    done
+  else
+    ied_names=("$SCD_IED_NAME")
+    cfg_files=("$MODEL_CONFIG")
+  fi
+
+  local cfg_marker="$GEN_DIR/.active_scd_cfg"
+  local selection="$resolved_scd|$SCD_IED_NAME|$SCD_AP_NAME"
+  local previous_selection=""
+  if [[ -f "$cfg_marker" ]]; then
+    previous_selection="$(cat "$cfg_marker" 2>/dev/null || true)"
+  fi
+
+  local i
+  for i in "${!cfg_files[@]}"; do
+    local cfg="${cfg_files[$i]}"
+    if [[ ! -f "$cfg" || "$resolved_scd" -nt "$cfg" || "$previous_selection" != "$selection" ]]; then
+      echo "[std-iec] generating IEC model config $cfg from $resolved_scd"
+      local args=("$resolved_scd" "$cfg")
+      if [[ -n "${ied_names[$i]}" ]]; then
+        args+=("-ied" "${ied_names[$i]}")
+      fi
+      if [[ -n "$SCD_AP_NAME" ]]; then
+        args+=("-ap" "$SCD_AP_NAME")
+      fi
+      java -jar "$LIBIEC_ROOT/tools/model_generator/genconfig.jar" "${args[@]}"
+    fi
+  done
+  echo "$selection" > "$cfg_marker"
+
+  # The backend assigns IEC_BACKEND_PORT, +1, ... to the files in list order
+  local IFS=','
+  export IEC_MODEL_CONFIG="${cfg_files[*]}"
+}
+
+# IEC_GOOSE_SUBSCRIBE=1 subscribes the hosted IEDs to their peers' GOOSE as
+# wired by the SCD ExtRefs; the backend reads the table at startup.
+build_goose_subscriptions() {
+  if [[ "${IEC_GOOSE_SUBSCRIBE:-0}" != "1" ]]; then
+    return 0
+  fi
+
+  local subscriptions="$GEN_DIR/goose-subscriptions.txt"
+  node "$ROOT_DIR/scripts/goose-subscriptions.cjs" "$(resolve_scd_path)" "$subscriptions" "$SCD_IED_NAME"
+  export IEC_GOOSE_SUBSCRIPTIONS="$subscriptions"
+}
+
 stop_old() {
   pkill -f "$LIBIEC_BIN $BACKEND_PORT" >/dev/null 2>&1 || true
   pkill -f "node scripts/modbus-relay.cjs" >/dev/null 2>&1 || true
@@ -160,6 +348,9 @@ show_status() {
   echo "[std-iec] listeners:"
   ss -tlnp | grep -E ":102|:$BACKEND_PORT" || true
   echo "[std-iec] active SCD: $(resolve_scd_path)"
+  if [[ "$IEC_MODEL_MODE" == "config" ]]; then
+    echo "[std-iec] model config: ${IEC_MODEL_CONFIG:-$MODEL_CONFIG}"
+  fi
   if [[ -n "$SCD_IED_NAME" ]]; then
     echo "[std-iec] selected IED: $SCD_IED_NAME"
   fi
@@ -171,7 +362,30 @@ show_status() {
 }
 
 build_libiec
-build_scd_backend
+if [[ "$IEC_MODEL_MODE" == "config" ]]; then
+  build_scd_config
+else
+  if [[ "$SCD_IED_NAME" == *,* ]]; then
+    echo "[std-iec] hosting several IEDs requires IEC_MODEL_MODE=config"
+    exit 1
+  fi
+  build_scd_backend
+fi
+build_goose_subscriptions
+
+# `bench [options]`: run dubgg_libiec_bench against a private backend instead of starting the relay
+if [[ "${1:-}" == "bench" ]]; then
+  shift
+  compile_bench
+  exec "$BENCH_BIN" "$@" "$LIBIEC_BIN"
+fi
+
+# `test`: run the bridge unit checks instead of starting the relay
+if [[ "${1:-}" == "test" ]]; then
+  compile_test
+  exec "$GEN_DIR/dubgg_test"
+fi
+
 stop_old
 start_backend
 start_relay
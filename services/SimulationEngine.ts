@@ -375,6 +375,9 @@ export class SimulationEngine {
                     targetPort: msg.targetPort
                 });
                 break;
+            case 'IEC_CONTROL':
+                this.processExternalIecControl(msg);
+                break;
             case 'ENDPOINT_STATUS_LIST':
                 this.bridgeStatus.boundEndpoints = Array.isArray(msg.endpoints) ? msg.endpoints : [];
                 this.updateBridgeStatus();
@@ -818,6 +821,19 @@ export class SimulationEngine {
         }
 
         // Perform Operation
+        this.applyControlValue(doPath, value);
+
+        // Cleanup SBO session
+        if (controlModel.includes('sbo')) {
+            this.activeControls.delete(doPath);
+        }
+
+        this.emitLog('mms', `Operate Success: ${doPath} = ${value}`);
+        this.emitPacket('MMS', 'Server', client, `Operate Response: Success`, { value });
+        return { success: true };
+    }
+
+    private applyControlValue(doPath: string, value: any) {
         // Map 'on'/'off' to boolean logic if needed or store as enum
         const oldValue = this.iedValues.get(`${doPath}.stVal`);
         this.iedValues.set(`${doPath}.stVal`, value);
@@ -827,11 +843,6 @@ export class SimulationEngine {
             this.checkGooseTriggers(`${doPath}.stVal`, value);
         }
 
-        // Cleanup SBO session
-        if (controlModel.includes('sbo')) {
-            this.activeControls.delete(doPath);
-        }
-
         // Sync known simulation hooks for dashboard visual
         if (doPath.includes('XCBR') && doPath.includes('Pos')) {
             // 'on' = Closed = Coil True
@@ -839,10 +850,29 @@ export class SimulationEngine {
             const coilState = (value === 'on');
             this.setCoil(2, coilState, 'IEC61850');
         }
+    }
 
-        this.emitLog('mms', `Operate Success: ${doPath} = ${value}`);
-        this.emitPacket('MMS', 'Server', client, `Operate Response: Success`, { value });
-        return { success: true };
+    /**
+     * Operate already executed by the libiec61850 backend; mirror it so logic sees it in the same tick
+     */
+    private processExternalIecControl(msg: any) {
+        const { ref, ctlVal, ctlNum, orCat, orIdent, test } = msg;
+        if (!ref) return;
+
+        const origin = [
+            ctlNum !== undefined ? `ctlNum=${ctlNum}` : undefined,
+            orCat !== undefined ? `orCat=${orCat}` : undefined,
+            orIdent ? `orIdent=${orIdent}` : undefined
+        ].filter(Boolean).join(' ');
+        this.emitLog('mms', `[Bridge RX] Operate ${ref} = ${ctlVal}${test ? ' (test)' : ''}${origin ? ` ${origin}` : ''}`);
+
+        if (test) return;
+
+        // DPC ctlVal is a boolean while the simulated stVal holds the Dbpos name
+        const current = this.readMMS(`${ref}.stVal`);
+        const value = (typeof ctlVal === 'boolean' && typeof current === 'string') ? (ctlVal ? 'on' : 'off') : ctlVal;
+
+        this.applyControlValue(ref, value);
     }
 
     public cancelControl(doPath: string): { success: boolean } {
@@ -1006,6 +1036,8 @@ export class SimulationEngine {
                     .replace(/Device\.WriteRegister\('(\d+)',\s*(.*)\)/g, "ctx.writeRegister($1, $2)")
                     // IEC 61850 Bridge Commands
                     .replace(/IEC\.Update\(([^)]+)\)/g, "ctx.IEC.Update($1)")
+                    .replace(/IEC\.PublishSamples\(/g, "ctx.IEC.PublishSamples(")
+                    .replace(/IEC\.UpdateDataSet\(/g, "ctx.IEC.UpdateDataSet(")
                     .replace(/IEC\.Read\('([^']+)'\)/g, "ctx.getDAValue('$1')")
 
                     // IEC 61131-3 ST Syntax to JS conversions
@@ -1440,6 +1472,24 @@ export class SimulationEngine {
         });
     }
 
+    // samples: 8-channel rows (Ia, Ib, Ic, In in mA; Va, Vb, Vc, Vn in 10 mV) for a 9-2LE stream
+    public publishSvSamples(stream: string | number, samples: number[][]) {
+        this.sendBridgeMessage({
+            type: 'IEC_SV_SAMPLES',
+            stream,
+            samples
+        });
+    }
+
+    // values: one per data set member in FCDA order, null leaves a member unchanged
+    public updateIecDataSet(ref: string, values: any[]) {
+        this.sendBridgeMessage({
+            type: 'IEC_DATASET',
+            ref,
+            values
+        });
+    }
+
     private createContext(sourceName: string): IDeviceContext {
         return {
             readCoil: (addr) => this.getCoil(Number(addr), sourceName),
@@ -1451,7 +1501,9 @@ export class SimulationEngine {
             setDAValue: (path, value) => this.writeMMS(path, value, sourceName),
             Log: (level, msg) => this.emitLog(level, `[${sourceName}] ${msg}`),
             IEC: {
-                Update: (path, value) => this.updateIecAttribute(path, value)
+                Update: (path, value) => this.updateIecAttribute(path, value),
+                PublishSamples: (stream, samples) => this.publishSvSamples(stream, samples),
+                UpdateDataSet: (ref, values) => this.updateIecDataSet(ref, values)
             }
         };
     }
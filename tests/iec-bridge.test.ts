@@ -0,0 +1,233 @@
+// @vitest-environment node
+import { describe, it, expect } from 'vitest';
+import bridge from '../scripts/lib/iec-bridge.cjs';
+
+const { BridgeType } = bridge;
+
+// Wire constants of scripts/dubgg_libiec_server.c, written out so a change on one side shows up here
+const OP = { UPDATE: 0x01, BEGIN: 0x02, COMMIT: 0x03, SV_SAMPLES: 0x04, STATS: 0x05, DATASET: 0x06 };
+const FLAG_TIMESTAMP = 0x01;
+
+// Splits a stdin payload into frames the way bridge_read_input does: u16 length | length bytes
+function splitFrames(buffer) {
+  const frames = [];
+  let pos = 0;
+  while (pos < buffer.length) {
+    const len = buffer.readUInt16LE(pos);
+    frames.push(buffer.subarray(pos + 2, pos + 2 + len));
+    pos += 2 + len;
+  }
+  expect(pos).toBe(buffer.length);
+  return frames;
+}
+
+function readValue(type, bytes, pos) {
+  switch (type) {
+    case BridgeType.BOOLEAN: return [bytes[pos] !== 0, 1];
+    case BridgeType.DBPOS: return [bytes[pos], 1];
+    case BridgeType.INT32: return [bytes.readInt32LE(pos), 4];
+    case BridgeType.UINT32:
+    case BridgeType.BITSTRING: return [bytes.readUInt32LE(pos), 4];
+    case BridgeType.FLOAT: return [bytes.readFloatLE(pos), 4];
+    case BridgeType.INT64: return [bytes.readBigInt64LE(pos), 8];
+    case BridgeType.UTCTIME: return [Number(bytes.readBigUInt64LE(pos)), 8];
+    default: throw new Error(`no fixed size for type ${type}`);
+  }
+}
+
+// BRIDGE_OP_UPDATE: u32 handle | u8 type | u8 flags | value | [u64 t ms]
+function decodeUpdate(frame) {
+  expect(frame[0]).toBe(OP.UPDATE);
+  const type = frame[5];
+  const flags = frame[6];
+  const timeLen = flags & FLAG_TIMESTAMP ? 8 : 0;
+  const update = { handle: frame.readUInt32LE(1), type, flags };
+  if (type === BridgeType.STRING) {
+    update.value = frame.toString('utf8', 7, frame.length - timeLen);
+  } else {
+    const [value, size] = readValue(type, frame, 7);
+    expect(frame.length).toBe(7 + size + timeLen);
+    update.value = value;
+  }
+  if (timeLen) update.timestampMs = Number(frame.readBigUInt64LE(frame.length - 8));
+  return update;
+}
+
+// BRIDGE_OP_DATASET: u16 index | u8 flags | [u64 t ms] | per member u8 type | value (strings u8 length | bytes)
+function decodeDataSet(frame) {
+  expect(frame[0]).toBe(OP.DATASET);
+  const flags = frame[3];
+  let pos = flags & FLAG_TIMESTAMP ? 12 : 4;
+  const decoded = { index: frame.readUInt16LE(1), timestampMs: pos === 12 ? Number(frame.readBigUInt64LE(4)) : undefined, members: [] };
+  while (pos < frame.length) {
+    const type = frame[pos++];
+    if (type === BridgeType.NONE) {
+      decoded.members.push(null);
+    } else if (type === BridgeType.STRING) {
+      const len = frame[pos++];
+      decoded.members.push(frame.toString('utf8', pos, pos + len));
+      pos += len;
+    } else {
+      const [value, size] = readValue(type, frame, pos);
+      decoded.members.push(value);
+      pos += size;
+    }
+  }
+  expect(pos).toBe(frame.length);
+  return decoded;
+}
+
+describe('update frames', () => {
+  it('lays out a float update without timestamp', () => {
+    const frame = bridge.encodeUpdate(0x01020304, BridgeType.FLOAT, 1.5);
+    expect([...frame]).toEqual([11, 0, OP.UPDATE, 0x04, 0x03, 0x02, 0x01, BridgeType.FLOAT, 0, 0x00, 0x00, 0xc0, 0x3f]);
+  });
+
+  it('appends the timestamp after the value and sets the flag', () => {
+    const [frame] = splitFrames(bridge.encodeUpdate(7, BridgeType.DBPOS, 'on', 1714566600250));
+    expect(decodeUpdate(frame)).toEqual({ handle: 7, type: BridgeType.DBPOS, flags: FLAG_TIMESTAMP, value: 2, timestampMs: 1714566600250 });
+  });
+
+  it.each([
+    [BridgeType.BOOLEAN, 'true', true],
+    [BridgeType.BOOLEAN, '0', false],
+    [BridgeType.INT32, -42, -42],
+    [BridgeType.INT32, 'false', 0],
+    [BridgeType.UINT32, 4294967295, 4294967295],
+    [BridgeType.FLOAT, 230.1, Math.fround(230.1)],
+    [BridgeType.INT64, '-9223372036854775808', -9223372036854775808n],
+    [BridgeType.BITSTRING, 0x1000, 0x1000],
+    [BridgeType.BITSTRING, 'invalid|test', 0x802],
+    [BridgeType.UTCTIME, '2024-05-01T12:30:00.250Z', 1714566600250],
+    [BridgeType.DBPOS, 'intermediate', 0],
+    [BridgeType.DBPOS, 3, 3],
+    [BridgeType.STRING, 'Wärme', 'Wärme']
+  ])('round-trips type %i value %j', (type, value, expected) => {
+    const [frame] = splitFrames(bridge.encodeUpdate(5, type, value));
+    const update = decodeUpdate(frame);
+    expect(update.type).toBe(type);
+    expect(update.flags).toBe(0);
+    expect(update.value).toEqual(expected);
+  });
+
+  it('cuts strings at 255 bytes', () => {
+    const [frame] = splitFrames(bridge.encodeUpdate(1, BridgeType.STRING, 'x'.repeat(300)));
+    expect(decodeUpdate(frame).value).toHaveLength(255);
+  });
+
+  it.each([
+    [BridgeType.DBPOS, 'maybe'],
+    [BridgeType.DBPOS, 4],
+    [BridgeType.BITSTRING, 'invalid|bogus'],
+    [BridgeType.BITSTRING, 'invalid|'],
+    [BridgeType.BITSTRING, ''],
+    [BridgeType.FLOAT, 'abc'],
+    [BridgeType.INT64, '1.5'],
+    [BridgeType.UTCTIME, 'yesterday'],
+    [BridgeType.NONE, 1]
+  ])('rejects type %i value %j', (type, value) => {
+    expect(bridge.encodeUpdate(1, type, value)).toBeNull();
+  });
+});
+
+describe('quality keywords', () => {
+  // IEC 61850-7-3 bit values, as QUALITY_* of libiec61850 and parse_quality_text in the backend
+  it('match the backend quality bits', () => {
+    expect(bridge.QUALITY_BITS).toEqual({
+      good: 0x0, invalid: 0x2, questionable: 0x3, overflow: 0x4, outofrange: 0x8,
+      badreference: 0x10, oscillatory: 0x20, failure: 0x40, olddata: 0x80,
+      inconsistent: 0x100, inaccurate: 0x200, substituted: 0x400, test: 0x800,
+      blocked: 0x1000, derived: 0x2000
+    });
+  });
+
+  it('are case insensitive and combine with |', () => {
+    const [frame] = splitFrames(bridge.encodeUpdate(1, BridgeType.BITSTRING, 'Questionable|OldData'));
+    expect(decodeUpdate(frame).value).toBe(0x83);
+  });
+});
+
+describe('batches and control frames', () => {
+  it('leaves a single frame unwrapped', () => {
+    const frame = bridge.encodeUpdate(1, BridgeType.BOOLEAN, true);
+    expect(bridge.encodeBatch([frame])).toBe(frame);
+  });
+
+  it('wraps several frames in BEGIN and COMMIT', () => {
+    const frames = [bridge.encodeUpdate(1, BridgeType.BOOLEAN, true), bridge.encodeUpdate(2, BridgeType.INT32, 3)];
+    const split = splitFrames(bridge.encodeBatch(frames));
+    expect(split.map((frame) => frame[0])).toEqual([OP.BEGIN, OP.UPDATE, OP.UPDATE, OP.COMMIT]);
+    expect(split[0]).toHaveLength(1);
+    expect(split[3]).toHaveLength(1);
+    expect(decodeUpdate(split[2]).value).toBe(3);
+  });
+
+  it('has a one byte STATS frame', () => {
+    expect([...bridge.STATS_FRAME]).toEqual([1, 0, OP.STATS]);
+  });
+});
+
+describe('data set frames', () => {
+  const types = [BridgeType.FLOAT, BridgeType.BITSTRING, BridgeType.STRING, BridgeType.BOOLEAN, 0];
+
+  it('round-trips members and skips missing values', () => {
+    const [frame] = splitFrames(bridge.encodeDataSet(513, types, [50.25, 'good', 'abc', null, undefined]));
+    expect(decodeDataSet(frame)).toEqual({ index: 513, timestampMs: undefined, members: [50.25, 0, 'abc', null, null] });
+  });
+
+  it('puts the timestamp before the members', () => {
+    const [frame] = splitFrames(bridge.encodeDataSet(0, [BridgeType.INT32], [-1], 1000));
+    expect(frame[3]).toBe(FLAG_TIMESTAMP);
+    expect(decodeDataSet(frame)).toEqual({ index: 0, timestampMs: 1000, members: [-1] });
+  });
+
+  it('rejects values for members without a writable attribute', () => {
+    expect(bridge.encodeDataSet(0, types, [1, 0, '', null, 5])).toBeNull();
+  });
+
+  it('rejects a data set that does not fit one frame', () => {
+    const many = new Array(300).fill(BridgeType.STRING);
+    expect(bridge.encodeDataSet(0, many, many.map(() => 'x'.repeat(255)))).toBeNull();
+  });
+
+  it('writes the same values as a text line', () => {
+    expect(bridge.formatDataSetLine('IED1LD0/LLN0.DataSet_1', [1.5, null, 'on'])).toBe('DATASET IED1LD0/LLN0.DataSet_1=1.5;;on\n');
+  });
+});
+
+describe('sampled value frames', () => {
+  it('packs 8 clamped int32 channels per sample', () => {
+    const [frame] = splitFrames(bridge.encodeSvSamples(2, [[1, -1, 2.6, 1e12, -1e12, NaN, 0, 7]]));
+    expect(frame[0]).toBe(OP.SV_SAMPLES);
+    expect(frame[1]).toBe(2);
+    const channels = [];
+    for (let offset = 2; offset < frame.length; offset += 4) channels.push(frame.readInt32LE(offset));
+    expect(channels).toEqual([1, -1, 3, 0x7fffffff, -0x80000000, 0, 0, 7]);
+  });
+
+  it('splits long sample runs across frames', () => {
+    const samples = Array.from({ length: 5000 }, (_, i) => new Array(8).fill(i));
+    const frames = splitFrames(bridge.encodeSvSamples(0, samples));
+    expect(frames.length).toBe(3);
+    expect(frames.every((frame) => (frame.length - 2) % 32 === 0 && frame.length <= 0xffff)).toBe(true);
+    expect(frames.reduce((sum, frame) => sum + (frame.length - 2) / 32, 0)).toBe(5000);
+    expect(frames[2].readInt32LE(frames[2].length - 4)).toBe(4999);
+  });
+});
+
+describe('backend announcements', () => {
+  it('parses handle lines', () => {
+    expect(bridge.parseHandleLine('BRIDGE_HANDLE 3067 4 IED1CB1/XCBR1.SwAphsA.mag.f')).toEqual({ handle: 3067, type: 4, ref: 'IED1CB1/XCBR1.SwAphsA.mag.f' });
+    expect(bridge.parseHandleLine('BRIDGE_HANDLE x 4 ref')).toBeNull();
+  });
+
+  it('parses data set lines with unwritable members', () => {
+    expect(bridge.parseDataSetLine('BRIDGE_DATASET 0 IED1LD0/LLN0.DataSet_1 7934,-1,7948')).toEqual({ index: 0, ref: 'IED1LD0/LLN0.DataSet_1', handles: [7934, -1, 7948] });
+    expect(bridge.parseDataSetLine('BRIDGE_DATASET 0 IED1LD0/LLN0.DataSet_1 ')).toBeNull();
+  });
+
+  it('aliases a DO reference to its stVal', () => {
+    expect(bridge.aliasForRef('IED1CB1/XCBR1.Pos.stVal')).toBe('IED1CB1/XCBR1.Pos');
+    expect(bridge.aliasForRef('IED1CB1/XCBR1.Pos.q')).toBeNull();
+  });
+});
@@ -197,6 +197,8 @@ export interface IDeviceContext {
   // IEC Bridge Access
   IEC: {
     Update(path: string, value: any): void;
+    PublishSamples(stream: string | number, samples: number[][]): void;
+    UpdateDataSet(ref: string, values: any[]): void;
   };
 }
 